@@ -0,0 +1,235 @@
+/*
+ * Single-File-Header for a cooperative scheduler
+ *
+ * Tasks are functions that run to completion. A task runs when one of its
+ * events is posted, from an IRQ (sched_post_isr) or from another task
+ * (sched_post), and when its timer expires: every n ms (sched_every) or
+ * once after n ms (sched_after). Instead of waiting with Delay_Ms or
+ * polling a busy flag, a task starts something (a DMA transfer, a display
+ * update) and returns; the IRQ at the end posts an event that runs the
+ * task that goes on. When there is nothing to run the core sleeps (WFI)
+ * until the next interrupt.
+ *
+ * Time is counted in ms by the SysTick IRQ, with the compare register:
+ * the counter keeps running, so Delay_Ms and Delay_Us still work. There is
+ * no heap, tasks are kept in a table of SCHED_TASKS.
+ *
+ * Events are bits of a 32 bit mask. IRQ handlers only set bits; the loop
+ * takes them with the IRQs off, so none is lost (IRQs that set events must
+ * not interrupt each other, as with the default priorities).
+ *
+ * Define SCHED_HOST to run on a PC: the program provides sched_host_idle(),
+ * called instead of sleeping, that advances sched_ticks and posts the
+ * events of the simulated IRQs (see schedsim.c).
+ *
+ * Used by ringdemo, epaper and epaper12, with -I../common.
+ */
+
+#ifndef _SCHED_H
+#define _SCHED_H
+
+#include <stdint.h>
+
+// maximum number of tasks
+#ifndef SCHED_TASKS
+#define SCHED_TASKS 8
+#endif
+
+// sched_task() when the table is full; the timer functions ignore it
+#define SCHED_NONE 0xFF
+
+typedef struct {
+	void (*run)(void);
+	uint32_t events;		// events that make it run
+	uint32_t period;		// ms between runs, 0 for once
+	uint32_t due;			// when the timer expires
+	uint8_t timer;			// the timer is on
+} sched_task_t;
+
+sched_task_t sched_tasks[SCHED_TASKS];
+uint8_t sched_ntasks;
+
+// ms since the start and events not yet handled
+volatile uint32_t sched_ticks;
+volatile uint32_t sched_events;
+
+// events that made the running task run, 0 if it was the timer
+uint32_t sched_fired;
+
+// time spent sleeping, in SysTick counts (ms on the PC)
+uint32_t sched_slept;
+
+// sched_run returns when set
+volatile uint8_t sched_exit;
+
+#ifdef SCHED_HOST
+void sched_host_idle(void);
+#define SCHED_IRQ_OFF()
+#define SCHED_IRQ_ON()
+#else
+#define SCHED_IRQ_OFF() __disable_irq()
+#define SCHED_IRQ_ON() __enable_irq()
+#endif
+
+/*
+ * add a task that runs when one of the events is posted (0 for none),
+ * returns its number for the timer functions, SCHED_NONE if there are
+ * already SCHED_TASKS
+ */
+uint8_t sched_task(void (*run)(void), uint32_t events)
+{
+	sched_task_t *t;
+
+	if(sched_ntasks >= SCHED_TASKS)
+		return SCHED_NONE;
+	t = &sched_tasks[sched_ntasks];
+	t->run = run;
+	t->events = events;
+	t->timer = 0;
+	return sched_ntasks++;
+}
+
+/*
+ * run a task every ms, the first time ms from now
+ */
+void sched_every(uint8_t id, uint32_t ms)
+{
+	if(id >= sched_ntasks)
+		return;
+	sched_tasks[id].period = ms;
+	sched_tasks[id].due = sched_ticks + ms;
+	sched_tasks[id].timer = 1;
+}
+
+/*
+ * run a task once, ms from now (replaces its timer)
+ */
+void sched_after(uint8_t id, uint32_t ms)
+{
+	if(id >= sched_ntasks)
+		return;
+	sched_tasks[id].period = 0;
+	sched_tasks[id].due = sched_ticks + ms;
+	sched_tasks[id].timer = 1;
+}
+
+/*
+ * stop the timer of a task
+ */
+void sched_cancel(uint8_t id)
+{
+	if(id >= sched_ntasks)
+		return;
+	sched_tasks[id].timer = 0;
+}
+
+/*
+ * post events from an IRQ handler
+ */
+static inline void sched_post_isr(uint32_t events)
+{
+	sched_events |= events;
+}
+
+/*
+ * post events from a task
+ */
+void sched_post(uint32_t events)
+{
+	SCHED_IRQ_OFF();
+	sched_events |= events;
+	SCHED_IRQ_ON();
+}
+
+/*
+ * ms since the start
+ */
+uint32_t sched_now(void)
+{
+	return sched_ticks;
+}
+
+/*
+ * run the tasks, in the order they were added, until sched_exit is set
+ */
+void sched_run(void)
+{
+	sched_task_t *t;
+	uint32_t ev, now;
+	uint8_t ran, i;
+
+	while(!sched_exit)
+	{
+		SCHED_IRQ_OFF();
+		ev = sched_events;
+		sched_events = 0;
+		SCHED_IRQ_ON();
+		now = sched_ticks;
+
+		ran = 0;
+		for(i=0,t=sched_tasks;i<sched_ntasks;i++,t++)
+		{
+			sched_fired = ev & t->events;
+			if(!sched_fired && !(t->timer && ((int32_t)(now - t->due) >= 0)))
+				continue;
+			if(!sched_fired)
+			{
+				if(t->period == 0)
+					t->timer = 0;
+				else if((int32_t)(now - (t->due += t->period)) >= 0)
+				{
+					// late: skip the runs missed, on the same beat
+					t->due += ((now - t->due) / t->period + 1) * t->period;
+				}
+			}
+			t->run();
+			ran = 1;
+		}
+		if(ran)
+			continue;
+
+		// nothing to do: sleep until an IRQ (the tick at most); the IRQs
+		// are off so an event can't be posted between the test and the
+		// WFI, and a pending IRQ still wakes the core
+#ifdef SCHED_HOST
+		if(!sched_events)
+		{
+			uint32_t start = sched_ticks;
+			sched_host_idle();
+			sched_slept += sched_ticks - start;
+		}
+#else
+		SCHED_IRQ_OFF();
+		if(!sched_events)
+		{
+			uint32_t start = SysTick->CNT;
+			__WFI();
+			sched_slept += SysTick->CNT - start;
+		}
+		SCHED_IRQ_ON();
+#endif
+	}
+}
+
+#ifndef SCHED_HOST
+/*
+ * SysTick IRQ every ms, the counter keeps running for Delay_Ms
+ */
+void sched_init(void)
+{
+	SysTick->CMP = SysTick->CNT + DELAY_MS_TIME;
+	SysTick->SR = 0;
+	SysTick->CTLR |= SYSTICK_CTLR_STIE;
+	NVIC_EnableIRQ(SysTicK_IRQn);
+}
+
+void SysTick_Handler(void) __attribute__((interrupt));
+void SysTick_Handler(void)
+{
+	SysTick->CMP += DELAY_MS_TIME;
+	SysTick->SR = 0;
+	sched_ticks++;
+}
+#endif
+
+#endif
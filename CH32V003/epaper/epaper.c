@@ -6,312 +6,52 @@
 
 #define SSD1306_128X64
 
+// EPD_HOST: built on a PC by epdhost.c
+#ifndef EPD_HOST
 #include "ch32v003fun.h"
+#endif
 //#include "ch32v003_GPIO_branchless.h"
 
 #include <stdio.h>
 #include <string.h>
+#include "sched.h"
 
-#include "font_8x8.h"
+#include "font_8x8_sub.h"
 
 #define FALSE 0
 #define TRUE  1
 
-// Display connections
-#define EPAPER_RST_PORT GPIOC
-#define EPAPER_RST_PIN 2
-#define EPAPER_RST_HIGH() EPAPER_RST_PORT->BSHR = (1<<(EPAPER_RST_PIN))
-#define EPAPER_RST_LOW() EPAPER_RST_PORT->BSHR = (1<<(16+EPAPER_RST_PIN))
-#define EPAPER_CS_PORT GPIOC
-#define EPAPER_CS_PIN 3
-#define EPAPER_CS_HIGH() EPAPER_CS_PORT->BSHR = (1<<(EPAPER_CS_PIN))
-#define EPAPER_CS_LOW() EPAPER_CS_PORT->BSHR = (1<<(16+EPAPER_CS_PIN))
-#define EPAPER_DC_PIN 4
-#define EPAPER_DC_PORT GPIOC
-#define EPAPER_DC_HIGH() EPAPER_DC_PORT->BSHR = (1<<(EPAPER_DC_PIN))
-#define EPAPER_DC_LOW() EPAPER_DC_PORT->BSHR = (1<<(16+EPAPER_DC_PIN))
-#define EPAPER_BUSY_PORT GPIOA
-#define EPAPER_BUSY_PIN 1
-#define EPAPER_BUSY() ((EPAPER_BUSY_PORT->INDR & (1 <<(EPAPER_BUSY_PIN))) != 0)
+// Events
+#define EV_EPD_READY 0x01	// BUSY went low (EXTI IRQ)
+#define EPD_ON_READY() sched_post_isr(EV_EPD_READY)
 
-// Controller Commands
-#define CMD_SWRESET			 	0x12
-#define CMD_DRV_OUT_CTRL 	 	0x01
-#define CMD_DATA_ENTRY_MODE	 	0x11
-#define CMD_SET_RAM_XADDR	 	0x44
-#define CMD_SET_RAM_YADDR	 	0x45
-#define CMD_BORDER_WAVE		 	0x3C
-#define CMD_READ_TEMPERATURE 	0x18
-#define CMD_DISP_UPD_CTL 	 	0x22
-#define CMD_ACTIVE_DISP_UPD_SEQ	0x20
-#define CMD_SET_RAM_XADDR_COUNT 0x4E
-#define CMD_SET_RAM_YADDR_COUNT 0x4F
-#define CMD_DEEP_SLEEP 			0x10
-#define CMD_WRITE_RAM 			0x24
-#define CMD_WRITE_REDRAM 		0x26
+// Comment out to send the screen polling the SPI instead of by DMA
+#define EPD_SPI_DMA
+
+// Define EPD_STATS to print the time taken to make and to send the screen
+//#define EPD_STATS
 
 // Alphanumeric Screen Size
 #define NLIN 25
 #define NCOL 25
 
-// Alphanumeric buffer
-uint8_t screen[NLIN*NCOL];
-
-// Flag to signal when display is powered off
-uint8_t hibernating = TRUE;
-
-// Initialize the pins connected to the display
-void pin_init() {
-	// Enable GPIOC, GPIOA and SPI
-	RCC->APB2PCENR |= RCC_APB2Periph_GPIOC | RCC_APB2Periph_GPIOA | RCC_APB2Periph_SPI1;
-	
-	// setup GPIO for reset, chip select, data/cmd and busy
-	EPAPER_RST_PORT->CFGLR &= ~(0xf<<(4*EPAPER_RST_PIN));
-	EPAPER_RST_PORT->CFGLR |= (GPIO_Speed_10MHz | GPIO_CNF_OUT_PP)<<(4*EPAPER_RST_PIN);
-	EPAPER_RST_HIGH();
-	EPAPER_CS_PORT->CFGLR &= ~(0xf<<(4*EPAPER_CS_PIN));
-	EPAPER_CS_PORT->CFGLR |= (GPIO_Speed_10MHz | GPIO_CNF_OUT_PP)<<(4*EPAPER_CS_PIN);
-	EPAPER_CS_HIGH();
-	EPAPER_DC_PORT->CFGLR &= ~(0xf<<(4*EPAPER_DC_PIN));
-	EPAPER_DC_PORT->CFGLR |= (GPIO_Speed_10MHz | GPIO_CNF_OUT_PP)<<(4*EPAPER_DC_PIN);
-	EPAPER_DC_LOW();
-	EPAPER_BUSY_PORT->CFGLR &= ~0xf<<(4*EPAPER_BUSY_PIN);
-	EPAPER_BUSY_PORT->CFGLR |= (GPIO_Speed_In | GPIO_CNF_IN_FLOATING)<<(4*EPAPER_BUSY_PIN);
-
-	// PC5 is SCK, 10MHz Output, alt func, p-p
-	GPIOC->CFGLR &= ~(0xf<<(4*5));
-	GPIOC->CFGLR |= (GPIO_Speed_50MHz | GPIO_CNF_OUT_PP_AF)<<(4*5);
-	
-	// PC6 is MOSI, 10MHz Output, alt func, p-p
-	GPIOC->CFGLR &= ~(0xf<<(4*6));
-	GPIOC->CFGLR |= (GPIO_Speed_50MHz | GPIO_CNF_OUT_PP_AF)<<(4*6);
-	
-	// Configure SPI 
-	SPI1->CTLR1 = 
-		SPI_NSS_Soft | SPI_CPHA_2Edge | SPI_CPOL_High | SPI_DataSize_8b |
-		SPI_Mode_Master | SPI_Direction_1Line_Tx | SPI_FirstBit_MSB |
-		SPI_BaudRatePrescaler_16;
-
-	// enable SPI port
-	SPI1->CTLR1 |= CTLR1_SPE_Set;
-}
-
-// Wait display controller not busy
-uint8_t epd_wait_busy()
-{
-  uint32_t timeout = 0;
-  while (EPAPER_BUSY()) {
-    timeout++;
-    if (timeout > 40000) {
-      return TRUE;
-    }
-    Delay_Ms(1);
-  }
-  return FALSE;
-}
-
-void epd_write_cmd(uint8_t cmd)
-{
-	EPAPER_DC_LOW();
-	EPAPER_CS_LOW();
-
-	while(!(SPI1->STATR & SPI_STATR_TXE))
-		;
-	SPI1->DATAR = cmd;
-	while(SPI1->STATR & SPI_STATR_BSY)
-		;
-
-	EPAPER_DC_HIGH();
-	EPAPER_CS_HIGH();
-}
-
-void epd_write_data(uint8_t data)
-{
-	EPAPER_CS_LOW();
-
-	while(!(SPI1->STATR & SPI_STATR_TXE))
-		;
-	SPI1->DATAR = data;
-	while(SPI1->STATR & SPI_STATR_BSY)
-		;
-
-	EPAPER_CS_HIGH();
-}
-
-
-// Reset the display
-void epd_reset() {
-	EPAPER_RST_LOW();
-	Delay_Ms(50);
-	EPAPER_RST_HIGH();
-	Delay_Ms(50);
-	hibernating = FALSE;
-}
-
-uint8_t epd_power_on() {
-	epd_write_cmd(CMD_DISP_UPD_CTL);
-	epd_write_data(0xf8);
-	epd_write_cmd(CMD_ACTIVE_DISP_UPD_SEQ);
-
-	return epd_wait_busy();
-}
-
-uint8_t epd_power_off(void)
-{
-	epd_write_cmd(CMD_DISP_UPD_CTL);
-	epd_write_data(0x83);
-	epd_write_cmd(CMD_ACTIVE_DISP_UPD_SEQ);
-	if (epd_wait_busy()) {
-		return TRUE;
-	}
-
-	epd_write_cmd(CMD_DEEP_SLEEP);
-	epd_write_data(0x01);
-	hibernating = 1;
-	return FALSE;
-}
-
-
-void epd_setpos(uint16_t x, uint16_t y)
-{
-	uint8_t _x;
-	uint16_t _y;
-
-	_x = x / 8;
-	_y = 199 - y;
-
-	epd_write_cmd(CMD_SET_RAM_XADDR_COUNT);
-	epd_write_data(_x);
-
-	epd_write_cmd(CMD_SET_RAM_YADDR_COUNT);
-	epd_write_data(_y & 0xff);
-	epd_write_data((_y >> 8) & 0x01);
-}
-
-// Init display
-// (values from WeAct Studio example)
-uint8_t epd_init() {
-	if (hibernating) {
-		epd_reset();
-	}
-	if (epd_wait_busy()) {
-		return TRUE;
-	}
-
-	epd_write_cmd(CMD_SWRESET);
-	Delay_Ms(10);
-	if (epd_wait_busy()) {
-		return TRUE;
-	}
-
-	epd_write_cmd(CMD_DRV_OUT_CTRL);
-	epd_write_data(0xC7);
-	epd_write_data(0x00);
-	epd_write_data(0x01);
-
-	epd_write_cmd(CMD_DATA_ENTRY_MODE);
-	epd_write_data(0x01);
-
-	epd_write_cmd(CMD_SET_RAM_XADDR);
-	epd_write_data(0x00);
-	epd_write_data(0x18);
-
-	epd_write_cmd(CMD_SET_RAM_YADDR);
-	epd_write_data(0xC7);
-	epd_write_data(0x00);
-	epd_write_data(0x00);
-	epd_write_data(0x00);
+// A region of 25 lines x 25 characters in the 8x8 font
+#define EPD_LAYOUT(R) R(font8, NLIN, NCOL)
+#include "epd_text.h"
+EPD_FONT_BYTES_INV(font8, fontdata, FONTDATA_GLYPH, 8)
 
-	epd_write_cmd(CMD_BORDER_WAVE);
-	epd_write_data(0x05);
+// Time the update started
+uint32_t epd_update_start;
 
-	epd_write_cmd(CMD_READ_TEMPERATURE);
-	epd_write_data(0x80);
-
-	epd_setpos(0,0);
-
-	return epd_power_on();
-}
-
-// Clear alphanumeric screen
-void epd_clear () {
-	memset (screen, 0x20, NLIN*NCOL);	
-}
-
-// Write text in the alphanumeric screen
-void epd_write (uint8_t l, uint8_t c, uint8_t *text) {
-	memcpy (screen+(l*NCOL)+c, text, strlen((char *) text));
-}
-
-// Draw a box
-// using semigraphics in chars 0 to 3
-void epd_box (uint8_t l, uint8_t c, uint8_t nl, uint8_t nc) {
-	uint8_t *p = screen+(l*NCOL)+c;
-	for (int i = 0; i < nc; i++) {
-		*p++ = 0x00;
-	}
-	for (int i = 0; i < (nl-2); i++) {
-		p += NCOL-nc;
-		*p = 0x02;
-		p += nc-1;
-		*p++ = 0x03;
-	}
-	p += NCOL-nc;
-	for (int i = 0; i < nc; i++) {
-		*p++ = 0x01;
-	}
-}
-
-
-// Send the graphic screen data
-void epd_send_screen () {
-	EPAPER_CS_LOW();
-	for (int l = 0; l < NLIN; l++) {
-		for (int lg = 0; lg < 8; lg++) {
-			uint8_t *ps = screen + l*NCOL;
-			for (int c = 0; c < NCOL; c++) {
-				const uint8_t *p = &fontdata[(*ps++ << 3)+lg];
-				while(!(SPI1->STATR & SPI_STATR_TXE))
-					;
-				SPI1->DATAR = ~(*p++);
-			}
-		}
-	}
-	while(SPI1->STATR & SPI_STATR_BSY)
-		;
-	EPAPER_CS_HIGH();
-}
-
-// Update image on the display
-void epd_refresh() {
-	// Turnon if necessary
-	if (hibernating) {
-		epd_init();
-	}
-
-	// Fill RED RAM
-	epd_setpos(0, 0);
-	epd_write_cmd(CMD_WRITE_REDRAM);
-	epd_send_screen();
-
-	// Fill BW RAM
-	epd_setpos(0, 0);
-	epd_write_cmd(CMD_WRITE_RAM);
-	epd_send_screen();
-
-	// Update the display
-	epd_write_cmd(CMD_DISP_UPD_CTL);
-	epd_write_data(0xF4);
-	epd_write_cmd(CMD_ACTIVE_DISP_UPD_SEQ);
-
-	epd_wait_busy();
-}
+// Box with the single line characters of the font
+// UpLeft Horiz UpRight Left Right DnLeft Horiz DnRight
+const uint8_t box_line[] = { 0xDA, 0xC4, 0xBF, 0xB3, 0xB3, 0xC0, 0xC4, 0xD9 };
 
 // Demo screen 1
 void screen1 () {
 		// Write alpha screen
 		epd_clear();
-		epd_box(0, 0, NLIN, NCOL);
+		epd_box(0, 0, NLIN, NCOL, box_line);
 		epd_write(2, 1, (uint8_t *) "DQSoft 2024");
 		epd_write(6, 1, (uint8_t *) "ABCDEFGHIJKLMNOPQRSTUVW");
 		epd_write(7, 1, (uint8_t *) "XYZ0123456789[](){}/?;:");
@@ -323,9 +63,6 @@ void screen1 () {
 
 		// Update epaper
 		epd_refresh();
-
-		// Wait time between updates
-		Delay_Ms(3*60000);
 }
 
 // Demo screen 2
@@ -343,9 +80,6 @@ void screen2 () {
 
 		// Update epaper
 		epd_refresh();
-
-		// Wait time between updates
-		Delay_Ms(3*60000);
 }
 
 // Demo screen 3
@@ -375,31 +109,65 @@ void screen3 () {
 
 		// Update epaper
 		epd_refresh();
+}
+
+// Demo screens, shown in turn
+void (*const screens[])(void) = { screen3, screen1, screen2 };
+uint8_t next_screen = 0;
+uint8_t t_ready;
+
+// Show the next screen
+void task_screen(void) {
+	if (epd_updating) {
+		return;
+	}
+	screens[next_screen]();
+	if (epd_updating) {
+		epd_update_start = sched_now();
+	}
+	next_screen = (next_screen + 1) % (sizeof(screens)/sizeof(screens[0]));
+	// the end of the update, or the timeout
+	sched_after(t_ready, 40000);
+}
 
-		// Wait time between updates
-		Delay_Ms(3*60000);
+// End of the update: BUSY went low, or the timeout
+void task_epd_ready(void) {
+	if (!epd_updating || (sched_fired && EPAPER_BUSY())) {
+		return;
+	}
+	sched_cancel(t_ready);
+	if (EPAPER_BUSY()) {
+		printf("Update timeout\n\r");
+		epd_updating = FALSE;
+	} else {
+		printf("%s update took %lu ms\n\r", epd_full ? "Full" : "Partial",
+			(unsigned long)(sched_now() - epd_update_start));
+#ifdef EPD_STATS
+		if (epd_full) {
+			printf("Screen made in %lu us, sent in %lu us\n\r",
+				(unsigned long)(epd_stat_make / DELAY_US_TIME),
+				(unsigned long)(epd_stat_send / DELAY_US_TIME));
+		}
+#endif
+		epd_refresh_done();
+	}
 }
 
 int main() {
 	// 48MHz external clock
 	SystemInit();
+	sched_init();
 
 	Delay_Ms( 100 );
 	printf("\r\n\nEpaper example\n\r");
 
 	// init spi and display
-	pin_init();
-
-	while (TRUE) {
-		screen3();
-		screen1();
-		screen2();
-	}
-
-	// Stop
-	printf("End of demo\n\r");
-	while(1)
-		;
-
-
+	epd_pin_init();
+
+	// A new screen every 3 minutes; the core sleeps in between
+	sched_every(sched_task(task_screen, 0), 3*60000);
+	t_ready = sched_task(task_epd_ready, EV_EPD_READY);
+	task_screen();
+	sched_run();
+	return 0;
 }
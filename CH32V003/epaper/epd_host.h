@@ -0,0 +1,399 @@
+/*
+ * Single-File-Header with a model of the SSD1681 e-paper controller, to
+ * run epd_text.h on a PC (EPD_HOST)
+ *
+ * The bytes sent by the driver are interpreted as SSD1681 commands and
+ * data: the RAM window, the address counters and the data entry mode put
+ * the bytes in the BW and RED RAMs, and DISP_UPD_CTL + ACTIVE_DISP_UPD_SEQ
+ * start an update that keeps BUSY high for the time of the waveform. At
+ * the end of a full update (display mode 1) the panel shows the BW RAM; a
+ * partial one (display mode 2) only drives the pixels where the BW RAM is
+ * different from the RED RAM, so if the RED RAM is not kept equal to the
+ * image on the panel old pixels stay, as on the real one.
+ *
+ * The time is simulated: the bytes on the SPI at EPD_HOST_SPI_HZ and the
+ * BUSY times below. Commands or data sent while BUSY is high or in deep
+ * sleep, and unknown commands, are counted as errors. The panel can be
+ * saved as a PBM image, or compared with one saved before.
+ */
+
+#ifndef _EPD_HOST_H
+#define _EPD_HOST_H
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+
+// size of the controller memory
+#define EPD_HOST_W 200
+#define EPD_HOST_H 200
+#define EPD_HOST_BYTES (EPD_HOST_W/8)
+
+// SPI clock, 48MHz / 4 as EPAPER_SPI_PRESCALER
+#ifndef EPD_HOST_SPI_HZ
+#define EPD_HOST_SPI_HZ 12000000
+#endif
+#define EPD_HOST_BYTE_NS (8000000000ull/EPD_HOST_SPI_HZ)
+
+// BUSY times, in ms (typical for the 1.54 inch panel at 25 C)
+#ifndef EPD_HOST_FULL_MS
+#define EPD_HOST_FULL_MS 2000
+#endif
+#ifndef EPD_HOST_PARTIAL_MS
+#define EPD_HOST_PARTIAL_MS 300
+#endif
+#define EPD_HOST_POWER_ON_MS 80
+#define EPD_HOST_POWER_OFF_MS 20
+#define EPD_HOST_SWRESET_MS 2
+
+// controller state
+typedef struct {
+	uint8_t bw[EPD_HOST_H][EPD_HOST_BYTES];
+	uint8_t red[EPD_HOST_H][EPD_HOST_BYTES];
+	uint8_t panel[EPD_HOST_H][EPD_HOST_BYTES];	// rows from the top, 1 = white
+	uint8_t cmd;				// command receiving data
+	uint8_t args[4];
+	uint8_t nargs, need;
+	uint8_t entry;				// data entry mode
+	uint8_t x0, x1, x;			// window and counter, in bytes
+	uint16_t y0, y1, y;			// in rows
+	uint16_t mux;				// gate lines - 1
+	uint8_t gate;				// scan direction (bit 0 = TB)
+	uint8_t upd_ctl;			// sequence of DISP_UPD_CTL
+	uint8_t sleeping;
+	uint8_t busy;
+	uint8_t display;			// update running: 1 full, 2 partial
+	uint64_t busy_end;
+	uint64_t time_ns;			// simulated time
+	uint64_t busy_ns;			// time with BUSY high
+	uint32_t bytes;				// bytes on the SPI
+	uint32_t ram_bytes;			// bytes written to the RAMs
+	uint32_t full, partial;		// updates shown
+	uint32_t errors;
+} epd_host_t;
+
+epd_host_t epd_host;
+
+/*
+ * number of data bytes for each command, 0xFF if unknown
+ */
+uint8_t epd_host_nargs(uint8_t cmd)
+{
+	switch(cmd)
+	{
+		case 0x12: case 0x20: case 0x24: case 0x26:
+			return 0;
+		case 0x10: case 0x11: case 0x18: case 0x22: case 0x3C: case 0x4E:
+			return 1;
+		case 0x44: case 0x4F:
+			return 2;
+		case 0x01:
+			return 3;
+		case 0x45:
+			return 4;
+	}
+	return 0xFF;
+}
+
+/*
+ * registers as after a reset
+ */
+void epd_host_defaults(void)
+{
+	epd_host.entry = 0x03;
+	epd_host.x0 = epd_host.x = 0;
+	epd_host.x1 = EPD_HOST_BYTES-1;
+	epd_host.y0 = epd_host.y = 0;
+	epd_host.y1 = EPD_HOST_H-1;
+	epd_host.mux = EPD_HOST_H-1;
+	epd_host.gate = 0;
+	epd_host.upd_ctl = 0xFF;
+	epd_host.cmd = 0;
+	epd_host.nargs = epd_host.need = 0;
+}
+
+/*
+ * power on: the RAMs have random content, filled with a pattern; the
+ * panel is white
+ */
+void epd_host_init(void)
+{
+	memset(&epd_host, 0, sizeof(epd_host));
+	for(int y=0;y<EPD_HOST_H;y++)
+	{
+		memset(epd_host.bw[y], 0x55 << (y&1), EPD_HOST_BYTES);
+		memset(epd_host.red[y], 0xAA >> (y&1), EPD_HOST_BYTES);
+	}
+	memset(epd_host.panel, 0xFF, sizeof(epd_host.panel));
+	epd_host_defaults();
+}
+
+/*
+ * reset pin: leaves deep sleep, the RAMs are kept
+ */
+void epd_host_reset(void)
+{
+	epd_host_defaults();
+	epd_host.sleeping = 0;
+	epd_host.busy = 0;
+	epd_host.display = 0;
+}
+
+/*
+ * BUSY goes high for ms
+ */
+void epd_host_busy(uint32_t ms)
+{
+	epd_host.busy = 1;
+	epd_host.busy_end = epd_host.time_ns + ms*1000000ull;
+	epd_host.busy_ns += ms*1000000ull;
+}
+
+/*
+ * the panel shows the RAMs: a full update shows the BW RAM, a partial one
+ * changes the pixels where the BW and RED RAMs are different
+ */
+void epd_host_show(void)
+{
+	for(int r=0;r<EPD_HOST_H;r++)
+	{
+		int y = (epd_host.gate & 1) ? epd_host.mux - r : r;
+		if((y < 0) || (y >= EPD_HOST_H))
+			continue;
+		for(int x=0;x<EPD_HOST_BYTES;x++)
+		{
+			uint8_t bw = epd_host.bw[y][x];
+			uint8_t drive = (epd_host.display == 1) ? 0xFF : bw ^ epd_host.red[y][x];
+			epd_host.panel[r][x] = (epd_host.panel[r][x] & ~drive) | (bw & drive);
+		}
+	}
+	if(epd_host.display == 1)
+		epd_host.full++;
+	else
+		epd_host.partial++;
+}
+
+/*
+ * run the sequence of DISP_UPD_CTL: an update with display mode 1 or 2,
+ * or only the power on (analog on) or off
+ */
+void epd_host_activate(void)
+{
+	uint8_t ctl = epd_host.upd_ctl;
+
+	if(ctl & 0x04)
+	{
+		epd_host.display = (ctl & 0x08) ? 2 : 1;
+		epd_host_busy(epd_host.display == 1 ? EPD_HOST_FULL_MS : EPD_HOST_PARTIAL_MS);
+	}
+	else if(ctl & 0x40)
+		epd_host_busy(EPD_HOST_POWER_ON_MS);
+	else
+		epd_host_busy(EPD_HOST_POWER_OFF_MS);
+}
+
+/*
+ * execute a command with all its data
+ */
+void epd_host_exec(uint8_t cmd, uint8_t *a)
+{
+	switch(cmd)
+	{
+		case 0x01:
+			epd_host.mux = (a[0] | (a[1] << 8)) & 0x1FF;
+			epd_host.gate = a[2];
+			break;
+		case 0x10:
+			if(a[0] & 0x03)
+				epd_host.sleeping = 1;
+			break;
+		case 0x11:
+			epd_host.entry = a[0] & 0x07;
+			break;
+		case 0x12:
+			epd_host_defaults();
+			epd_host_busy(EPD_HOST_SWRESET_MS);
+			break;
+		case 0x20:
+			epd_host_activate();
+			break;
+		case 0x22:
+			epd_host.upd_ctl = a[0];
+			break;
+		case 0x44:
+			epd_host.x0 = a[0] & 0x3F;
+			epd_host.x1 = a[1] & 0x3F;
+			break;
+		case 0x45:
+			epd_host.y0 = (a[0] | (a[1] << 8)) & 0x1FF;
+			epd_host.y1 = (a[2] | (a[3] << 8)) & 0x1FF;
+			break;
+		case 0x4E:
+			epd_host.x = a[0] & 0x3F;
+			break;
+		case 0x4F:
+			epd_host.y = (a[0] | (a[1] << 8)) & 0x1FF;
+			break;
+	}
+}
+
+/*
+ * write a byte in a RAM at the counters and move them: in the direction
+ * of the data entry mode, at the end of the window the counter goes back
+ * to its start and the other one moves
+ */
+void epd_host_write(uint8_t ram[EPD_HOST_H][EPD_HOST_BYTES], uint8_t d)
+{
+	int dx = (epd_host.entry & 1) ? 1 : -1;
+	int dy = (epd_host.entry & 2) ? 1 : -1;
+
+	if((epd_host.x < EPD_HOST_BYTES) && (epd_host.y < EPD_HOST_H))
+		ram[epd_host.y][epd_host.x] = d;
+	epd_host.ram_bytes++;
+
+	if(epd_host.entry & 4)
+	{
+		// Y first
+		if(epd_host.y == epd_host.y1)
+		{
+			epd_host.y = epd_host.y0;
+			epd_host.x = (epd_host.x == epd_host.x1) ? epd_host.x0 : epd_host.x + dx;
+		}
+		else
+			epd_host.y += dy;
+	}
+	else
+	{
+		// X first
+		if(epd_host.x == epd_host.x1)
+		{
+			epd_host.x = epd_host.x0;
+			epd_host.y = (epd_host.y == epd_host.y1) ? epd_host.y0 : epd_host.y + dy;
+		}
+		else
+			epd_host.x += dx;
+	}
+}
+
+/*
+ * a command byte (D/C low)
+ */
+void epd_host_cmd(uint8_t cmd)
+{
+	epd_host.bytes++;
+	epd_host.time_ns += EPD_HOST_BYTE_NS;
+	if(epd_host.busy || epd_host.sleeping)
+	{
+		epd_host.errors++;
+		return;
+	}
+	epd_host.cmd = cmd;
+	epd_host.nargs = 0;
+	epd_host.need = epd_host_nargs(cmd);
+	if(epd_host.need == 0xFF)
+		epd_host.errors++;
+	else if(epd_host.need == 0)
+		epd_host_exec(cmd, epd_host.args);
+}
+
+/*
+ * a data byte (D/C high)
+ */
+void epd_host_data(uint8_t d)
+{
+	epd_host.bytes++;
+	epd_host.time_ns += EPD_HOST_BYTE_NS;
+	if(epd_host.busy || epd_host.sleeping)
+	{
+		epd_host.errors++;
+		return;
+	}
+	if(epd_host.cmd == 0x24)
+		epd_host_write(epd_host.bw, d);
+	else if(epd_host.cmd == 0x26)
+		epd_host_write(epd_host.red, d);
+	else if(epd_host.nargs < epd_host.need)
+	{
+		epd_host.args[epd_host.nargs++] = d;
+		if(epd_host.nargs == epd_host.need)
+			epd_host_exec(epd_host.cmd, epd_host.args);
+	}
+	else
+		epd_host.errors++;
+}
+
+/*
+ * let time go by; returns 1 if BUSY went low
+ */
+uint8_t epd_host_run(uint64_t ns)
+{
+	uint64_t end = epd_host.time_ns + ns;
+
+	epd_host.time_ns = end;
+	if(!epd_host.busy || (epd_host.busy_end > end))
+		return 0;
+	epd_host.busy = 0;
+	if(epd_host.display)
+	{
+		epd_host_show();
+		epd_host.display = 0;
+	}
+	return 1;
+}
+
+/*
+ * a pixel of the panel, 1 = white
+ */
+uint8_t epd_host_pixel(uint8_t x, uint8_t y)
+{
+	return (epd_host.panel[y][x >> 3] >> (7 - (x & 7))) & 1;
+}
+
+/*
+ * save the panel as a binary PBM (1 = black)
+ */
+int epd_host_save_pbm(const char *fname)
+{
+	FILE *f = fopen(fname, "wb");
+	if(!f)
+		return 1;
+	fprintf(f, "P4\n%d %d\n", EPD_HOST_W, EPD_HOST_H);
+	for(int y=0;y<EPD_HOST_H;y++)
+		for(int x=0;x<EPD_HOST_BYTES;x++)
+			fputc(~epd_host.panel[y][x] & 0xFF, f);
+	fclose(f);
+	return 0;
+}
+
+/*
+ * compare the panel with a PBM saved before
+ * returns the number of different pixels, -1 if the file can't be used
+ */
+int epd_host_compare_pbm(const char *fname)
+{
+	int w, h, diff = 0;
+	FILE *f = fopen(fname, "rb");
+	if(!f)
+		return -1;
+	if((fscanf(f, "P4 %d %d", &w, &h) != 2) ||
+	   (w != EPD_HOST_W) || (h != EPD_HOST_H) || (fgetc(f) == EOF))
+	{
+		fclose(f);
+		return -1;
+	}
+	for(int y=0;y<EPD_HOST_H;y++)
+		for(int x=0;x<EPD_HOST_BYTES;x++)
+		{
+			int c = fgetc(f);
+			if(c == EOF)
+			{
+				fclose(f);
+				return -1;
+			}
+			diff += __builtin_popcount((c ^ ~epd_host.panel[y][x]) & 0xFF);
+		}
+	fclose(f);
+	return diff;
+}
+
+#endif
@@ -0,0 +1,822 @@
+/*
+ * Single-File-Header for text on the WeAct Studio 1.54 inch e-paper
+ * (SSD1681 controller, 200x200), used by epaper and epaper12
+ *
+ * The screen is a buffer of characters, in one or more regions stacked
+ * from the top, each with its own font and number of lines and columns.
+ * The application defines the layout before including this file, as a
+ * list of regions (font, lines, columns), and then the fonts:
+ *
+ *   #define EPD_LAYOUT(R) \
+ *       R(font12, 2, 16) \
+ *       R(font8, 21, 25)
+ *   #include "epd_text.h"
+ *   EPD_FONT_PACKED12(font12, console_font_12x16, CONSOLE_FONT_12X16_GLYPH, 16)
+ *   EPD_FONT_BYTES_INV(font8, fontdata, FONTDATA_GLYPH, 8)
+ *
+ * Lines are numbered from the top across the regions (here 0 and 1 in
+ * 12x16, 2 to 22 in 8x8). The size of the buffers is known at compile
+ * time, and the code that makes the scanlines is chosen by the packing of
+ * each font: fonts 8 pixels wide have a byte per row (EPD_FONT_BYTES, or
+ * EPD_FONT_BYTES_INV when the font has 1 for ink) and fonts 12 pixels wide
+ * have the rows packed in 12 bits (EPD_FONT_PACKED12, from fontc.py with
+ * --layout packed --inverted), 2 characters in 3 bytes.
+ *
+ * Scanlines are made in one of two buffers while the other is sent, by
+ * DMA if EPD_SPI_DMA is defined. Each refresh sends only the lines written
+ * since the last one (epd_dirty) that are different from what was sent
+ * (the shadow copy), with the partial update waveform; see README.md.
+ *
+ * Define EPD_ON_READY() to do something in the IRQ when BUSY goes low
+ * (post an event), EPD_STATS to measure the time of the screen upload and
+ * EPD_HOST to leave out the hardware: the program then provides
+ * epd_hw_reset, epd_hw_busy, epd_wait_busy, epd_write_cmd,
+ * epd_write_data, epd_send_begin, epd_send_line, epd_send_end and
+ * Delay_Ms (epdhost.c does it with the controller model of epd_host.h).
+ */
+
+#ifndef _EPD_TEXT_H
+#define _EPD_TEXT_H
+
+#include <stdint.h>
+#include <string.h>
+
+// Panel size, in pixels
+#ifndef EPD_WIDTH
+#define EPD_WIDTH 200
+#endif
+#ifndef EPD_HEIGHT
+#define EPD_HEIGHT 200
+#endif
+#define EPD_BYTES (EPD_WIDTH/8)
+
+// A full refresh after this many partial ones, to clear the ghosting
+#ifndef EPD_FULL_EVERY
+#define EPD_FULL_EVERY 10
+#endif
+
+// Display connections
+#ifndef EPD_HOST
+#ifndef EPAPER_CS_PORT
+#define EPAPER_RST_PORT GPIOC
+#define EPAPER_RST_PIN 2
+#define EPAPER_CS_PORT GPIOC
+#define EPAPER_CS_PIN 3
+#define EPAPER_DC_PORT GPIOC
+#define EPAPER_DC_PIN 4
+#define EPAPER_BUSY_PORT GPIOA
+#define EPAPER_BUSY_PIN 1
+#define EPAPER_BUSY_EXTI_PORT 0	// port A for AFIO->EXTICR
+#endif
+#define EPAPER_RST_HIGH() EPAPER_RST_PORT->BSHR = (1<<(EPAPER_RST_PIN))
+#define EPAPER_RST_LOW() EPAPER_RST_PORT->BSHR = (1<<(16+EPAPER_RST_PIN))
+#define EPAPER_CS_HIGH() EPAPER_CS_PORT->BSHR = (1<<(EPAPER_CS_PIN))
+#define EPAPER_CS_LOW() EPAPER_CS_PORT->BSHR = (1<<(16+EPAPER_CS_PIN))
+#define EPAPER_DC_HIGH() EPAPER_DC_PORT->BSHR = (1<<(EPAPER_DC_PIN))
+#define EPAPER_DC_LOW() EPAPER_DC_PORT->BSHR = (1<<(16+EPAPER_DC_PIN))
+#define EPAPER_BUSY() ((EPAPER_BUSY_PORT->INDR & (1 <<(EPAPER_BUSY_PIN))) != 0)
+#else
+#define EPAPER_BUSY() epd_hw_busy()
+#endif
+
+// SPI clock, 48MHz / 4 = 12MHz (the controller takes up to 20MHz)
+#ifndef EPAPER_SPI_PRESCALER
+#define EPAPER_SPI_PRESCALER SPI_BaudRatePrescaler_4
+#endif
+
+#ifndef EPD_ON_READY
+#define EPD_ON_READY()
+#endif
+
+// Controller Commands
+#define CMD_SWRESET			 	0x12
+#define CMD_DRV_OUT_CTRL 	 	0x01
+#define CMD_DATA_ENTRY_MODE	 	0x11
+#define CMD_SET_RAM_XADDR	 	0x44
+#define CMD_SET_RAM_YADDR	 	0x45
+#define CMD_BORDER_WAVE		 	0x3C
+#define CMD_READ_TEMPERATURE 	0x18
+#define CMD_DISP_UPD_CTL 	 	0x22
+#define CMD_ACTIVE_DISP_UPD_SEQ	0x20
+#define CMD_SET_RAM_XADDR_COUNT 0x4E
+#define CMD_SET_RAM_YADDR_COUNT 0x4F
+#define CMD_DEEP_SLEEP 			0x10
+#define CMD_WRITE_RAM 			0x24
+#define CMD_WRITE_REDRAM 		0x26
+
+// A font: a unit of chars characters is bytes bytes of a scanline
+typedef struct {
+	uint8_t w, h;
+	uint8_t chars, bytes;
+} epd_font_t;
+
+// Row lg of glyphs a byte wide
+static inline uint8_t *epd_row_bytes (uint8_t *out, const uint8_t **g, uint8_t n, uint8_t lg) {
+	while (n--) {
+		*out++ = (*g++)[lg];
+	}
+	return out;
+}
+
+// Row lg of glyphs a byte wide, inverted (the font has 1 for ink, the
+// display 0 for black)
+static inline uint8_t *epd_row_bytes_inv (uint8_t *out, const uint8_t **g, uint8_t n, uint8_t lg) {
+	while (n--) {
+		*out++ = ~(*g++)[lg];
+	}
+	return out;
+}
+
+// Row lg of pairs of glyphs 12 pixels wide, 3 bytes per pair; the rows
+// are packed in 12 bits, so only nibbles move
+static inline uint8_t *epd_row_packed12 (uint8_t *out, const uint8_t **g, uint8_t npairs, uint8_t lg) {
+	uint8_t ofs = lg + (lg >> 1);
+	const uint8_t *a, *b;
+
+	if (lg & 1) {
+		// aaaa AAAAAAAA: low nibble of the first byte and the second
+		while (npairs--) {
+			a = *g++ + ofs;
+			b = *g++ + ofs;
+			*out++ = (a[0] << 4) | (a[1] >> 4);
+			*out++ = (a[1] << 4) | (b[0] & 0x0F);
+			*out++ = b[1];
+		}
+	} else {
+		// AAAAAAAA aaaa: the first byte and the high nibble of the second
+		while (npairs--) {
+			a = *g++ + ofs;
+			b = *g++ + ofs;
+			*out++ = a[0];
+			*out++ = (a[1] & 0xF0) | (b[0] >> 4);
+			*out++ = (b[0] << 4) | (b[1] >> 4);
+		}
+	}
+	return out;
+}
+
+// Define a font: name, font data, its glyph macro and height; each font
+// gets its own loop that makes and sends nl lines of units from ps, with
+// its glyph lookup and row function inlined (epd_send_lines calls it)
+#define EPD_FONT_GLYPH(name, font, glyph, size) \
+static inline const uint8_t *name##_glyph (uint8_t c) { \
+	return &font[glyph(c)*(size)]; \
+}
+#define EPD_FONT_SEND(name, row, h, chars) \
+static inline void name##_send_lines (const uint8_t *ps, uint8_t cols, uint8_t nl, uint8_t units, uint8_t pad) { \
+	const uint8_t *g[EPD_BYTES]; \
+	for (; nl; nl--, ps += cols) { \
+		for (int c = 0; c < units * (chars); c++) { \
+			g[c] = name##_glyph(ps[c]); \
+		} \
+		for (int lg = 0; lg < (h); lg++) { \
+			uint8_t *line = epd_row_begin(); \
+			epd_row_end(line, row(line, g, units, lg), pad); \
+		} \
+	} \
+}
+#define EPD_FONT_BYTES(name, font, glyph, h) \
+EPD_FONT_GLYPH(name, font, glyph, h) \
+EPD_FONT_SEND(name, epd_row_bytes, h, 1) \
+const epd_font_t name = { 8, h, 1, 1 };
+#define EPD_FONT_BYTES_INV(name, font, glyph, h) \
+EPD_FONT_GLYPH(name, font, glyph, h) \
+EPD_FONT_SEND(name, epd_row_bytes_inv, h, 1) \
+const epd_font_t name = { 8, h, 1, 1 };
+#define EPD_FONT_PACKED12(name, font, glyph, h) \
+EPD_FONT_GLYPH(name, font, glyph, (h)*3/2) \
+EPD_FONT_SEND(name, epd_row_packed12, h, 2) \
+const epd_font_t name = { 12, h, 2, 3 };
+
+// The regions of the layout
+typedef struct {
+	const epd_font_t *font;
+	uint8_t lines, cols;
+} epd_region_t;
+
+#define EPD_REGION_FONT(f, l, c) extern const epd_font_t f; \
+	static inline void f##_send_lines (const uint8_t *ps, uint8_t cols, uint8_t nl, uint8_t units, uint8_t pad);
+#define EPD_REGION_SEND(f, l, c) \
+	if (r->font == &f) { \
+		f##_send_lines(ps, r->cols, l1 - l0 + 1, units, pad); \
+		return; \
+	}
+#define EPD_REGION_ENTRY(f, l, c) { &f, l, c },
+#define EPD_REGION_LINES(f, l, c) + (l)
+#define EPD_REGION_CHARS(f, l, c) + (l)*(c)
+
+EPD_LAYOUT(EPD_REGION_FONT)
+const epd_region_t epd_regions[] = { EPD_LAYOUT(EPD_REGION_ENTRY) };
+#define EPD_REGIONS ((int)(sizeof(epd_regions)/sizeof(epd_regions[0])))
+#define EPD_LINES (0 EPD_LAYOUT(EPD_REGION_LINES))
+#define EPD_CHARS (0 EPD_LAYOUT(EPD_REGION_CHARS))
+
+// Alphanumeric buffer
+uint8_t screen[EPD_CHARS];
+
+// Flag to signal when display is powered off
+uint8_t hibernating = 1;
+
+// Flag to signal an update is going on
+volatile uint8_t epd_updating = 0;
+
+// Characters in the display RAMs, to find what changed
+uint8_t shadow[EPD_CHARS];
+uint8_t shadow_valid = 0;
+uint8_t epd_partials = 0;
+uint8_t epd_full;
+
+// Lines of the screen written since the last refresh, a bit per line;
+// only these are compared with the shadow (set the bits when writing
+// directly in screen[])
+uint32_t epd_dirty = 0;
+#define EPD_DIRTY(l) (1UL << (l))
+#if EPD_LINES > 32
+#error "epd_dirty has a bit per line: 32 lines at most"
+#endif
+
+// Changed areas: lines, characters and the region
+typedef struct {
+	uint8_t l0, l1, c0, c1, region;
+} epd_rect_t;
+epd_rect_t epd_rects[EPD_LINES];
+uint8_t epd_nrects = 0;
+
+// Two scanline buffers: a line is made in one while the other is sent
+uint8_t epd_lines[2][EPD_BYTES];
+uint8_t epd_line_buf = 0;	// the one for the next line
+
+// Define EPD_STATS to measure the time taken to make and to send the screen
+#ifdef EPD_STATS
+#ifndef EPD_TICKS
+#define EPD_TICKS() (SysTick->CNT)
+#endif
+uint32_t epd_stat_make, epd_stat_send, epd_stat_t;
+#endif
+
+// Line l: its region, returns the offset in screen[] and the first pixel row
+uint16_t epd_find_line (uint8_t l, const epd_region_t **pr, uint8_t *py) {
+	const epd_region_t *r = epd_regions;
+	uint16_t ofs = 0;
+	uint8_t y = 0;
+
+	while (l >= r->lines) {
+		l -= r->lines;
+		ofs += r->lines * r->cols;
+		y += r->lines * r->font->h;
+		r++;
+	}
+	*pr = r;
+	*py = y + l * r->font->h;
+	return ofs + l * r->cols;
+}
+
+// Characters of line l and how many
+uint8_t *epd_line (uint8_t l, uint8_t *cols) {
+	const epd_region_t *r;
+	uint8_t y;
+	uint16_t ofs = epd_find_line(l, &r, &y);
+
+	*cols = r->cols;
+	return screen + ofs;
+}
+
+#ifndef EPD_HOST
+// Initialize the pins connected to the display
+void epd_pin_init() {
+	// Enable GPIOC, GPIOA and SPI
+	RCC->APB2PCENR |= RCC_APB2Periph_GPIOC | RCC_APB2Periph_GPIOA | RCC_APB2Periph_SPI1;
+
+	// setup GPIO for reset, chip select, data/cmd and busy
+	EPAPER_RST_PORT->CFGLR &= ~(0xf<<(4*EPAPER_RST_PIN));
+	EPAPER_RST_PORT->CFGLR |= (GPIO_Speed_10MHz | GPIO_CNF_OUT_PP)<<(4*EPAPER_RST_PIN);
+	EPAPER_RST_HIGH();
+	EPAPER_CS_PORT->CFGLR &= ~(0xf<<(4*EPAPER_CS_PIN));
+	EPAPER_CS_PORT->CFGLR |= (GPIO_Speed_10MHz | GPIO_CNF_OUT_PP)<<(4*EPAPER_CS_PIN);
+	EPAPER_CS_HIGH();
+	EPAPER_DC_PORT->CFGLR &= ~(0xf<<(4*EPAPER_DC_PIN));
+	EPAPER_DC_PORT->CFGLR |= (GPIO_Speed_10MHz | GPIO_CNF_OUT_PP)<<(4*EPAPER_DC_PIN);
+	EPAPER_DC_LOW();
+	EPAPER_BUSY_PORT->CFGLR &= ~0xf<<(4*EPAPER_BUSY_PIN);
+	EPAPER_BUSY_PORT->CFGLR |= (GPIO_Speed_In | GPIO_CNF_IN_FLOATING)<<(4*EPAPER_BUSY_PIN);
+
+	// PC5 is SCK, 10MHz Output, alt func, p-p
+	GPIOC->CFGLR &= ~(0xf<<(4*5));
+	GPIOC->CFGLR |= (GPIO_Speed_50MHz | GPIO_CNF_OUT_PP_AF)<<(4*5);
+
+	// PC6 is MOSI, 10MHz Output, alt func, p-p
+	GPIOC->CFGLR &= ~(0xf<<(4*6));
+	GPIOC->CFGLR |= (GPIO_Speed_50MHz | GPIO_CNF_OUT_PP_AF)<<(4*6);
+
+	// Configure SPI
+	SPI1->CTLR1 =
+		SPI_NSS_Soft | SPI_CPHA_2Edge | SPI_CPOL_High | SPI_DataSize_8b |
+		SPI_Mode_Master | SPI_Direction_1Line_Tx | SPI_FirstBit_MSB |
+		EPAPER_SPI_PRESCALER;
+
+#ifdef EPD_SPI_DMA
+	// DMA1 channel 3 is SPI1 TX, a scanline at a time
+	RCC->AHBPCENR |= RCC_AHBPeriph_DMA1;
+	SPI1->CTLR2 |= SPI_CTLR2_TXDMAEN;
+	DMA1_Channel3->PADDR = (uint32_t)&SPI1->DATAR;
+	DMA1_Channel3->CFGR =
+		DMA_M2M_Disable |
+		DMA_Priority_VeryHigh |
+		DMA_MemoryDataSize_Byte |
+		DMA_PeripheralDataSize_Byte |
+		DMA_MemoryInc_Enable |
+		DMA_Mode_Normal |
+		DMA_DIR_PeripheralDST;
+#endif
+
+	// enable SPI port
+	SPI1->CTLR1 |= CTLR1_SPE_Set;
+
+	// IRQ when BUSY goes low
+	RCC->APB2PCENR |= RCC_APB2Periph_AFIO;
+	AFIO->EXTICR &= ~(3<<(2*EPAPER_BUSY_PIN));
+	AFIO->EXTICR |= EPAPER_BUSY_EXTI_PORT<<(2*EPAPER_BUSY_PIN);
+	EXTI->INTENR |= 1<<EPAPER_BUSY_PIN;
+	EXTI->FTENR |= 1<<EPAPER_BUSY_PIN;
+	NVIC_EnableIRQ(EXTI7_0_IRQn);
+}
+
+void EXTI7_0_IRQHandler(void) __attribute__((interrupt));
+void EXTI7_0_IRQHandler(void)
+{
+	EXTI->INTFR = 1<<EPAPER_BUSY_PIN;
+	EPD_ON_READY();
+}
+
+// Wait display controller not busy, 40s at most
+// (short waits, the core sleeps until the BUSY IRQ or another one, as the
+// SysTick of sched.h)
+uint8_t epd_wait_busy()
+{
+	uint32_t start = SysTick->CNT;
+	while (EPAPER_BUSY()) {
+		if ((SysTick->CNT - start) > 40000*DELAY_MS_TIME) {
+			return 1;
+		}
+		__WFI();
+	}
+	return 0;
+}
+
+void epd_write_cmd(uint8_t cmd)
+{
+	EPAPER_DC_LOW();
+	EPAPER_CS_LOW();
+
+	while(!(SPI1->STATR & SPI_STATR_TXE))
+		;
+	SPI1->DATAR = cmd;
+	while(SPI1->STATR & SPI_STATR_BSY)
+		;
+
+	EPAPER_DC_HIGH();
+	EPAPER_CS_HIGH();
+}
+
+void epd_write_data(uint8_t data)
+{
+	EPAPER_CS_LOW();
+
+	while(!(SPI1->STATR & SPI_STATR_TXE))
+		;
+	SPI1->DATAR = data;
+	while(SPI1->STATR & SPI_STATR_BSY)
+		;
+
+	EPAPER_CS_HIGH();
+}
+
+// Pulse the reset pin
+void epd_hw_reset() {
+	EPAPER_RST_LOW();
+	Delay_Ms(50);
+	EPAPER_RST_HIGH();
+	Delay_Ms(50);
+}
+
+#ifdef EPD_SPI_DMA
+// Wait for the end of the DMA transfer, if any
+void epd_dma_wait () {
+	if (DMA1_Channel3->CFGR & DMA_CFGR1_EN) {
+		while (!(DMA1->INTFR & DMA1_IT_TC3))
+			;
+		DMA1_Channel3->CFGR &= ~DMA_CFGR1_EN;
+		DMA1->INTFCR = DMA1_IT_GL3;
+	}
+}
+#endif
+
+// Start sending data
+void epd_send_begin () {
+	EPAPER_CS_LOW();
+}
+
+// Send a scanline: by DMA it is sent while the next one is made
+void epd_send_line (const uint8_t *p, uint8_t n) {
+#ifdef EPD_SPI_DMA
+	epd_dma_wait();
+	DMA1_Channel3->MADDR = (uint32_t)p;
+	DMA1_Channel3->CNTR = n;
+	DMA1_Channel3->CFGR |= DMA_CFGR1_EN;
+#else
+	while (n--) {
+		while(!(SPI1->STATR & SPI_STATR_TXE))
+			;
+		SPI1->DATAR = *p++;
+	}
+#endif
+}
+
+// Wait for the last byte shifted out
+void epd_send_end () {
+#ifdef EPD_SPI_DMA
+	epd_dma_wait();
+#endif
+	while(!(SPI1->STATR & SPI_STATR_TXE))
+		;
+	while(SPI1->STATR & SPI_STATR_BSY)
+		;
+	EPAPER_CS_HIGH();
+}
+#else
+void epd_hw_reset(void);
+uint8_t epd_hw_busy(void);
+uint8_t epd_wait_busy(void);
+void epd_write_cmd(uint8_t cmd);
+void epd_write_data(uint8_t data);
+void epd_send_begin(void);
+void epd_send_line(const uint8_t *p, uint8_t n);
+void epd_send_end(void);
+void Delay_Ms(uint32_t ms);
+#endif
+
+// Reset the display
+void epd_reset() {
+	epd_hw_reset();
+	hibernating = 0;
+}
+
+uint8_t epd_power_on() {
+	epd_write_cmd(CMD_DISP_UPD_CTL);
+	epd_write_data(0xf8);
+	epd_write_cmd(CMD_ACTIVE_DISP_UPD_SEQ);
+
+	return epd_wait_busy();
+}
+
+uint8_t epd_power_off(void)
+{
+	epd_write_cmd(CMD_DISP_UPD_CTL);
+	epd_write_data(0x83);
+	epd_write_cmd(CMD_ACTIVE_DISP_UPD_SEQ);
+	if (epd_wait_busy()) {
+		return 1;
+	}
+
+	epd_write_cmd(CMD_DEEP_SLEEP);
+	epd_write_data(0x01);
+	hibernating = 1;
+	return 0;
+}
+
+void epd_setpos(uint16_t x, uint16_t y)
+{
+	uint8_t _x;
+	uint16_t _y;
+
+	_x = x / 8;
+	_y = EPD_HEIGHT - 1 - y;
+
+	epd_write_cmd(CMD_SET_RAM_XADDR_COUNT);
+	epd_write_data(_x);
+
+	epd_write_cmd(CMD_SET_RAM_YADDR_COUNT);
+	epd_write_data(_y & 0xff);
+	epd_write_data((_y >> 8) & 0x01);
+}
+
+// Set the RAM window, x in bytes and y in pixel rows from the top,
+// and put the address counter at its start
+void epd_set_window(uint8_t x0, uint8_t x1, uint8_t y0, uint8_t y1)
+{
+	epd_write_cmd(CMD_SET_RAM_XADDR);
+	epd_write_data(x0);
+	epd_write_data(x1);
+
+	// RAM rows go from the last (top) down to 0
+	epd_write_cmd(CMD_SET_RAM_YADDR);
+	epd_write_data(EPD_HEIGHT - 1 - y0);
+	epd_write_data(0x00);
+	epd_write_data(EPD_HEIGHT - 1 - y1);
+	epd_write_data(0x00);
+
+	epd_setpos(x0*8, y0);
+}
+
+// Init display
+// (values from WeAct Studio example)
+uint8_t epd_init() {
+	if (hibernating) {
+		epd_reset();
+	}
+	if (epd_wait_busy()) {
+		return 1;
+	}
+
+	epd_write_cmd(CMD_SWRESET);
+	Delay_Ms(10);
+	if (epd_wait_busy()) {
+		return 1;
+	}
+
+	epd_write_cmd(CMD_DRV_OUT_CTRL);
+	epd_write_data((EPD_HEIGHT - 1) & 0xFF);
+	epd_write_data((EPD_HEIGHT - 1) >> 8);
+	epd_write_data(0x01);
+
+	epd_write_cmd(CMD_DATA_ENTRY_MODE);
+	epd_write_data(0x01);
+
+	epd_write_cmd(CMD_SET_RAM_XADDR);
+	epd_write_data(0x00);
+	epd_write_data(EPD_BYTES - 1);
+
+	epd_write_cmd(CMD_SET_RAM_YADDR);
+	epd_write_data((EPD_HEIGHT - 1) & 0xFF);
+	epd_write_data((EPD_HEIGHT - 1) >> 8);
+	epd_write_data(0x00);
+	epd_write_data(0x00);
+
+	epd_write_cmd(CMD_BORDER_WAVE);
+	epd_write_data(0x05);
+
+	epd_write_cmd(CMD_READ_TEMPERATURE);
+	epd_write_data(0x80);
+
+	epd_setpos(0,0);
+
+	return epd_power_on();
+}
+
+// Clear alphanumeric screen
+void epd_clear () {
+	for (int l = 0; l < EPD_LINES; l++) {
+		uint8_t n;
+		uint8_t *p = epd_line(l, &n);
+		for (int c = 0; c < n; c++) {
+			if (p[c] != 0x20) {
+				memset (p, 0x20, n);
+				epd_dirty |= EPD_DIRTY(l);
+				break;
+			}
+		}
+	}
+}
+
+// Write text in the alphanumeric screen
+void epd_write (uint8_t l, uint8_t c, uint8_t *text) {
+	uint8_t n;
+	uint8_t *p = epd_line(l, &n) + c;
+	size_t len = strlen((char *) text);
+	if (memcmp (p, text, len)) {
+		memcpy (p, text, len);
+		epd_dirty |= EPD_DIRTY(l);
+	}
+}
+
+// Draw a box (all its lines in the same region) with the characters of
+// style: top left, top, top right, left, right, bottom left, bottom,
+// bottom right
+void epd_box (uint8_t l, uint8_t c, uint8_t nl, uint8_t nc, const uint8_t *style) {
+	uint8_t n;
+	uint8_t *p = epd_line(l, &n) + c;
+	// nl lines from l; shifting right avoids 1UL << 32 when nl is 32
+	epd_dirty |= (0xFFFFFFFFUL >> (32 - nl)) << l;
+	*p++ = style[0];
+	for (int i = 0; i < (nc-2); i++) {
+		*p++ = style[1];
+	}
+	*p = style[2];
+	for (int i = 0; i < (nl-2); i++) {
+		p = epd_line(l+1+i, &n) + c;
+		*p = style[3];
+		p[nc-1] = style[4];
+	}
+	p = epd_line(l+nl-1, &n) + c;
+	*p++ = style[5];
+	for (int i = 0; i < (nc-2); i++) {
+		*p++ = style[6];
+	}
+	*p = style[7];
+}
+
+// The scanline buffer for the next row, not the one being sent
+static inline uint8_t *epd_row_begin (void) {
+#ifdef EPD_STATS
+	epd_stat_t = EPD_TICKS();
+#endif
+	return epd_lines[epd_line_buf++ & 1];
+}
+
+// Send the row made in line, up to e; blank to the end of the scanline
+// if pad
+static inline void epd_row_end (uint8_t *line, uint8_t *e, uint8_t pad) {
+	if (pad) {
+		memset(e, 0xFF, line + EPD_BYTES - e);
+		e = line + EPD_BYTES;
+	}
+#ifdef EPD_STATS
+	epd_stat_make += EPD_TICKS() - epd_stat_t;
+#endif
+	epd_send_line(line, e - line);
+}
+
+// Send the text lines l0 to l1 (in region r), characters c0 to c1, of buf;
+// the characters must be whole units of the font
+void epd_send_lines (const uint8_t *buf, const epd_region_t *r, uint8_t l0, uint8_t l1, uint8_t c0, uint8_t c1, uint8_t pad) {
+	uint8_t units = (c1 - c0 + 1) >> (r->font->chars >> 1);
+	uint8_t y;
+	const uint8_t *ps = buf + epd_find_line(l0, &r, &y) + c0;
+
+	// the loop of the font, chosen once for the area
+	EPD_LAYOUT(EPD_REGION_SEND)
+}
+
+// Send the graphic screen data
+void epd_send_screen () {
+	uint8_t l = 0, y = 0;
+#ifdef EPD_STATS
+	uint32_t t0 = EPD_TICKS();
+	epd_stat_make = 0;
+#endif
+
+	epd_send_begin();
+	for (int i = 0; i < EPD_REGIONS; i++) {
+		const epd_region_t *r = &epd_regions[i];
+		epd_send_lines(screen, r, l, l + r->lines - 1, 0, r->cols - 1, 1);
+		l += r->lines;
+		y += r->lines * r->font->h;
+	}
+
+	// Clear remaining graphical lines, in the buffer not being sent
+	for (; y < EPD_HEIGHT; y++) {
+		uint8_t *line = epd_lines[epd_line_buf++ & 1];
+		memset(line, 0xFF, EPD_BYTES);
+		epd_send_line(line, EPD_BYTES);
+	}
+	epd_send_end();
+#ifdef EPD_STATS
+	epd_stat_send = EPD_TICKS() - t0;
+#endif
+}
+
+// Find the areas of the lines written that changed since the last refresh:
+// a rectangle for consecutive lines of a region whose changed columns
+// overlap; returns the number of characters changed
+uint16_t epd_diff () {
+	epd_rect_t *r = NULL;
+	uint16_t changed = 0;
+	uint8_t *ps = screen;
+	uint8_t *po = shadow;
+	uint8_t l = 0;
+
+	epd_nrects = 0;
+	for (int i = 0; i < EPD_REGIONS; i++) {
+		const epd_region_t *rg = &epd_regions[i];
+		uint8_t unit = rg->font->chars - 1;
+		r = NULL;
+		for (int n = 0; n < rg->lines; n++, l++, ps += rg->cols, po += rg->cols) {
+			int c0 = -1, c1 = 0;
+			if (!(epd_dirty & EPD_DIRTY(l))) {
+				// not written, the same as sent
+				r = NULL;
+				continue;
+			}
+			for (int c = 0; c < rg->cols; c++) {
+				if (ps[c] != po[c]) {
+					if (c0 < 0) {
+						c0 = c;
+					}
+					c1 = c;
+					changed++;
+				}
+			}
+			if (c0 < 0) {
+				r = NULL;
+				continue;
+			}
+			// whole bytes: units of the font (2 chars are 3 bytes in 12x16)
+			c0 &= ~unit;
+			c1 |= unit;
+			if (r && (c0 <= r->c1) && (c1 >= r->c0)) {
+				r->l1 = l;
+				if (c0 < r->c0) {
+					r->c0 = c0;
+				}
+				if (c1 > r->c1) {
+					r->c1 = c1;
+				}
+			} else {
+				r = &epd_rects[epd_nrects++];
+				r->l0 = r->l1 = l;
+				r->c0 = c0;
+				r->c1 = c1;
+				r->region = i;
+			}
+		}
+	}
+	return changed;
+}
+
+// Set the RAM window for an area of characters and send it to a RAM
+void epd_send_rect (const epd_rect_t *rc, uint8_t cmd) {
+	const epd_region_t *r = &epd_regions[rc->region];
+	const epd_font_t *f = r->font;
+	uint8_t shift = f->chars >> 1;
+	uint8_t y;
+
+	epd_find_line(rc->l0, &r, &y);
+	epd_set_window((rc->c0 >> shift) * f->bytes, (rc->c1 >> shift) * f->bytes + f->bytes - 1,
+		y, y + (rc->l1 - rc->l0 + 1) * f->h - 1);
+	epd_write_cmd(cmd);
+	epd_send_begin();
+	epd_send_lines(shadow, r, rc->l0, rc->l1, rc->c0, rc->c1, 0);
+	epd_send_end();
+}
+
+// Start updating the image on the display
+// returns at once (TRUE), EPD_ON_READY() is called when BUSY goes low;
+// nothing is done (FALSE) if the screen did not change
+uint8_t epd_refresh() {
+	uint16_t changed;
+
+	// Turnon if necessary, the RAMs are lost
+	if (hibernating) {
+		epd_init();
+		shadow_valid = 0;
+	}
+
+	changed = epd_diff();
+	if (shadow_valid && (changed == 0)) {
+		return 0;
+	}
+	epd_full = !shadow_valid || (epd_partials >= EPD_FULL_EVERY) || (changed > EPD_CHARS/2);
+	memcpy(shadow, screen, EPD_CHARS);
+	shadow_valid = 1;
+	epd_dirty = 0;
+
+	if (epd_full) {
+		epd_partials = 0;
+		epd_set_window(0, EPD_BYTES - 1, 0, EPD_HEIGHT - 1);
+
+		// Fill RED RAM
+		epd_setpos(0, 0);
+		epd_write_cmd(CMD_WRITE_REDRAM);
+		epd_send_screen();
+
+		// Fill BW RAM
+		epd_setpos(0, 0);
+		epd_write_cmd(CMD_WRITE_RAM);
+		epd_send_screen();
+
+		// Update the display
+		epd_write_cmd(CMD_DISP_UPD_CTL);
+		epd_write_data(0xF4);
+		epd_write_cmd(CMD_ACTIVE_DISP_UPD_SEQ);
+	} else {
+		epd_partials++;
+
+		// New image only in the changed areas of the BW RAM; the RED RAM
+		// keeps the old one and the partial waveform (display mode 2)
+		// drives only the pixels that differ
+		for (int i = 0; i < epd_nrects; i++) {
+			epd_send_rect(&epd_rects[i], CMD_WRITE_RAM);
+		}
+
+		// Update the display
+		epd_write_cmd(CMD_DISP_UPD_CTL);
+		epd_write_data(0xFC);
+		epd_write_cmd(CMD_ACTIVE_DISP_UPD_SEQ);
+	}
+
+	epd_updating = 1;
+	return 1;
+}
+
+// End of the update: after a partial one the RED RAM gets the new image
+// too, it is the old image for the next one
+void epd_refresh_done() {
+	epd_updating = 0;
+	if (!epd_full) {
+		for (int i = 0; i < epd_nrects; i++) {
+			epd_send_rect(&epd_rects[i], CMD_WRITE_REDRAM);
+		}
+	}
+}
+
+#endif
@@ -0,0 +1,250 @@
+/*
+ * E-paper demo on a PC - runs epaper.c (or epaper12.c) on the model of the
+ * SSD1681 controller in epd_host.h
+ *
+ * The demo runs as on the board, on the scheduler with simulated time:
+ * the bytes it sends go to the model, BUSY stays high for the time of
+ * each update and its end posts the event of the EXTI IRQ. After each
+ * update the panel is checked against the whole screen (as a full update
+ * sends it), the RED RAM against the BW RAM, and the image is saved or
+ * compared with one saved before (golden images). Prints the bytes and
+ * time of each update.
+ *
+ * Build:   gcc -O2 -Wall -I../common -o epdhost epdhost.c
+ *          gcc -O2 -Wall -I. -I../common -DEPAPER12 -o epdhost12 epdhost.c
+ *          (add -DEPD_STATS to print the time on the SPI of full updates)
+ * Use:     ./epdhost [-n updates] [-w dir | -c dir]
+ *                              -w saves a PBM per update in dir,
+ *                              -c compares with the PBM images in dir
+ */
+
+#define EPD_HOST
+#define SCHED_HOST
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "epd_host.h"
+
+// the statistics of the driver in us of simulated time
+#define EPD_TICKS() ((uint32_t)(epd_host.time_ns / 1000))
+#define DELAY_US_TIME 1
+
+// provided here for the SDK and the hardware part of the drivers
+void SystemInit(void);
+void sched_init(void);
+void epd_pin_init(void);
+
+#define main epaper_main
+#ifdef EPAPER12
+#include "../epaper12/epaper12.c"
+#define NAME "epaper12"
+#else
+#include "epaper.c"
+#define NAME "epaper"
+#endif
+#undef main
+
+int errors;
+uint32_t updates = 12, checked;
+uint32_t last_bytes;
+char mode;
+const char *dir;
+
+// the screen as a full update sends it
+uint8_t frame[EPD_HOST_H][EPD_HOST_BYTES];
+uint16_t nframe;
+uint8_t capture;
+
+void SystemInit(void) {}
+void sched_init(void) {}
+void epd_pin_init(void) {}
+
+/*
+ * the SysTick follows the simulated time; the BUSY IRQ posts its event
+ */
+void host_run(uint64_t ns)
+{
+	if(epd_host_run(ns))
+		EPD_ON_READY();
+	sched_ticks = epd_host.time_ns / 1000000;
+}
+
+void Delay_Ms(uint32_t ms)
+{
+	host_run(ms*1000000ull);
+}
+
+/*
+ * the functions of epd_text.h for the hardware
+ */
+void epd_hw_reset(void)
+{
+	Delay_Ms(50);
+	epd_host_reset();
+	Delay_Ms(50);
+}
+
+uint8_t epd_hw_busy(void)
+{
+	return epd_host.busy;
+}
+
+uint8_t epd_wait_busy(void)
+{
+	uint64_t start = epd_host.time_ns;
+
+	while(epd_host.busy)
+	{
+		if(epd_host.time_ns - start > 40000*1000000ull)
+			return 1;
+		host_run(1000000);
+	}
+	return 0;
+}
+
+void epd_write_cmd(uint8_t cmd)
+{
+	epd_host_cmd(cmd);
+}
+
+void epd_write_data(uint8_t data)
+{
+	epd_host_data(data);
+}
+
+void epd_send_begin(void)
+{
+	nframe = 0;
+}
+
+void epd_send_line(const uint8_t *p, uint8_t n)
+{
+	if(capture)
+	{
+		while(n--)
+		{
+			if(nframe < sizeof(frame))
+				frame[0][nframe] = *p;
+			nframe++;
+			p++;
+		}
+	}
+	else
+	{
+		while(n--)
+			epd_host_data(*p++);
+	}
+}
+
+void epd_send_end(void)
+{
+	sched_ticks = epd_host.time_ns / 1000000;
+}
+
+/*
+ * after an update and the end of it (epd_refresh_done)
+ */
+void check_update(void)
+{
+	int diff = 0;
+	char fname[256];
+
+	// the panel rows are the RAM rows from the top
+	capture = 1;
+	epd_send_screen();
+	capture = 0;
+	for(int y=0;y<EPD_HOST_H;y++)
+		for(int x=0;x<EPD_HOST_BYTES;x++)
+			diff += __builtin_popcount(frame[y][x] ^ epd_host.panel[y][x]);
+	if(diff)
+	{
+		printf("update %u: %d pixels different from the screen\n", checked, diff);
+		errors++;
+	}
+	if(memcmp(epd_host.bw, epd_host.red, sizeof(epd_host.bw)))
+	{
+		printf("update %u: the RED RAM is not the image on the panel\n", checked);
+		errors++;
+	}
+
+	printf("update %u: %s, %u areas, %u bytes in %.2f ms on the SPI\n", checked,
+		epd_full ? "full" : "partial", epd_full ? 1 : epd_nrects,
+		epd_host.bytes - last_bytes, (epd_host.bytes - last_bytes) * EPD_HOST_BYTE_NS / 1e6);
+	last_bytes = epd_host.bytes;
+
+	if(mode)
+	{
+		snprintf(fname, sizeof(fname), "%s/" NAME "_%02u.pbm", dir, checked);
+		if(mode == 'w')
+		{
+			if(epd_host_save_pbm(fname))
+			{
+				printf("%s: can't save\n", fname);
+				errors++;
+			}
+		}
+		else
+		{
+			diff = epd_host_compare_pbm(fname);
+			if(diff)
+			{
+				if(diff < 0)
+					printf("%s: can't read\n", fname);
+				else
+					printf("%s: %d pixels different\n", fname, diff);
+				errors++;
+			}
+		}
+	}
+}
+
+/*
+ * the time goes on until BUSY goes low or a timer expires
+ */
+void sched_host_idle(void)
+{
+	if(epd_host.full + epd_host.partial > checked)
+	{
+		check_update();
+		if(++checked >= updates)
+		{
+			sched_exit = 1;
+			return;
+		}
+	}
+	host_run(1000000);
+}
+
+int main(int argc, char *argv[])
+{
+	for(int i=1;i<argc;i++)
+	{
+		if(!strcmp(argv[i], "-n") && (i+1 < argc))
+			updates = atoi(argv[++i]);
+		else if((!strcmp(argv[i], "-w") || !strcmp(argv[i], "-c")) && (i+1 < argc))
+		{
+			mode = argv[i][1];
+			dir = argv[++i];
+		}
+		else
+		{
+			printf("use: %s [-n updates] [-w dir | -c dir]\n", argv[0]);
+			return 2;
+		}
+	}
+
+	epd_host_init();
+	epaper_main();
+
+	if(epd_host.errors)
+	{
+		printf("%u bytes sent while BUSY, in deep sleep or not expected\n", epd_host.errors);
+		errors++;
+	}
+	printf("%u updates (%u full, %u partial) in %.1f s, BUSY %.1f s, %u bytes on the SPI\n",
+		epd_host.full + epd_host.partial, epd_host.full, epd_host.partial,
+		epd_host.time_ns / 1e9, epd_host.busy_ns / 1e9, epd_host.bytes);
+	printf(errors ? "%d errors\n" : "ok\n", errors);
+	return errors ? 1 : 0;
+}
@@ -0,0 +1,245 @@
+/*
+ * E-paper text driver test - runs epd_text.h on a PC
+ *
+ * Uses a layout with two fonts: 4 lines of 16 characters in 12x16 above 17
+ * lines of 25 characters in 8x8. Makes the bytes of random screens, with
+ * all the characters of the fonts, and checks them against the code the
+ * drivers of epaper and epaper12 used before (a byte at a time, and two
+ * glyph lookups and 16 bit shifts for each pair in 12x16), then checks the
+ * areas found for partial refresh and compares the time to make a screen.
+ *
+ * Build:   gcc -O2 -Wall -o epdsim epdsim.c
+ * Use:     ./epdsim
+ */
+
+#define EPD_HOST
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "font_8x8_sub.h"
+#include "../epaper12/font_12x16_sub.h"
+
+#define LINES12 4
+#define LINES8 17
+
+#define EPD_LAYOUT(R) \
+	R(font12, LINES12, 16) \
+	R(font8, LINES8, 25)
+#include "epd_text.h"
+EPD_FONT_PACKED12(font12, console_font_12x16, CONSOLE_FONT_12X16_GLYPH, 16)
+EPD_FONT_BYTES_INV(font8, fontdata, FONTDATA_GLYPH, 8)
+
+#define FRAME (EPD_HEIGHT*EPD_BYTES)
+#define FRAMES 2000
+
+int errors;
+
+// what the driver sends (not kept in the time test: on the MCU a line
+// goes to the SPI from the buffer it was made in)
+uint8_t sent[FRAME];
+int nsent, capture = 1;
+
+void Delay_Ms(uint32_t ms) {}
+void epd_hw_reset(void) {}
+uint8_t epd_wait_busy(void) { return 0; }
+void epd_write_cmd(uint8_t cmd) {}
+void epd_write_data(uint8_t data) {}
+void epd_send_begin(void) { nsent = 0; }
+void epd_send_end(void) {}
+
+void epd_send_line(const uint8_t *p, uint8_t n)
+{
+	if(capture && (nsent + n <= FRAME))
+		memcpy(sent + nsent, p, n);
+	nsent += n;
+}
+
+// characters of each font (the others are the first glyph)
+uint8_t chars8[256], chars12[256];
+int n8, n12;
+
+void random_screen(void)
+{
+	for(int i=0;i<EPD_CHARS;i++)
+		screen[i] = i < LINES12*16 ? chars12[rand() % n12] : chars8[rand() % n8];
+}
+
+/*
+ * the screen as the drivers sent it before
+ */
+void old_screen(uint8_t *out)
+{
+	uint8_t *ps = screen;
+
+	// epaper12
+	for (int l = 0; l < LINES12; l++, ps += 16) {
+		for (int lg = 0; lg < 16; lg++) {
+			int ofs = lg + (lg >> 1);
+			for (int c = 0; c < 16; c += 2) {
+				const uint8_t *p = &console_font_12x16[CONSOLE_FONT_12X16_GLYPH(ps[c])*CONSOLE_FONT_12X16_BYTES + ofs];
+				uint16_t r1 = (lg & 1) ? ((p[0] & 0x0F) << 8) | p[1] : (p[0] << 4) | (p[1] >> 4);
+				p = &console_font_12x16[CONSOLE_FONT_12X16_GLYPH(ps[c+1])*CONSOLE_FONT_12X16_BYTES + ofs];
+				uint16_t r2 = (lg & 1) ? ((p[0] & 0x0F) << 8) | p[1] : (p[0] << 4) | (p[1] >> 4);
+				*out++ = r1 >> 4;
+				*out++ = ((r1 << 4) | (r2 >> 8)) & 0xFF;
+				*out++ = r2 & 0xFF;
+			}
+			*out++ = 0xFF;
+		}
+	}
+
+	// epaper
+	for (int l = 0; l < LINES8; l++, ps += 25) {
+		for (int lg = 0; lg < 8; lg++) {
+			for (int c = 0; c < 25; c++) {
+				*out++ = ~fontdata[(FONTDATA_GLYPH(ps[c]) << 3)+lg];
+			}
+		}
+	}
+}
+
+void new_screen(uint8_t *out)
+{
+	epd_send_screen();
+}
+
+void check_screens(void)
+{
+	static uint8_t a[FRAME];
+
+	for(int k=0;k<500;k++)
+	{
+		random_screen();
+		old_screen(a);
+		memset(sent, 0x55, FRAME);
+		epd_send_screen();
+		if(nsent != FRAME)
+		{
+			printf("screen %d: %d bytes sent\n", k, nsent);
+			errors++;
+			continue;
+		}
+		for(int i=0;i<FRAME;i++)
+			if(a[i] != sent[i])
+			{
+				if(errors++ < 10)
+					printf("screen %d, row %d, byte %d: %02X, expected %02X\n",
+						k, i / EPD_BYTES, i % EPD_BYTES, sent[i], a[i]);
+			}
+	}
+}
+
+/*
+ * every character written and changed is in an area, the areas are in
+ * their region and in whole bytes
+ */
+void check_diff(void)
+{
+	for(int k=0;k<2000;k++)
+	{
+		uint8_t n;
+		uint16_t changed = 0, found;
+
+		random_screen();
+		memcpy(shadow, screen, EPD_CHARS);
+		epd_dirty = 0;
+		for(int w=rand()%6;w>0;w--)
+		{
+			uint8_t l = rand() % EPD_LINES;
+			uint8_t text[4] = { 0 };
+			epd_line(l, &n);
+			uint8_t c = rand() % (n - 3);
+			for(int i=0;i<3;i++)
+				text[i] = l < LINES12 ? chars12[rand() % n12] : chars8[rand() % n8];
+			epd_write(l, c, text);
+		}
+		for(int i=0;i<EPD_CHARS;i++)
+			changed += screen[i] != shadow[i];
+		found = epd_diff();
+		if(found != changed)
+		{
+			printf("diff %d: %d changed, %d found\n", k, changed, found);
+			errors++;
+		}
+		for(int l=0;l<EPD_LINES;l++)
+		{
+			const epd_region_t *r;
+			uint8_t y;
+			uint16_t ofs = epd_find_line(l, &r, &y);
+			for(int c=0;c<r->cols;c++)
+			{
+				int in = 0;
+				for(int i=0;i<epd_nrects;i++)
+				{
+					const epd_rect_t *rc = &epd_rects[i];
+					if((l >= rc->l0) && (l <= rc->l1) && (c >= rc->c0) && (c <= rc->c1))
+						in = 1;
+				}
+				if((screen[ofs+c] != shadow[ofs+c]) && !in)
+				{
+					printf("diff %d: line %d column %d not in an area\n", k, l, c);
+					errors++;
+				}
+			}
+		}
+		for(int i=0;i<epd_nrects;i++)
+		{
+			const epd_rect_t *rc = &epd_rects[i];
+			const epd_region_t *r = &epd_regions[rc->region], *r0, *r1;
+			uint8_t y, unit = r->font->chars;
+			epd_find_line(rc->l0, &r0, &y);
+			epd_find_line(rc->l1, &r1, &y);
+			if((r0 != r) || (r1 != r) || (rc->c1 >= r->cols) || (rc->c0 % unit) || ((rc->c1 + 1) % unit))
+			{
+				printf("diff %d: area %d to %d, %d to %d\n", k, rc->l0, rc->l1, rc->c0, rc->c1);
+				errors++;
+			}
+		}
+	}
+}
+
+/*
+ * ns per frame
+ */
+double bench(void (*make)(uint8_t *), uint8_t *out)
+{
+	clock_t t = clock();
+
+	for(int k=0;k<FRAMES;k++)
+	{
+		screen[k % EPD_CHARS] ^= 1;
+		make(out);
+	}
+	return (clock() - t) * 1e9 / CLOCKS_PER_SEC / FRAMES;
+}
+
+int main(void)
+{
+	static uint8_t a[FRAME];
+	double told, tnew;
+
+	for(int c=CONSOLE_FONT_12X16_FIRST;c<=CONSOLE_FONT_12X16_LAST;c++)
+		if((c == CONSOLE_FONT_12X16_FIRST) || CONSOLE_FONT_12X16_GLYPH(c))
+			chars12[n12++] = c;
+	chars12[n12++] = 0xFF;
+	for(int c=FONTDATA_FIRST;c<=FONTDATA_LAST;c++)
+		if((c == FONTDATA_FIRST) || FONTDATA_GLYPH(c))
+			chars8[n8++] = c;
+	chars8[n8++] = 0xFF;
+
+	srand(1);
+	check_screens();
+	check_diff();
+
+	random_screen();
+	told = bench(old_screen, a);
+	capture = 0;
+	tnew = bench(new_screen, a);
+	printf("%d + %d characters, %d bytes per screen: before %.0f ns, now %.0f ns (%.1f times faster)\n",
+		n12, n8, FRAME, told, tnew, told / tnew);
+	printf(errors ? "%d errors\n" : "ok\n", errors);
+	return errors ? 1 : 0;
+}
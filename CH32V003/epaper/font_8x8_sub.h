@@ -0,0 +1,225 @@
+/*
+ * fontdata: 91 glyphs 8x8 from ../fonts/font_8x8.h, layout rows
+ * generated by CH32V003/fonts/fontc.py, do not edit
+ */
+
+#ifndef _FONTDATA_H
+#define _FONTDATA_H
+
+#define FONTDATA_W 8
+#define FONTDATA_H 8
+#define FONTDATA_BYTES 8		// bytes per glyph
+#define FONTDATA_COUNT 91
+#define FONTDATA_FIRST 32
+#define FONTDATA_LAST 218
+#define FONTDATA_GLYPH(c) fontdata_glyph(c)
+
+// glyph for each character code
+const uint8_t fontdata_map[] = {
+	0x00, 0x00, 0x01, 0x02, 0x00, 0x03, 0x00, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C,
+	0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C,
+	0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2A, 0x2B, 0x2C,
+	0x2D, 0x2E, 0x2F, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3A, 0x3B, 0x3C,
+	0x3D, 0x3E, 0x00, 0x3F, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x00, 0x00, 0x46, 0x47, 0x48, 0x49,
+	0x4A, 0x00, 0x4B, 0x4C, 0x4D, 0x4E, 0x4F, 0x50, 0x00, 0x51, 0x00, 0x52, 0x53, 0x54, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x56,
+	0x57, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x5A,
+};
+
+static inline uint8_t fontdata_glyph(uint8_t c)
+{
+	if((c < FONTDATA_FIRST) || (c > FONTDATA_LAST))
+		return 0;
+	return fontdata_map[c - FONTDATA_FIRST];
+}
+
+const uint8_t fontdata[] = {
+	/* 0 ' ' */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 1 '"' */
+	0x66, 0x66, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 2 '#' */
+	0x6C, 0x6C, 0xFE, 0x6C, 0xFE, 0x6C, 0x6C, 0x00,
+	/* 3 '%' */
+	0x00, 0xC6, 0xCC, 0x18, 0x30, 0x66, 0xC6, 0x00,
+	/* 4 ''' */
+	0x18, 0x18, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 5 '(' */
+	0x0C, 0x18, 0x30, 0x30, 0x30, 0x18, 0x0C, 0x00,
+	/* 6 ')' */
+	0x30, 0x18, 0x0C, 0x0C, 0x0C, 0x18, 0x30, 0x00,
+	/* 7 0x2A */
+	0x00, 0x66, 0x3C, 0xFF, 0x3C, 0x66, 0x00, 0x00,
+	/* 8 '+' */
+	0x00, 0x18, 0x18, 0x7E, 0x18, 0x18, 0x00, 0x00,
+	/* 9 ',' */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x30,
+	/* 10 '-' */
+	0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00,
+	/* 11 '.' */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00,
+	/* 12 0x2F */
+	0x06, 0x0C, 0x18, 0x30, 0x60, 0xC0, 0x80, 0x00,
+	/* 13 '0' */
+	0x38, 0x6C, 0xC6, 0xD6, 0xC6, 0x6C, 0x38, 0x00,
+	/* 14 '1' */
+	0x18, 0x38, 0x18, 0x18, 0x18, 0x18, 0x7E, 0x00,
+	/* 15 '2' */
+	0x7C, 0xC6, 0x06, 0x1C, 0x30, 0x66, 0xFE, 0x00,
+	/* 16 '3' */
+	0x7C, 0xC6, 0x06, 0x3C, 0x06, 0xC6, 0x7C, 0x00,
+	/* 17 '4' */
+	0x1C, 0x3C, 0x6C, 0xCC, 0xFE, 0x0C, 0x1E, 0x00,
+	/* 18 '5' */
+	0xFE, 0xC0, 0xC0, 0xFC, 0x06, 0xC6, 0x7C, 0x00,
+	/* 19 '6' */
+	0x38, 0x60, 0xC0, 0xFC, 0xC6, 0xC6, 0x7C, 0x00,
+	/* 20 '7' */
+	0xFE, 0xC6, 0x0C, 0x18, 0x30, 0x30, 0x30, 0x00,
+	/* 21 '8' */
+	0x7C, 0xC6, 0xC6, 0x7C, 0xC6, 0xC6, 0x7C, 0x00,
+	/* 22 '9' */
+	0x7C, 0xC6, 0xC6, 0x7E, 0x06, 0x0C, 0x78, 0x00,
+	/* 23 ':' */
+	0x00, 0x18, 0x18, 0x00, 0x00, 0x18, 0x18, 0x00,
+	/* 24 ';' */
+	0x00, 0x18, 0x18, 0x00, 0x00, 0x18, 0x18, 0x30,
+	/* 25 '<' */
+	0x06, 0x0C, 0x18, 0x30, 0x18, 0x0C, 0x06, 0x00,
+	/* 26 '=' */
+	0x00, 0x00, 0x7E, 0x00, 0x00, 0x7E, 0x00, 0x00,
+	/* 27 '>' */
+	0x60, 0x30, 0x18, 0x0C, 0x18, 0x30, 0x60, 0x00,
+	/* 28 '?' */
+	0x7C, 0xC6, 0x0C, 0x18, 0x18, 0x00, 0x18, 0x00,
+	/* 29 '@' */
+	0x7C, 0xC6, 0xDE, 0xDE, 0xDE, 0xC0, 0x78, 0x00,
+	/* 30 'A' */
+	0x38, 0x6C, 0xC6, 0xFE, 0xC6, 0xC6, 0xC6, 0x00,
+	/* 31 'B' */
+	0xFC, 0x66, 0x66, 0x7C, 0x66, 0x66, 0xFC, 0x00,
+	/* 32 'C' */
+	0x3C, 0x66, 0xC0, 0xC0, 0xC0, 0x66, 0x3C, 0x00,
+	/* 33 'D' */
+	0xF8, 0x6C, 0x66, 0x66, 0x66, 0x6C, 0xF8, 0x00,
+	/* 34 'E' */
+	0xFE, 0x62, 0x68, 0x78, 0x68, 0x62, 0xFE, 0x00,
+	/* 35 'F' */
+	0xFE, 0x62, 0x68, 0x78, 0x68, 0x60, 0xF0, 0x00,
+	/* 36 'G' */
+	0x3C, 0x66, 0xC0, 0xC0, 0xCE, 0x66, 0x3A, 0x00,
+	/* 37 'H' */
+	0xC6, 0xC6, 0xC6, 0xFE, 0xC6, 0xC6, 0xC6, 0x00,
+	/* 38 'I' */
+	0x3C, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3C, 0x00,
+	/* 39 'J' */
+	0x1E, 0x0C, 0x0C, 0x0C, 0xCC, 0xCC, 0x78, 0x00,
+	/* 40 'K' */
+	0xE6, 0x66, 0x6C, 0x78, 0x6C, 0x66, 0xE6, 0x00,
+	/* 41 'L' */
+	0xF0, 0x60, 0x60, 0x60, 0x62, 0x66, 0xFE, 0x00,
+	/* 42 'M' */
+	0xC6, 0xEE, 0xFE, 0xFE, 0xD6, 0xC6, 0xC6, 0x00,
+	/* 43 'N' */
+	0xC6, 0xE6, 0xF6, 0xDE, 0xCE, 0xC6, 0xC6, 0x00,
+	/* 44 'O' */
+	0x7C, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0x7C, 0x00,
+	/* 45 'P' */
+	0xFC, 0x66, 0x66, 0x7C, 0x60, 0x60, 0xF0, 0x00,
+	/* 46 'Q' */
+	0x7C, 0xC6, 0xC6, 0xC6, 0xC6, 0xCE, 0x7C, 0x0E,
+	/* 47 'R' */
+	0xFC, 0x66, 0x66, 0x7C, 0x6C, 0x66, 0xE6, 0x00,
+	/* 48 'S' */
+	0x3C, 0x66, 0x30, 0x18, 0x0C, 0x66, 0x3C, 0x00,
+	/* 49 'T' */
+	0x7E, 0x7E, 0x5A, 0x18, 0x18, 0x18, 0x3C, 0x00,
+	/* 50 'U' */
+	0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0x7C, 0x00,
+	/* 51 'V' */
+	0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0x6C, 0x38, 0x00,
+	/* 52 'W' */
+	0xC6, 0xC6, 0xC6, 0xD6, 0xD6, 0xFE, 0x6C, 0x00,
+	/* 53 'X' */
+	0xC6, 0xC6, 0x6C, 0x38, 0x6C, 0xC6, 0xC6, 0x00,
+	/* 54 'Y' */
+	0x66, 0x66, 0x66, 0x3C, 0x18, 0x18, 0x3C, 0x00,
+	/* 55 'Z' */
+	0xFE, 0xC6, 0x8C, 0x18, 0x32, 0x66, 0xFE, 0x00,
+	/* 56 '[' */
+	0x3C, 0x30, 0x30, 0x30, 0x30, 0x30, 0x3C, 0x00,
+	/* 57 0x5C */
+	0xC0, 0x60, 0x30, 0x18, 0x0C, 0x06, 0x02, 0x00,
+	/* 58 ']' */
+	0x3C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x3C, 0x00,
+	/* 59 '^' */
+	0x10, 0x38, 0x6C, 0xC6, 0x00, 0x00, 0x00, 0x00,
+	/* 60 '_' */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+	/* 61 '`' */
+	0x30, 0x18, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 62 'a' */
+	0x00, 0x00, 0x78, 0x0C, 0x7C, 0xCC, 0x76, 0x00,
+	/* 63 'c' */
+	0x00, 0x00, 0x7C, 0xC6, 0xC0, 0xC6, 0x7C, 0x00,
+	/* 64 'd' */
+	0x1C, 0x0C, 0x7C, 0xCC, 0xCC, 0xCC, 0x76, 0x00,
+	/* 65 'e' */
+	0x00, 0x00, 0x7C, 0xC6, 0xFE, 0xC0, 0x7C, 0x00,
+	/* 66 'f' */
+	0x3C, 0x66, 0x60, 0xF8, 0x60, 0x60, 0xF0, 0x00,
+	/* 67 'g' */
+	0x00, 0x00, 0x76, 0xCC, 0xCC, 0x7C, 0x0C, 0xF8,
+	/* 68 'h' */
+	0xE0, 0x60, 0x6C, 0x76, 0x66, 0x66, 0xE6, 0x00,
+	/* 69 'i' */
+	0x18, 0x00, 0x38, 0x18, 0x18, 0x18, 0x3C, 0x00,
+	/* 70 'l' */
+	0x38, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3C, 0x00,
+	/* 71 'm' */
+	0x00, 0x00, 0xEC, 0xFE, 0xD6, 0xD6, 0xD6, 0x00,
+	/* 72 'n' */
+	0x00, 0x00, 0xDC, 0x66, 0x66, 0x66, 0x66, 0x00,
+	/* 73 'o' */
+	0x00, 0x00, 0x7C, 0xC6, 0xC6, 0xC6, 0x7C, 0x00,
+	/* 74 'p' */
+	0x00, 0x00, 0xDC, 0x66, 0x66, 0x7C, 0x60, 0xF0,
+	/* 75 'r' */
+	0x00, 0x00, 0xDC, 0x76, 0x60, 0x60, 0xF0, 0x00,
+	/* 76 's' */
+	0x00, 0x00, 0x7E, 0xC0, 0x7C, 0x06, 0xFC, 0x00,
+	/* 77 't' */
+	0x30, 0x30, 0xFC, 0x30, 0x30, 0x36, 0x1C, 0x00,
+	/* 78 'u' */
+	0x00, 0x00, 0xCC, 0xCC, 0xCC, 0xCC, 0x76, 0x00,
+	/* 79 'v' */
+	0x00, 0x00, 0xC6, 0xC6, 0xC6, 0x6C, 0x38, 0x00,
+	/* 80 'w' */
+	0x00, 0x00, 0xC6, 0xD6, 0xD6, 0xFE, 0x6C, 0x00,
+	/* 81 'y' */
+	0x00, 0x00, 0xC6, 0xC6, 0xC6, 0x7E, 0x06, 0xFC,
+	/* 82 '{' */
+	0x0E, 0x18, 0x18, 0x70, 0x18, 0x18, 0x0E, 0x00,
+	/* 83 '|' */
+	0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x00,
+	/* 84 '}' */
+	0x70, 0x18, 0x18, 0x0E, 0x18, 0x18, 0x70, 0x00,
+	/* 85 0xB3 */
+	0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+	/* 86 0xBF */
+	0x00, 0x00, 0x00, 0x00, 0xF8, 0x18, 0x18, 0x18,
+	/* 87 0xC0 */
+	0x18, 0x18, 0x18, 0x18, 0x1F, 0x00, 0x00, 0x00,
+	/* 88 0xC4 */
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
+	/* 89 0xD9 */
+	0x18, 0x18, 0x18, 0x18, 0xF8, 0x00, 0x00, 0x00,
+	/* 90 0xDA */
+	0x00, 0x00, 0x00, 0x00, 0x1F, 0x18, 0x18, 0x18,
+};
+
+#endif
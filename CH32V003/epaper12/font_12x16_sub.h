@@ -0,0 +1,298 @@
+/*
+ * console_font_12x16: 85 glyphs 12x16 from ../fonts/font_12x16.h, layout packed
+ * generated by CH32V003/fonts/fontc.py, do not edit
+ */
+
+#ifndef _CONSOLE_FONT_12X16_H
+#define _CONSOLE_FONT_12X16_H
+
+#define CONSOLE_FONT_12X16_W 12
+#define CONSOLE_FONT_12X16_H 16
+#define CONSOLE_FONT_12X16_BYTES 24		// bytes per glyph
+#define CONSOLE_FONT_12X16_COUNT 85
+#define CONSOLE_FONT_12X16_FIRST 32
+#define CONSOLE_FONT_12X16_LAST 218
+#define CONSOLE_FONT_12X16_GLYPH(c) console_font_12x16_glyph(c)
+
+// glyph for each character code
+const uint8_t console_font_12x16_map[] = {
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x00, 0x00, 0x00, 0x03, 0x04, 0x05,
+	0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x00, 0x13, 0x14,
+	0x00, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23,
+	0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2A, 0x2B, 0x2C, 0x2D, 0x2E, 0x2F, 0x30, 0x31, 0x32, 0x33,
+	0x00, 0x34, 0x00, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3A, 0x3B, 0x00, 0x00, 0x3C, 0x3D, 0x3E, 0x3F,
+	0x40, 0x00, 0x41, 0x42, 0x43, 0x00, 0x44, 0x45, 0x00, 0x46, 0x00, 0x47, 0x00, 0x48, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4A, 0x4B, 0x4C, 0x00, 0x00, 0x4D,
+	0x4E, 0x00, 0x00, 0x00, 0x4F, 0x00, 0x00, 0x00, 0x50, 0x51, 0x00, 0x00, 0x00, 0x52, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x54,
+};
+
+static inline uint8_t console_font_12x16_glyph(uint8_t c)
+{
+	if((c < CONSOLE_FONT_12X16_FIRST) || (c > CONSOLE_FONT_12X16_LAST))
+		return 0;
+	return console_font_12x16_map[c - CONSOLE_FONT_12X16_FIRST];
+}
+
+const uint8_t console_font_12x16[] = {
+	/* 0 ' ' */
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	/* 1 '(' */
+	0xFC, 0x7F, 0x9F, 0xF1, 0xFF, 0x3F, 0xE3, 0xFE, 0x3F, 0xE3, 0xFE, 0x3F, 0xE3, 0xFE, 0x3F, 0xF3,
+	0xFF, 0x1F, 0xF9, 0xFF, 0xC7, 0xFF, 0xFF, 0xFF,
+	/* 2 ')' */
+	0xE3, 0xFF, 0x9F, 0xF8, 0xFF, 0xCF, 0xFC, 0x7F, 0xC7, 0xFC, 0x7F, 0xC7, 0xFC, 0x7F, 0xC7, 0xFC,
+	0xFF, 0x8F, 0xF9, 0xFE, 0x3F, 0xFF, 0xFF, 0xFF,
+	/* 3 '-' */
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x03, 0xC0, 0x3F, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	/* 4 '.' */
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0x1F, 0xF1, 0xFF, 0x1F, 0xFF, 0xFF, 0xFF,
+	/* 5 0x2F */
+	0xFF, 0xFF, 0xFE, 0xFF, 0xCF, 0xF8, 0xFF, 0x1F, 0xE3, 0xFC, 0x7F, 0x8F, 0xF1, 0xFE, 0x3F, 0xC7,
+	0xF8, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	/* 6 '0' */
+	0xF0, 0x7C, 0x01, 0xCF, 0x99, 0xF8, 0x9F, 0x09, 0xE4, 0x9C, 0xC9, 0x9C, 0x93, 0xC8, 0x7C, 0x8F,
+	0xCC, 0xF9, 0xC0, 0x1F, 0x07, 0xFF, 0xFF, 0xFF,
+	/* 7 '1' */
+	0xFC, 0xFF, 0x8F, 0xE0, 0xFE, 0x0F, 0xFC, 0xFF, 0xCF, 0xFC, 0xFF, 0xCF, 0xFC, 0xFF, 0xCF, 0xFC,
+	0xFF, 0xCF, 0xE0, 0x1E, 0x01, 0xFF, 0xFF, 0xFF,
+	/* 8 '2' */
+	0xE0, 0x3C, 0x01, 0x8F, 0x89, 0xFC, 0x9F, 0x8F, 0xF1, 0xFE, 0x3F, 0xC7, 0xF8, 0xFF, 0x1F, 0xE3,
+	0xFC, 0x7F, 0x80, 0x08, 0x00, 0xFF, 0xFF, 0xFF,
+	/* 9 '3' */
+	0xE0, 0x3C, 0x01, 0x8F, 0x89, 0xFC, 0xFF, 0xCF, 0xF8, 0xF0, 0x1F, 0x03, 0xFF, 0x9F, 0xFC, 0x9F,
+	0xC8, 0xF8, 0xC0, 0x1E, 0x03, 0xFF, 0xFF, 0xFF,
+	/* 10 '4' */
+	0xFE, 0x3F, 0xC3, 0xF8, 0x3F, 0x13, 0xE3, 0x3C, 0x73, 0x8F, 0x39, 0xF3, 0x80, 0x08, 0x00, 0xFF,
+	0x3F, 0xF3, 0xFF, 0x3F, 0xF3, 0xFF, 0xFF, 0xFF,
+	/* 11 '5' */
+	0x80, 0x08, 0x00, 0x9F, 0xF9, 0xFF, 0x9F, 0xF8, 0x03, 0xC0, 0x1F, 0xF8, 0xFF, 0xCF, 0xFC, 0x9F,
+	0xC8, 0xF8, 0xC0, 0x1E, 0x03, 0xFF, 0xFF, 0xFF,
+	/* 12 '6' */
+	0xFC, 0x3F, 0x83, 0xF1, 0xFE, 0x3F, 0xC7, 0xFC, 0xFF, 0x80, 0x38, 0x01, 0x8F, 0x89, 0xFC, 0x9F,
+	0xC8, 0xF8, 0xC0, 0x1E, 0x03, 0xFF, 0xFF, 0xFF,
+	/* 13 '7' */
+	0x80, 0x08, 0x00, 0xFF, 0x9F, 0xF9, 0xFF, 0x3F, 0xF3, 0xFE, 0x7F, 0xE7, 0xFC, 0xFF, 0xCF, 0xF9,
+	0xFF, 0x9F, 0xF3, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF,
+	/* 14 '8' */
+	0xF0, 0x7E, 0x03, 0xC7, 0x1C, 0xF9, 0xCF, 0x9C, 0x71, 0xE0, 0x3C, 0x01, 0x8F, 0x89, 0xFC, 0x9F,
+	0xC8, 0xF8, 0xC0, 0x1E, 0x03, 0xFF, 0xFF, 0xFF,
+	/* 15 '9' */
+	0xE0, 0x3C, 0x01, 0x8F, 0x89, 0xFC, 0x9F, 0xC8, 0xF8, 0xC0, 0x0E, 0x00, 0xFF, 0x9F, 0xF1, 0xFE,
+	0x3F, 0xC7, 0xE0, 0xFE, 0x1F, 0xFF, 0xFF, 0xFF,
+	/* 16 ':' */
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0x1F, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1,
+	0xFF, 0x1F, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	/* 17 ';' */
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0x1F, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1,
+	0xFF, 0x1F, 0xF1, 0xFF, 0x9F, 0xF9, 0xFF, 0x3F,
+	/* 18 '<' */
+	0xFF, 0x3F, 0xE3, 0xFC, 0x7F, 0x8F, 0xF1, 0xFE, 0x3F, 0xC7, 0xFC, 0x7F, 0xE3, 0xFF, 0x1F, 0xF8,
+	0xFF, 0xC7, 0xFE, 0x3F, 0xF3, 0xFF, 0xFF, 0xFF,
+	/* 19 '>' */
+	0xCF, 0xFC, 0x7F, 0xE3, 0xFF, 0x1F, 0xF8, 0xFF, 0xC7, 0xFE, 0x3F, 0xE3, 0xFC, 0x7F, 0x8F, 0xF1,
+	0xFE, 0x3F, 0xC7, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF,
+	/* 20 '?' */
+	0xE0, 0x7C, 0x03, 0x8F, 0x19, 0xF9, 0x9F, 0x1F, 0xE3, 0xFC, 0x7F, 0x8F, 0xF9, 0xFF, 0x9F, 0xF9,
+	0xFF, 0xFF, 0xF9, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF,
+	/* 21 'A' */
+	0xF9, 0xFF, 0x9F, 0xF0, 0xFF, 0x0F, 0xF0, 0xFE, 0x67, 0xE6, 0x7E, 0x67, 0xCF, 0x3C, 0x03, 0xC0,
+	0x39, 0xF9, 0x9F, 0x99, 0xF9, 0xFF, 0xFF, 0xFF,
+	/* 22 'B' */
+	0x80, 0xF8, 0x07, 0x9E, 0x39, 0xF3, 0x9F, 0x39, 0xE3, 0x80, 0x78, 0x03, 0x9F, 0x19, 0xF9, 0x9F,
+	0x99, 0xF1, 0x80, 0x38, 0x07, 0xFF, 0xFF, 0xFF,
+	/* 23 'C' */
+	0xF0, 0x7E, 0x03, 0xC7, 0x1C, 0xF9, 0x9F, 0xF9, 0xFF, 0x9F, 0xF9, 0xFF, 0x9F, 0xF9, 0xFF, 0xCF,
+	0x9C, 0x71, 0xE0, 0x3F, 0x07, 0xFF, 0xFF, 0xFF,
+	/* 24 'D' */
+	0x80, 0xF8, 0x07, 0x9E, 0x39, 0xF3, 0x9F, 0x99, 0xF9, 0x9F, 0x99, 0xF9, 0x9F, 0x99, 0xF9, 0x9F,
+	0x39, 0xE3, 0x80, 0x78, 0x0F, 0xFF, 0xFF, 0xFF,
+	/* 25 'E' */
+	0x80, 0x18, 0x01, 0x9F, 0xF9, 0xFF, 0x9F, 0xF9, 0xFF, 0x80, 0x78, 0x07, 0x9F, 0xF9, 0xFF, 0x9F,
+	0xF9, 0xFF, 0x80, 0x18, 0x01, 0xFF, 0xFF, 0xFF,
+	/* 26 'F' */
+	0x80, 0x18, 0x01, 0x9F, 0xF9, 0xFF, 0x9F, 0xF9, 0xFF, 0x80, 0x78, 0x07, 0x9F, 0xF9, 0xFF, 0x9F,
+	0xF9, 0xFF, 0x9F, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF,
+	/* 27 'G' */
+	0xF0, 0x3E, 0x01, 0xC7, 0x9C, 0xFF, 0x9F, 0xF9, 0xFF, 0x9C, 0x19, 0xC1, 0x9F, 0x99, 0xF9, 0xCF,
+	0x9C, 0x79, 0xE0, 0x1F, 0x01, 0xFF, 0xFF, 0xFF,
+	/* 28 'H' */
+	0x9F, 0x99, 0xF9, 0x9F, 0x99, 0xF9, 0x9F, 0x99, 0xF9, 0x80, 0x18, 0x01, 0x9F, 0x99, 0xF9, 0x9F,
+	0x99, 0xF9, 0x9F, 0x99, 0xF9, 0xFF, 0xFF, 0xFF,
+	/* 29 'I' */
+	0xE0, 0x7E, 0x07, 0xF9, 0xFF, 0x9F, 0xF9, 0xFF, 0x9F, 0xF9, 0xFF, 0x9F, 0xF9, 0xFF, 0x9F, 0xF9,
+	0xFF, 0x9F, 0xE0, 0x7E, 0x07, 0xFF, 0xFF, 0xFF,
+	/* 30 'J' */
+	0xFF, 0x9F, 0xF9, 0xFF, 0x9F, 0xF9, 0xFF, 0x9F, 0xF9, 0xFF, 0x9F, 0xF9, 0xFF, 0x99, 0xF9, 0x9F,
+	0x98, 0xF3, 0xC0, 0x3E, 0x07, 0xFF, 0xFF, 0xFF,
+	/* 31 'K' */
+	0x9F, 0x99, 0xF1, 0x9E, 0x39, 0xC7, 0x98, 0xF9, 0x1F, 0x83, 0xF8, 0x3F, 0x91, 0xF9, 0x8F, 0x9C,
+	0x79, 0xE3, 0x9F, 0x19, 0xF9, 0xFF, 0xFF, 0xFF,
+	/* 32 'L' */
+	0x9F, 0xF9, 0xFF, 0x9F, 0xF9, 0xFF, 0x9F, 0xF9, 0xFF, 0x9F, 0xF9, 0xFF, 0x9F, 0xF9, 0xFF, 0x9F,
+	0xF9, 0xFF, 0x80, 0x18, 0x01, 0xFF, 0xFF, 0xFF,
+	/* 33 'M' */
+	0x9F, 0x98, 0xF1, 0x8F, 0x18, 0x61, 0x86, 0x19, 0x09, 0x90, 0x99, 0x99, 0x99, 0x99, 0xF9, 0x9F,
+	0x99, 0xF9, 0x9F, 0x99, 0xF9, 0xFF, 0xFF, 0xFF,
+	/* 34 'N' */
+	0x9F, 0x98, 0xF9, 0x8F, 0x98, 0x79, 0x93, 0x99, 0x39, 0x99, 0x99, 0x99, 0x9C, 0x99, 0xC9, 0x9E,
+	0x19, 0xF1, 0x9F, 0x19, 0xF9, 0xFF, 0xFF, 0xFF,
+	/* 35 'O' */
+	0xF0, 0xFE, 0x07, 0xC6, 0x3C, 0xF3, 0x9F, 0x99, 0xF9, 0x9F, 0x99, 0xF9, 0x9F, 0x99, 0xF9, 0xCF,
+	0x3C, 0x63, 0xE0, 0x7F, 0x0F, 0xFF, 0xFF, 0xFF,
+	/* 36 'P' */
+	0x80, 0x78, 0x03, 0x9F, 0x19, 0xF9, 0x9F, 0x99, 0xF9, 0x9F, 0x18, 0x03, 0x80, 0x79, 0xFF, 0x9F,
+	0xF9, 0xFF, 0x9F, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF,
+	/* 37 'Q' */
+	0xF0, 0xFE, 0x07, 0xC6, 0x3C, 0xF3, 0x9F, 0x99, 0xF9, 0x9F, 0x99, 0xF9, 0x9F, 0x99, 0xC9, 0xCC,
+	0x3C, 0x63, 0xE0, 0x1F, 0x09, 0xFF, 0xFF, 0xFF,
+	/* 38 'R' */
+	0x80, 0x78, 0x03, 0x9F, 0x19, 0xF9, 0x9F, 0x99, 0xF9, 0x9F, 0x18, 0x03, 0x80, 0x79, 0x8F, 0x9C,
+	0x79, 0xE3, 0x9F, 0x19, 0xF9, 0xFF, 0xFF, 0xFF,
+	/* 39 'S' */
+	0xE0, 0x7C, 0x03, 0x8F, 0x19, 0xF9, 0x9F, 0xF8, 0xFF, 0xC0, 0x7E, 0x03, 0xFF, 0x1F, 0xF9, 0x9F,
+	0x98, 0xF1, 0xC0, 0x3E, 0x07, 0xFF, 0xFF, 0xFF,
+	/* 40 'T' */
+	0xC0, 0x3C, 0x03, 0xF9, 0xFF, 0x9F, 0xF9, 0xFF, 0x9F, 0xF9, 0xFF, 0x9F, 0xF9, 0xFF, 0x9F, 0xF9,
+	0xFF, 0x9F, 0xF9, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF,
+	/* 41 'U' */
+	0x9F, 0x99, 0xF9, 0x9F, 0x99, 0xF9, 0x9F, 0x99, 0xF9, 0x9F, 0x99, 0xF9, 0x9F, 0x99, 0xF9, 0x9F,
+	0x9C, 0xF3, 0xC0, 0x3E, 0x07, 0xFF, 0xFF, 0xFF,
+	/* 42 'V' */
+	0x9F, 0x99, 0xF9, 0x9F, 0x9C, 0xF3, 0xCF, 0x3C, 0xF3, 0xE6, 0x7E, 0x67, 0xE6, 0x7F, 0x0F, 0xF0,
+	0xFF, 0x0F, 0xF9, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF,
+	/* 43 'W' */
+	0x9F, 0x99, 0xF9, 0x9F, 0x99, 0xF9, 0x9F, 0x99, 0xF9, 0x9F, 0x99, 0x99, 0x99, 0x99, 0x09, 0x86,
+	0x18, 0xF1, 0x8F, 0x19, 0xF9, 0xFF, 0xFF, 0xFF,
+	/* 44 'X' */
+	0x9F, 0x99, 0xF9, 0xCF, 0x3C, 0xF3, 0xE6, 0x7F, 0x0F, 0xF9, 0xFF, 0x9F, 0xF0, 0xFE, 0x67, 0xCF,
+	0x3C, 0xF3, 0x9F, 0x99, 0xF9, 0xFF, 0xFF, 0xFF,
+	/* 45 'Y' */
+	0x9F, 0x99, 0xF9, 0xCF, 0x3C, 0xF3, 0xE6, 0x7E, 0x67, 0xF0, 0xFF, 0x0F, 0xF9, 0xFF, 0x9F, 0xF9,
+	0xFF, 0x9F, 0xF9, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF,
+	/* 46 'Z' */
+	0x80, 0x18, 0x01, 0xFF, 0x3F, 0xF3, 0xFE, 0x7F, 0xCF, 0xF9, 0xFF, 0x9F, 0xF3, 0xFE, 0x7F, 0xCF,
+	0xFC, 0xFF, 0x80, 0x18, 0x01, 0xFF, 0xFF, 0xFF,
+	/* 47 '[' */
+	0xE0, 0x7E, 0x07, 0xE7, 0xFE, 0x7F, 0xE7, 0xFE, 0x7F, 0xE7, 0xFE, 0x7F, 0xE7, 0xFE, 0x7F, 0xE7,
+	0xFE, 0x7F, 0xE0, 0x7E, 0x07, 0xFF, 0xFF, 0xFF,
+	/* 48 0x5C */
+	0xFF, 0xFB, 0xFF, 0x9F, 0xF8, 0xFF, 0xC7, 0xFE, 0x3F, 0xF1, 0xFF, 0x8F, 0xFC, 0x7F, 0xE3, 0xFF,
+	0x1F, 0xF8, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF,
+	/* 49 ']' */
+	0xE0, 0x7E, 0x07, 0xFE, 0x7F, 0xE7, 0xFE, 0x7F, 0xE7, 0xFE, 0x7F, 0xE7, 0xFE, 0x7F, 0xE7, 0xFE,
+	0x7F, 0xE7, 0xE0, 0x7E, 0x07, 0xFF, 0xFF, 0xFF,
+	/* 50 '^' */
+	0xFD, 0xFF, 0x8F, 0xF0, 0x7E, 0x23, 0xC7, 0x18, 0xF8, 0x9F, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	/* 51 '_' */
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x08, 0x00,
+	/* 52 'a' */
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x03, 0xC0, 0x1F, 0xF9, 0xE0, 0x1C, 0x01, 0x9F,
+	0x99, 0xF9, 0x80, 0x1C, 0x01, 0xFF, 0xFF, 0xFF,
+	/* 53 'c' */
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x07, 0xC0, 0x38, 0xF9, 0x9F, 0xF9, 0xFF, 0x9F,
+	0xF8, 0xF9, 0xC0, 0x3E, 0x07, 0xFF, 0xFF, 0xFF,
+	/* 54 'd' */
+	0xFF, 0x9F, 0xF9, 0xFF, 0x9F, 0xF9, 0xFF, 0x9E, 0x09, 0xC0, 0x18, 0xE1, 0x9F, 0x99, 0xF9, 0x9F,
+	0x98, 0xF9, 0xC0, 0x1E, 0x01, 0xFF, 0xFF, 0xFF,
+	/* 55 'e' */
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x07, 0xC0, 0x38, 0xF9, 0x80, 0x18, 0x03, 0x9F,
+	0xF8, 0xFF, 0xC0, 0x3E, 0x07, 0xFF, 0xFF, 0xFF,
+	/* 56 'f' */
+	0xF8, 0x7F, 0x07, 0xE3, 0xFE, 0x7F, 0xE7, 0xFE, 0x7F, 0x80, 0xF8, 0x0F, 0xE7, 0xFE, 0x7F, 0xE7,
+	0xFE, 0x7F, 0xE7, 0xFE, 0x7F, 0xFF, 0xFF, 0xFF,
+	/* 57 'g' */
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x01, 0xC0, 0x18, 0xF9, 0x9F, 0x98, 0xF1, 0xC0,
+	0x1E, 0x09, 0xFF, 0x9F, 0xF1, 0xC0, 0x3C, 0x07,
+	/* 58 'h' */
+	0x9F, 0xF9, 0xFF, 0x9F, 0xF9, 0xFF, 0x9F, 0xF9, 0x0F, 0x80, 0x78, 0xE3, 0x9F, 0x39, 0xF3, 0x9F,
+	0x39, 0xF3, 0x9F, 0x39, 0xF3, 0xFF, 0xFF, 0xFF,
+	/* 59 'i' */
+	0xFF, 0xFF, 0xFF, 0xF9, 0xFF, 0x9F, 0xFF, 0xFF, 0x1F, 0xF1, 0xFF, 0x9F, 0xF9, 0xFF, 0x9F, 0xF9,
+	0xFF, 0x9F, 0xE0, 0x7E, 0x07, 0xFF, 0xFF, 0xFF,
+	/* 60 'l' */
+	0xF1, 0xFF, 0x1F, 0xF9, 0xFF, 0x9F, 0xF9, 0xFF, 0x9F, 0xF9, 0xFF, 0x9F, 0xF9, 0xFF, 0x9F, 0xF9,
+	0xFF, 0x9F, 0xE0, 0x7E, 0x07, 0xFF, 0xFF, 0xFF,
+	/* 61 'm' */
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x67, 0x80, 0x38, 0x01, 0x99, 0x99, 0x99, 0x99,
+	0x99, 0x99, 0x99, 0x99, 0x99, 0xFF, 0xFF, 0xFF,
+	/* 62 'n' */
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x07, 0xC0, 0x3C, 0xF1, 0xCF, 0x9C, 0xF9, 0xCF,
+	0x9C, 0xF9, 0xCF, 0x9C, 0xF9, 0xFF, 0xFF, 0xFF,
+	/* 63 'o' */
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x07, 0xC0, 0x38, 0xF1, 0x9F, 0x99, 0xF9, 0x9F,
+	0x98, 0xF1, 0xC0, 0x3E, 0x07, 0xFF, 0xFF, 0xFF,
+	/* 64 'p' */
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x07, 0x80, 0x39, 0xF1, 0x9F, 0x99, 0xF9, 0x8F,
+	0x18, 0x03, 0x90, 0x79, 0xFF, 0x9F, 0xF9, 0xFF,
+	/* 65 'r' */
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x83, 0xC0, 0x1C, 0x79, 0xCF, 0xFC, 0xFF, 0xCF,
+	0xFC, 0xFF, 0xCF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF,
+	/* 66 's' */
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x0F, 0x80, 0x79, 0xFF, 0x80, 0xFC, 0x07, 0xFE,
+	0x7F, 0xE7, 0x80, 0x7C, 0x0F, 0xFF, 0xFF, 0xFF,
+	/* 67 't' */
+	0xFF, 0xFE, 0x7F, 0xE7, 0xFE, 0x7F, 0xE7, 0xF8, 0x0F, 0x80, 0xFE, 0x7F, 0xE7, 0xFE, 0x7F, 0xE7,
+	0xFE, 0x7F, 0xE0, 0x7F, 0x07, 0xFF, 0xFF, 0xFF,
+	/* 68 'v' */
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0xF9, 0x9F, 0x9C, 0xF3, 0xCF, 0x3E, 0x67, 0xE6,
+	0x7F, 0x0F, 0xF0, 0xFF, 0x9F, 0xFF, 0xFF, 0xFF,
+	/* 69 'w' */
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x90,
+	0x9C, 0x03, 0xC6, 0x3E, 0xF7, 0xFF, 0xFF, 0xFF,
+	/* 70 'y' */
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xF3, 0xCF, 0x3E, 0x67, 0xE6, 0x7F, 0x0F, 0xF0,
+	0xFF, 0x9F, 0xF9, 0xFF, 0x3F, 0xF3, 0xFE, 0x7F,
+	/* 71 '{' */
+	0xFC, 0x3F, 0x83, 0xF1, 0xFF, 0x3F, 0xF3, 0xFF, 0x3F, 0xE3, 0xFC, 0x7F, 0xE3, 0xFF, 0x3F, 0xF3,
+	0xFF, 0x3F, 0xF1, 0xFF, 0x83, 0xFC, 0x3F, 0xFF,
+	/* 72 '}' */
+	0xC3, 0xFC, 0x1F, 0xF8, 0xFF, 0xCF, 0xFC, 0xFF, 0xCF, 0xFC, 0x7F, 0xE3, 0xFC, 0x7F, 0xCF, 0xFC,
+	0xFF, 0xCF, 0xF8, 0xFC, 0x1F, 0xC3, 0xFF, 0xFF,
+	/* 73 0xB3 */
+	0xF9, 0xFF, 0x9F, 0xF9, 0xFF, 0x9F, 0xF9, 0xFF, 0x9F, 0xF9, 0xFF, 0x9F, 0xF9, 0xFF, 0x9F, 0xF9,
+	0xFF, 0x9F, 0xF9, 0xFF, 0x9F, 0xF9, 0xFF, 0x9F,
+	/* 74 0xBA */
+	0xC9, 0xFC, 0x9F, 0xC9, 0xFC, 0x9F, 0xC9, 0xFC, 0x9F, 0xC9, 0xFC, 0x9F, 0xC9, 0xFC, 0x9F, 0xC9,
+	0xFC, 0x9F, 0xC9, 0xFC, 0x9F, 0xC9, 0xFC, 0x9F,
+	/* 75 0xBB */
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0xF0, 0x1F, 0xF9, 0xF0, 0x9F, 0x09,
+	0xFC, 0x9F, 0xC9, 0xFC, 0x9F, 0xC9, 0xFC, 0x9F,
+	/* 76 0xBC */
+	0xC9, 0xFC, 0x9F, 0xC9, 0xFC, 0x9F, 0xC9, 0xFC, 0x9F, 0x09, 0xF0, 0x9F, 0xF9, 0xF0, 0x1F, 0x01,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	/* 77 0xBF */
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x1F, 0x01, 0xFF, 0x9F, 0xF9,
+	0xFF, 0x9F, 0xF9, 0xFF, 0x9F, 0xF9, 0xFF, 0x9F,
+	/* 78 0xC0 */
+	0xF9, 0xFF, 0x9F, 0xF9, 0xFF, 0x9F, 0xF9, 0xFF, 0x9F, 0xF9, 0xFF, 0x80, 0xF8, 0x0F, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	/* 79 0xC4 */
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	/* 80 0xC8 */
+	0xC9, 0xFC, 0x9F, 0xC9, 0xFC, 0x9F, 0xC9, 0xFC, 0x9F, 0xC8, 0x0C, 0x80, 0xCF, 0xFC, 0x00, 0xC0,
+	0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	/* 81 0xC9 */
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x0C, 0x00, 0xCF, 0xFC, 0x80, 0xC8,
+	0x0C, 0x9F, 0xC9, 0xFC, 0x9F, 0xC9, 0xFC, 0x9F,
+	/* 82 0xCD */
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00,
+	0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	/* 83 0xD9 */
+	0xF9, 0xFF, 0x9F, 0xF9, 0xFF, 0x9F, 0xF9, 0xFF, 0x9F, 0xF9, 0xF0, 0x1F, 0x01, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	/* 84 0xDA */
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xF8, 0x0F, 0x9F, 0xF9,
+	0xFF, 0x9F, 0xF9, 0xFF, 0x9F, 0xF9, 0xFF, 0x9F,
+};
+
+#endif
@@ -0,0 +1,253 @@
+# Font compiler for the CH32V003 projects
+#
+# Reads a font from a C header (a table of hex bytes, a glyph after the
+# other) and writes a header with only the glyphs a program uses, in the
+# layout its driver needs:
+#
+#   rows    one or two bytes per row, MSB = leftmost pixel
+#   cols    pages of 8 rows, a byte per column, LSB = top row (SSD1306)
+#   packed  rows of exactly W bits, one after the other (12x16 in 24 bytes)
+#
+# The used characters come from the string literals of the source files
+# (--scan; the arguments of printf and puts go to the serial port and are
+# left out) and from lists of codes (--codes). The output has a map from
+# character code to glyph, NAME_GLYPH(c) gives the glyph number; characters
+# not in the subset are drawn as the first glyph (space, if used).
+#
+# Use: python3 fontc.py --font font_8x8.h --size 8x8 --layout rows
+#                       --name fontdata --scan epaper.c --codes 0xB3 -o out.h
+
+import argparse
+import re
+import sys
+
+def strip_comments(text):
+    text = re.sub(r'/\*.*?\*/', ' ', text, flags=re.S)
+    return re.sub(r'//[^\n]*', ' ', text)
+
+def read_font(fname, w, h, src_layout, first, inverted):
+    """returns a dict code -> list of h rows of w bits, 1 = ink"""
+    with open(fname, 'rb') as f:
+        text = strip_comments(f.read().decode('latin-1'))
+    start = text.find('{')
+    data = [int(v, 16) for v in re.findall(r'0[xX]([0-9a-fA-F]{1,2})\b', text[start:])]
+    if src_layout == 'rows':
+        bpr = (w + 7) // 8
+        size = bpr * h
+    else:
+        size = ((h + 7) // 8) * w
+    if len(data) % size:
+        sys.exit(f'{fname}: {len(data)} bytes is not a multiple of {size}')
+    glyphs = {}
+    for g in range(len(data) // size):
+        b = data[g*size:(g+1)*size]
+        rows = []
+        for y in range(h):
+            if src_layout == 'rows':
+                v = 0
+                for k in range(bpr):
+                    v = (v << 8) | b[y*bpr + k]
+                v >>= bpr*8 - w
+            else:
+                v = 0
+                for x in range(w):
+                    if (b[(y // 8)*w + x] >> (y % 8)) & 1:
+                        v |= 1 << (w - 1 - x)
+            if inverted:
+                v ^= (1 << w) - 1
+            rows.append(v)
+        glyphs[first + g] = rows
+    return glyphs
+
+def scan_literals(fname):
+    """characters in the string and char literals of a C file"""
+    with open(fname, 'rb') as f:
+        text = f.read().decode('latin-1')
+    text = re.sub(r'/\*.*?\*/', ' ', text, flags=re.S)
+    text = re.sub(r'//[^\n]*', ' ', text)
+    text = re.sub(r'#\s*include[^\n]*', ' ', text)
+    # messages on the serial port, not on the display
+    text = re.sub(r'(?<![\w.>])(?:printf|puts)\s*\((?:"(?:[^"\\\n]|\\.)*"|[^;"])*\)\s*;', ' ', text)
+    chars = set()
+    escapes = {'n': 10, 'r': 13, 't': 9, '0': 0, '\\': 92, '"': 34, "'": 39}
+    for lit in re.findall(r'"((?:[^"\\\n]|\\.)*)"|\'((?:[^\'\\\n]|\\.)+)\'', text):
+        s = lit[0] or lit[1]
+        i = 0
+        while i < len(s):
+            if s[i] == '\\' and i + 1 < len(s):
+                m = re.match(r'x([0-9a-fA-F]{1,2})', s[i+1:])
+                if m:
+                    chars.add(int(m.group(1), 16))
+                    i += 2 + len(m.group(1))
+                    continue
+                chars.add(escapes.get(s[i+1], ord(s[i+1])))
+                i += 2
+                continue
+            chars.add(ord(s[i]))
+            i += 1
+    # control characters are not glyphs
+    return {c for c in chars if c >= 32}
+
+def parse_codes(spec):
+    codes = set()
+    for part in spec.split(','):
+        part = part.strip()
+        if not part:
+            continue
+        if '-' in part:
+            a, b = part.split('-', 1)
+            codes.update(range(int(a, 0), int(b, 0) + 1))
+        else:
+            codes.add(int(part, 0))
+    return codes
+
+def encode(rows, w, h, layout, inverted):
+    mask = (1 << w) - 1
+    if inverted:
+        rows = [r ^ mask for r in rows]
+    out = []
+    if layout == 'rows':
+        bpr = (w + 7) // 8
+        for r in rows:
+            v = r << (bpr*8 - w)
+            if inverted:
+                # padding bits stay 0
+                v &= ((1 << w) - 1) << (bpr*8 - w)
+            out += [(v >> (8*(bpr - 1 - k))) & 0xFF for k in range(bpr)]
+    elif layout == 'cols':
+        for p in range((h + 7) // 8):
+            for x in range(w):
+                b = 0
+                for i in range(8):
+                    y = p*8 + i
+                    if y < h and (rows[y] >> (w - 1 - x)) & 1:
+                        b |= 1 << i
+                out.append(b)
+    else:
+        bits = 0
+        n = 0
+        for r in rows:
+            bits = (bits << w) | r
+            n += w
+        pad = (-n) % 8
+        bits <<= pad
+        n += pad
+        out = [(bits >> (n - 8*(k+1))) & 0xFF for k in range(n // 8)]
+    return out
+
+def c_bytes(data, per_line, indent='\t'):
+    lines = []
+    for i in range(0, len(data), per_line):
+        lines.append(indent + ', '.join(f'0x{b:02X}' for b in data[i:i+per_line]) + ',')
+    return lines
+
+def char_name(c):
+    if 32 <= c < 127 and c not in (ord('*'), ord('/'), ord('\\')):
+        return f"'{chr(c)}'"
+    return f'0x{c:02X}'
+
+def compile_font(args):
+    w, h = (int(v) for v in args.size.lower().split('x'))
+    if args.layout == 'packed' and (w * h) % 8:
+        sys.exit('packed layout needs w*h multiple of 8')
+    glyphs = read_font(args.font, w, h, args.src_layout, args.src_first, args.src_inverted)
+
+    if args.all:
+        used = sorted(glyphs)
+    else:
+        used = set()
+        for f in args.scan or []:
+            used |= scan_literals(f)
+        used |= parse_codes(args.codes or '')
+        used.add(32)
+        missing = sorted(c for c in used if c not in glyphs)
+        if missing:
+            sys.exit('no glyph for ' + ', '.join(char_name(c) for c in missing))
+        # space first, so unknown characters are blank
+        used = [32] + sorted(c for c in used if c != 32)
+
+    enc = [encode(glyphs[c], w, h, args.layout, args.inverted) for c in used]
+    gsize = len(enc[0])
+    NAME = args.name.upper()
+
+    out = []
+    out.append('/*')
+    out.append(f' * {args.name}: {len(used)} glyphs {w}x{h} from {args.font}, layout {args.layout}')
+    out.append(' * generated by CH32V003/fonts/fontc.py, do not edit')
+    out.append(' */')
+    out.append('')
+    out.append(f'#ifndef _{NAME}_H')
+    out.append(f'#define _{NAME}_H')
+    out.append('')
+    out.append(f'#define {NAME}_W {w}')
+    out.append(f'#define {NAME}_H {h}')
+    out.append(f'#define {NAME}_BYTES {gsize}\t\t// bytes per glyph')
+    out.append(f'#define {NAME}_COUNT {len(used)}')
+
+    mapsize = 0
+    if args.all and used == list(range(used[0], used[0] + len(used))):
+        first = used[0]
+        out.append(f'#define {NAME}_GLYPH(c) ((uint8_t)(c) - {first})')
+    else:
+        first = min(used)
+        last = max(used)
+        mapsize = last - first + 1
+        index = {c: i for i, c in enumerate(used)}
+        cmap = [index.get(c, 0) for c in range(first, last + 1)]
+        out.append(f'#define {NAME}_FIRST {first}')
+        out.append(f'#define {NAME}_LAST {last}')
+        out.append(f'#define {NAME}_GLYPH(c) {args.name}_glyph(c)')
+        out.append('')
+        out.append('// glyph for each character code')
+        out.append(f'const uint8_t {args.name}_map[] = {{')
+        out += c_bytes(cmap, 16)
+        out.append('};')
+        out.append('')
+        out.append(f'static inline uint8_t {args.name}_glyph(uint8_t c)')
+        out.append('{')
+        if first:
+            out.append(f'\tif((c < {NAME}_FIRST) || (c > {NAME}_LAST))')
+        else:
+            out.append(f'\tif(c > {NAME}_LAST)')
+        out.append('\t\treturn 0;')
+        out.append(f'\treturn {args.name}_map[c - {NAME}_FIRST];')
+        out.append('}')
+    out.append('')
+
+    datasize = gsize * len(used)
+    out.append(f'const uint8_t {args.name}[] = {{')
+    for i, c in enumerate(used):
+        out.append(f'\t/* {i} {char_name(c)} */')
+        out += c_bytes(enc[i], min(16, gsize))
+    out.append('};')
+    out.append('')
+    out.append('#endif')
+    out.append('')
+
+    with open(args.output, 'w', newline='\n') as f:
+        f.write('\n'.join(out))
+
+    total = datasize + mapsize
+    return {'glyphs': len(used), 'data': datasize, 'map': mapsize, 'total': total}
+
+def arg_parser():
+    ap = argparse.ArgumentParser(description='font compiler for the CH32V003 projects')
+    ap.add_argument('--font', required=True, help='source font (C header)')
+    ap.add_argument('--size', required=True, help='glyph size, WxH')
+    ap.add_argument('--src-layout', choices=('rows', 'cols'), default='rows')
+    ap.add_argument('--src-first', type=lambda v: int(v, 0), default=0, help='code of the first glyph')
+    ap.add_argument('--src-inverted', action='store_true', help='0 bits are ink in the source')
+    ap.add_argument('--layout', choices=('rows', 'cols', 'packed'), default='rows')
+    ap.add_argument('--inverted', action='store_true', help='0 bits are ink in the output')
+    ap.add_argument('--name', required=True, help='name of the table')
+    ap.add_argument('--scan', nargs='*', help='C files with the text to show')
+    ap.add_argument('--codes', help='more characters, like 0-3,0xB3')
+    ap.add_argument('--all', action='store_true', help='all the glyphs, no subset')
+    ap.add_argument('-o', '--output', required=True)
+    return ap
+
+if __name__ == '__main__':
+    args = arg_parser().parse_args()
+    r = compile_font(args)
+    print(f"{args.output}: {r['glyphs']} glyphs, {r['total']} bytes "
+          f"(data {r['data']}, map {r['map']})")
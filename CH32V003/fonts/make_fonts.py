@@ -0,0 +1,65 @@
+# Generates the font headers of the projects with fontc.py and
+# pfontc.py, all from the source fonts in this directory, and reports the
+# flash used by each.
+#
+# Use (from this directory): python3 make_fonts.py
+
+import os
+from fontc import arg_parser, compile_font
+import pfontc
+
+# project, full font table it used before (bytes), fontc arguments
+PROJECTS = [
+    ('ringdemo', 2048, [
+        '--font', '../fonts/font_8x8.h', '--size', '8x8',
+        '--layout', 'cols', '--all', '--name', 'fontdata_col',
+        '-o', '../ringdemo/font_8x8_col.h']),
+    ('epaper', 2048, [
+        '--font', '../fonts/font_8x8.h', '--size', '8x8',
+        '--layout', 'rows', '--name', 'fontdata',
+        '--scan', '../epaper/epaper.c', '--codes', '0xB3,0xBF,0xC0,0xC4,0xD9,0xDA',
+        '-o', '../epaper/font_8x8_sub.h']),
+    ('epaper12', 4096, [
+        '--font', '../fonts/font_12x16.h', '--size', '12x16', '--src-inverted',
+        '--layout', 'packed', '--inverted', '--name', 'console_font_12x16',
+        '--scan', '../epaper12/epaper12.c',
+        '--codes', '0xB3,0xBA,0xBB,0xBC,0xBF,0xC0,0xC4,0xC8,0xC9,0xCD,0xD9,0xDA',
+        '-o', '../epaper12/font_12x16_sub.h']),
+]
+
+# proportional fonts: name, pfontc arguments
+PFONTS = [
+    ('ringdemo/font_prop8', [
+        '--font', '../fonts/font_8x8.h', '--size', '8x8', '--bpp', '1', '--all',
+        '--name', 'font_prop8', '-o', '../ringdemo/font_prop8.h']),
+    ('ringdemo/font_prop16', [
+        '--font', '../fonts/font_8x8.h', '--size', '8x8', '--bpp', '1', '--scale', '2',
+        '--chars', '0123456789.,:-+%CF ', '--name', 'font_prop16',
+        '-o', '../ringdemo/font_prop16.h']),
+    ('Demo/font_title', [
+        '--font', '../fonts/font_12x16.h', '--size', '12x16', '--src-inverted',
+        '--bpp', '4', '--scale', '2', '--scan', '../../ESP32C6_LCD_147/Demo/Demo.ino',
+        '--name', 'font_title', '-o', '../../ESP32C6_LCD_147/Demo/font_title.h']),
+    ('Zigbee_Thermostat/font_status', [
+        '--font', '../fonts/font_12x16.h', '--size', '12x16', '--src-inverted',
+        '--bpp', '4', '--scan', '../../ESP32C6_LCD_147/Zigbee_Thermostat/Zigbee_Thermostat.ino',
+        '--name', 'font_status', '-o', '../../ESP32C6_LCD_147/Zigbee_Thermostat/font_status.h']),
+    ('Zigbee_Thermostat/font_temp', [
+        '--font', '../fonts/font_12x16.h', '--size', '12x16', '--src-inverted',
+        '--bpp', '4', '--scale', '2', '--chars', '0123456789.-C', '--name', 'font_temp',
+        '-o', '../../ESP32C6_LCD_147/Zigbee_Thermostat/font_temp.h']),
+]
+
+os.chdir(os.path.dirname(os.path.abspath(__file__)))
+ap = arg_parser()
+print(f"{'project':10} {'glyphs':>6} {'before':>7} {'after':>7} {'saved':>7}")
+for name, before, argv in PROJECTS:
+    r = compile_font(ap.parse_args(argv))
+    print(f"{name:10} {r['glyphs']:6} {before:7} {r['total']:7} {before - r['total']:7}")
+
+print()
+pap = pfontc.arg_parser()
+print(f"{'proportional font':30} {'glyphs':>6} {'data':>6} {'tables':>7} {'kerning':>8} {'total':>6}")
+for name, argv in PFONTS:
+    r = pfontc.compile_pfont(pap.parse_args(argv))
+    print(f"{name:30} {r['glyphs']:6} {r['data']:6} {r['table']:7} {r['kern']:8} {r['total']:6}")
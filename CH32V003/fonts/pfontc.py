@@ -0,0 +1,357 @@
+# Proportional font compiler
+#
+# Builds a proportional font from a fixed-cell bitmap font: the empty
+# columns at the sides of each glyph are removed, the advance becomes the
+# glyph width plus a spacing, and a kerning table moves pairs closer when
+# their shapes leave room (like "T." or "To"). Glyphs can be scaled up by
+# 2, 4 or 8 with Scale2x (EPX), which rounds the diagonals instead of
+# making blocks.
+#
+#   --bpp 1   pages of 8 rows, a byte per column, LSB = top row (SSD1306)
+#   --bpp 4   anti-aliased: the glyph is scaled to 8x by Scale2x and then
+#             each block of pixels is averaged to 16 levels of coverage;
+#             stored as runs along the rows, a byte per run with the
+#             level in the high nybble and the length-1 in the low one
+#
+# The header also has the pfont_t type and the lookup functions shared by
+# the renderers (ssd1306_pfont.h, pfont_aa.h).
+#
+# Use: python3 pfontc.py --font font_8x8.h --size 8x8 --bpp 1
+#                        --name font_prop8 -o font_prop8.h
+
+import argparse
+import sys
+from fontc import read_font, scan_literals, parse_codes, char_name, c_bytes
+
+def scale2x(img):
+    """one pass of Scale2x (EPX) on a list of rows of 0/1"""
+    h = len(img)
+    w = len(img[0])
+    get = lambda x, y: img[y][x] if 0 <= x < w and 0 <= y < h else 0
+    out = [[0] * (2*w) for _ in range(2*h)]
+    for y in range(h):
+        for x in range(w):
+            p = img[y][x]
+            a, b, c, d = get(x, y-1), get(x+1, y), get(x-1, y), get(x, y+1)
+            e = [p, p, p, p]
+            if c == a and c != d and a != b:
+                e[0] = a
+            if a == b and a != c and b != d:
+                e[1] = b
+            if d == c and d != b and c != a:
+                e[2] = c
+            if b == d and b != a and d != c:
+                e[3] = d
+            out[2*y][2*x], out[2*y][2*x+1] = e[0], e[1]
+            out[2*y+1][2*x], out[2*y+1][2*x+1] = e[2], e[3]
+    return out
+
+def render(rows, w, bpp, scale):
+    """returns the glyph as rows of levels: 0/1 for bpp 1, 0..15 for bpp 4"""
+    img = [[(r >> (w - 1 - x)) & 1 for x in range(w)] for r in rows]
+    if bpp == 1:
+        while scale > 1:
+            img = scale2x(img)
+            scale //= 2
+        return img
+    for _ in range(3):
+        img = scale2x(img)
+    box = 8 // scale
+    out = []
+    for y in range(0, len(img), box):
+        line = []
+        for x in range(0, len(img[0]), box):
+            s = sum(img[y+j][x+i] for j in range(box) for i in range(box))
+            line.append((s * 15 + box*box // 2) // (box*box))
+        out.append(line)
+    return out
+
+def trim(img):
+    """columns with ink: (first, last), None if empty"""
+    cols = [x for x in range(len(img[0])) if any(r[x] for r in img)]
+    return (cols[0], cols[-1]) if cols else None
+
+def encode(img, bpp):
+    h = len(img)
+    w = len(img[0]) if h else 0
+    out = []
+    if bpp == 1:
+        for p in range((h + 7) // 8):
+            for x in range(w):
+                b = 0
+                for i in range(8):
+                    y = p*8 + i
+                    if y < h and img[y][x]:
+                        b |= 1 << i
+                out.append(b)
+        return out
+    flat = [v for r in img for v in r]
+    i = 0
+    while i < len(flat):
+        n = 1
+        while i + n < len(flat) and flat[i + n] == flat[i] and n < 16:
+            n += 1
+        out.append((flat[i] << 4) | (n - 1))
+        i += n
+    return out
+
+def kerning(ga, gb, spacing, minimum, limit, solid):
+    """how much closer b can be drawn after a, keeping the normal gap;
+    pairs that would gain less than minimum are not kerned"""
+    a, b = ga['img'], gb['img']
+    if not ga['width'] or not gb['width']:
+        return 0
+    h = len(a)
+    right = [max((x for x in range(ga['width']) if a[y][x] >= solid), default=None) for y in range(h)]
+    left = [min((x for x in range(gb['width']) if b[y][x] >= solid), default=None) for y in range(h)]
+    gap = None
+    for y1 in range(h):
+        if right[y1] is None:
+            continue
+        # pixels on the row above and below count, so diagonals don't touch
+        for y2 in range(max(0, y1 - 1), min(h, y1 + 2)):
+            if left[y2] is None:
+                continue
+            g = ga['advance'] + left[y2] - right[y1] - 1
+            gap = g if gap is None else min(gap, g)
+    if gap is None or gap - spacing < minimum:
+        return 0
+    return -min(limit, gap - spacing)
+
+def compile_pfont(args):
+    w, h = (int(v) for v in args.size.lower().split('x'))
+    if args.scale not in (1, 2, 4, 8):
+        sys.exit('scale must be 1, 2, 4 or 8')
+    font = read_font(args.font, w, h, args.src_layout, args.src_first, args.src_inverted)
+
+    if args.all:
+        used = set(range(32, 127))
+    else:
+        used = set()
+        # only ASCII from the sources, other codes must be given
+        for f in args.scan or []:
+            used |= {c for c in scan_literals(f) if c < 127}
+        used |= parse_codes(args.codes or '')
+        used |= {ord(c) for c in args.chars or ''}
+    used.add(32)
+    missing = sorted(c for c in used if c not in font)
+    if missing:
+        sys.exit('no glyph for ' + ', '.join(char_name(c) for c in missing))
+    used = [32] + sorted(c for c in used if c != 32)
+
+    gh = h * args.scale
+    spacing = args.spacing if args.spacing is not None else args.scale
+    space = args.space if args.space is not None else (w * args.scale * 3) // 8
+    minimum = max(2, gh // 8)
+    limit = max(2, gh // 4)
+    solid = 1 if args.bpp == 1 else 8
+
+    glyphs = []
+    for c in used:
+        img = render(font[c], w, args.bpp, args.scale)
+        t = trim(img)
+        if t is None:
+            img = [[] for _ in img]
+            width, advance = 0, space
+        else:
+            img = [r[t[0]:t[1]+1] for r in img]
+            width = t[1] - t[0] + 1
+            advance = width + spacing
+        glyphs.append({'code': c, 'img': img, 'width': width, 'advance': advance})
+
+    kern = []
+    if not args.no_kern:
+        kc = set(ord(c) for c in KERN_CHARS)
+        for i, ga in enumerate(glyphs):
+            for j, gb in enumerate(glyphs):
+                if ga['code'] not in kc or gb['code'] not in kc:
+                    continue
+                dx = kerning(ga, gb, spacing, minimum, limit, solid)
+                if dx:
+                    kern.append((i, j, dx))
+
+    data = []
+    for g in glyphs:
+        g['offset'] = len(data)
+        data += encode(g['img'], args.bpp)
+    if len(data) > 0xFFFF:
+        sys.exit('font is too big')
+
+    first, last = used[0], used[-1]
+    contiguous = used == list(range(first, last + 1))
+    name = args.name
+    NAME = name.upper()
+
+    out = []
+    out.append('/*')
+    out.append(f' * {name}: {len(used)} proportional glyphs {gh} pixels high, {args.bpp} bpp')
+    out.append(f' * from {args.font} (scale {args.scale})')
+    out.append(' * generated by CH32V003/fonts/pfontc.py, do not edit')
+    out.append(' */')
+    out.append('')
+    out.append(f'#ifndef _{NAME}_H')
+    out.append(f'#define _{NAME}_H')
+    out.append('')
+    out += PFONT_TYPES.split('\n')
+    out.append('')
+    mapname = 'NULL'
+    if not contiguous:
+        index = {c: i for i, c in enumerate(used)}
+        out.append('// glyph for each character code')
+        out.append(f'const uint8_t {name}_map[] = {{')
+        out += c_bytes([index.get(c, 0) for c in range(first, last + 1)], 16)
+        out.append('};')
+        out.append('')
+        mapname = f'{name}_map'
+    out.append(f'const uint8_t {name}_data[] = {{')
+    for i, g in enumerate(glyphs):
+        out.append(f'\t/* {i} {char_name(g["code"])} */')
+        end = glyphs[i+1]['offset'] if i + 1 < len(glyphs) else len(data)
+        out += c_bytes(data[g['offset']:end], 16)
+    out.append('};')
+    out.append('')
+    out.append(f'const pfont_glyph_t {name}_glyphs[] = {{')
+    for g in glyphs:
+        out.append(f'\t{{ {g["offset"]}, {g["width"]}, {g["advance"]} }},\t/* {char_name(g["code"])} */')
+    out.append('};')
+    out.append('')
+    kname = 'NULL'
+    if kern:
+        out.append(f'const pfont_kern_t {name}_kern[] = {{')
+        for k in range(0, len(kern), 6):
+            out.append('\t' + ' '.join(f'{{ {a}, {b}, {dx} }},' for a, b, dx in kern[k:k+6]))
+        out.append('};')
+        out.append('')
+        kname = f'{name}_kern'
+    out.append(f'const pfont_t {name} = {{')
+    out.append(f'\t{gh}, {args.bpp}, {first}, {last}, {mapname},')
+    out.append(f'\t{name}_glyphs, {kname}, {len(kern)}, {name}_data')
+    out.append('};')
+    out.append('')
+    out.append('#endif')
+    out.append('')
+
+    with open(args.output, 'w', newline='\n') as f:
+        f.write('\n'.join(out))
+
+    sizes = {
+        'glyphs': len(used),
+        'data': len(data),
+        'table': 4 * len(glyphs) + (0 if contiguous else last - first + 1),
+        'kern': 3 * len(kern),
+    }
+    sizes['total'] = sizes['data'] + sizes['table'] + sizes['kern']
+    return sizes
+
+# only pairs of these are kerned, to keep the table small
+KERN_CHARS = ('ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz'
+              '0123456789.,:;-\'"')
+
+PFONT_TYPES = '''#ifndef _PFONT_TYPES
+#define _PFONT_TYPES
+
+#include <stdint.h>
+#include <stddef.h>
+
+typedef struct {
+	uint16_t offset;		// first byte in the data
+	uint8_t width;			// columns in the data
+	uint8_t advance;		// where the next glyph starts
+} pfont_glyph_t;
+
+typedef struct {
+	uint8_t left, right;	// glyphs, sorted by left and then right
+	int8_t dx;				// added to the advance of left
+} pfont_kern_t;
+
+typedef struct {
+	uint8_t height;			// rows in each glyph
+	uint8_t bpp;			// 1: pages of column bytes, 4: runs of level<<4 | (n-1)
+	uint8_t first, last;	// character codes
+	const uint8_t *map;		// glyph of each code from first, NULL if in order
+	const pfont_glyph_t *glyphs;
+	const pfont_kern_t *kern;
+	uint16_t nkern;
+	const uint8_t *data;
+} pfont_t;
+
+/*
+ * glyph for a character, characters not in the font use the space (0)
+ */
+static inline uint8_t pfont_glyph(const pfont_t *font, uint8_t c)
+{
+	if((c < font->first) || (c > font->last))
+		return 0;
+	return font->map ? font->map[c - font->first] : c - font->first;
+}
+
+/*
+ * kerning between two glyphs (binary search)
+ */
+static inline int8_t pfont_kern(const pfont_t *font, uint8_t left, uint8_t right)
+{
+	uint16_t lo = 0, hi = font->nkern;
+	uint16_t key = (left << 8) | right;
+
+	while(lo < hi)
+	{
+		uint16_t mid = (lo + hi) >> 1;
+		const pfont_kern_t *k = &font->kern[mid];
+		uint16_t v = (k->left << 8) | k->right;
+		if(v == key)
+			return k->dx;
+		if(v < key)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+	return 0;
+}
+
+/*
+ * width in pixels of a string, from the first to the last column drawn
+ */
+static inline int16_t pfont_width(const pfont_t *font, const char *str)
+{
+	int16_t w = 0;
+	uint8_t g, prev = 0xFF;
+
+	while(*str)
+	{
+		g = pfont_glyph(font, *str++);
+		if(prev != 0xFF)
+			w += font->glyphs[prev].advance + pfont_kern(font, prev, g);
+		prev = g;
+	}
+	if(prev != 0xFF)
+		w += font->glyphs[prev].width;
+	return w;
+}
+
+#endif'''
+
+def arg_parser():
+    ap = argparse.ArgumentParser(description='proportional font compiler')
+    ap.add_argument('--font', required=True, help='source font (C header)')
+    ap.add_argument('--size', required=True, help='glyph size in the source, WxH')
+    ap.add_argument('--src-layout', choices=('rows', 'cols'), default='rows')
+    ap.add_argument('--src-first', type=lambda v: int(v, 0), default=0, help='code of the first glyph')
+    ap.add_argument('--src-inverted', action='store_true', help='0 bits are ink in the source')
+    ap.add_argument('--bpp', type=int, choices=(1, 4), default=1)
+    ap.add_argument('--scale', type=int, default=1, help='1, 2, 4 or 8')
+    ap.add_argument('--spacing', type=int, help='pixels between glyphs (default: scale)')
+    ap.add_argument('--space', type=int, help='advance of the space')
+    ap.add_argument('--no-kern', action='store_true', help='no kerning table')
+    ap.add_argument('--name', required=True, help='name of the font')
+    ap.add_argument('--scan', nargs='*', help='C files with the text to show')
+    ap.add_argument('--codes', help='more characters, like 0-9,0x25')
+    ap.add_argument('--chars', help='more characters, as a string')
+    ap.add_argument('--all', action='store_true', help='all the ASCII characters (32 to 126)')
+    ap.add_argument('-o', '--output', required=True)
+    return ap
+
+if __name__ == '__main__':
+    args = arg_parser().parse_args()
+    r = compile_pfont(args)
+    print(f"{args.output}: {r['glyphs']} glyphs, {r['total']} bytes "
+          f"(data {r['data']}, tables {r['table']}, kerning {r['kern']})")
@@ -0,0 +1,178 @@
+/*
+ * Single-File-Header for continuous ADC sampling by DMA, with filtering
+ *
+ * The ADC converts a channel again and again (continuous mode) and DMA1
+ * channel 1 copies the results to a circular buffer of two halves. When a
+ * half is full (half transfer and transfer complete IRQs) its samples are
+ * added up: 4^n samples give n more bits (oversampling, works when the
+ * signal has a little noise, as the LM35 has), and that sum is a single
+ * sample at a lower rate (decimation). Then a median of the last 3 removes
+ * spikes and a first order IIR low pass filter, in fixed point, smooths
+ * what is left.
+ *
+ * The application reads the last filtered value with adc_dma_get(), which
+ * doesn't wait for anything. Values have ADC_DMA_BITS bits (10 + n).
+ *
+ * Define ADC_DMA_HOST to leave out the hardware and feed the filters with
+ * adc_dma_process() (see adcsim.c).
+ */
+
+#ifndef _ADC_DMA_H
+#define _ADC_DMA_H
+
+#include <stdint.h>
+
+// extra bits, a filtered sample is made of 4^n ADC samples
+#ifndef ADC_DMA_OS_BITS
+#define ADC_DMA_OS_BITS 2
+#endif
+
+// IIR filter, y += (x - y) / 2^shift; 0 turns it off
+#ifndef ADC_DMA_IIR_SHIFT
+#define ADC_DMA_IIR_SHIFT 3
+#endif
+
+// define as 0 to leave out the median of 3
+#ifndef ADC_DMA_MEDIAN
+#define ADC_DMA_MEDIAN 1
+#endif
+
+// ADC samples in a half of the buffer and bits of the values
+#define ADC_DMA_HALF (1 << (2*ADC_DMA_OS_BITS))
+#define ADC_DMA_BITS (10 + ADC_DMA_OS_BITS)
+
+// the DMA buffer
+volatile uint16_t adc_dma_buf[2*ADC_DMA_HALF];
+
+// last decimated samples, for the median, and the IIR filter, 8 bits
+// of fraction
+uint16_t adc_dma_hist[3];
+int32_t adc_dma_iir;
+volatile uint16_t adc_dma_value;
+volatile uint32_t adc_dma_count;		// filtered values made
+
+/*
+ * median of 3
+ */
+uint16_t adc_dma_median(uint16_t a, uint16_t b, uint16_t c)
+{
+	if(a > b)
+	{
+		uint16_t t = a;
+		a = b;
+		b = t;
+	}
+	// a <= b
+	return c <= a ? a : c >= b ? b : c;
+}
+
+/*
+ * make a filtered value from a half of the buffer
+ */
+void adc_dma_process(const volatile uint16_t *s)
+{
+	uint32_t sum = 0;
+	uint16_t x;
+
+	// oversampling and decimation, 10 + 2n bits down to 10 + n, rounded
+	for(uint16_t i=0;i<ADC_DMA_HALF;i++)
+		sum += s[i];
+	x = (sum + (1 << ADC_DMA_OS_BITS >> 1)) >> ADC_DMA_OS_BITS;
+
+	// the first value fills the filters
+	if(adc_dma_count == 0)
+	{
+		adc_dma_hist[0] = adc_dma_hist[1] = x;
+		adc_dma_iir = (int32_t)x << 8;
+	}
+#if ADC_DMA_MEDIAN
+	adc_dma_hist[2] = adc_dma_hist[1];
+	adc_dma_hist[1] = adc_dma_hist[0];
+	adc_dma_hist[0] = x;
+	x = adc_dma_median(adc_dma_hist[0], adc_dma_hist[1], adc_dma_hist[2]);
+#endif
+	adc_dma_iir += (((int32_t)x << 8) - adc_dma_iir) >> ADC_DMA_IIR_SHIFT;
+
+	adc_dma_value = (adc_dma_iir + 128) >> 8;
+	adc_dma_count++;
+}
+
+/*
+ * last filtered value, ADC_DMA_BITS bits
+ */
+uint16_t adc_dma_get(void)
+{
+	return adc_dma_value;
+}
+
+#ifndef ADC_DMA_HOST
+/*
+ * start sampling a channel, its pin must be an analog input
+ * the ADC clock is 48 MHz / 128 and samples take 241 + 11 cycles,
+ * about 1490 samples per second, so 1490 / 4^n filtered values
+ */
+void adc_dma_init(uint8_t channel)
+{
+	// ADCCLK = 375 kHz => RCC_ADCPRE = 11111: divide by 128
+	RCC->CFGR0 |= 0x1F<<11;
+
+	RCC->AHBPCENR |= RCC_AHBPeriph_DMA1;
+	RCC->APB2PCENR |= RCC_APB2Periph_ADC1;
+
+	// Reset the ADC to init all regs
+	RCC->APB2PRSTR |= RCC_APB2Periph_ADC1;
+	RCC->APB2PRSTR &= ~RCC_APB2Periph_ADC1;
+
+	// one channel, the longest sampling time
+	ADC1->RSQR1 = 0;
+	ADC1->RSQR2 = 0;
+	ADC1->RSQR3 = channel;	// 0-9 for 8 ext inputs and two internals
+	ADC1->SAMPTR2 |= 7<<(3*channel);
+
+	// turn on ADC, sw trigger
+	ADC1->CTLR2 |= ADC_ADON | ADC_EXTSEL;
+
+	// Reset calibration and calibrate
+	ADC1->CTLR2 |= ADC_RSTCAL;
+	while(ADC1->CTLR2 & ADC_RSTCAL);
+	ADC1->CTLR2 |= ADC_CAL;
+	while(ADC1->CTLR2 & ADC_CAL);
+
+	// DMA1 channel 1 is the ADC, loops over the two halves
+	DMA1_Channel1->PADDR = (uint32_t)&ADC1->RDATAR;
+	DMA1_Channel1->MADDR = (uint32_t)adc_dma_buf;
+	DMA1_Channel1->CNTR = 2*ADC_DMA_HALF;
+	DMA1_Channel1->CFGR =
+		DMA_M2M_Disable |
+		DMA_Priority_Medium |
+		DMA_MemoryDataSize_HalfWord |
+		DMA_PeripheralDataSize_HalfWord |
+		DMA_MemoryInc_Enable |
+		DMA_Mode_Circular |
+		DMA_DIR_PeripheralSRC |
+		DMA_IT_TC | DMA_IT_HT;
+	NVIC_EnableIRQ(DMA1_Channel1_IRQn);
+	DMA1_Channel1->CFGR |= DMA_CFGR1_EN;
+
+	// continuous conversion with DMA requests, started once
+	ADC1->CTLR2 |= ADC_CONT | ADC_DMA;
+	ADC1->CTLR2 |= ADC_SWSTART;
+}
+
+/*
+ * IRQ handler for DMA half transfer and transfer complete
+ */
+void DMA1_Channel1_IRQHandler(void) __attribute__((interrupt));
+void DMA1_Channel1_IRQHandler(void)
+{
+	uint32_t intfr = DMA1->INTFR;
+
+	DMA1->INTFCR = DMA1_IT_GL1;
+	if(intfr & DMA1_IT_HT1)
+		adc_dma_process(&adc_dma_buf[0]);
+	if(intfr & DMA1_IT_TC1)
+		adc_dma_process(&adc_dma_buf[ADC_DMA_HALF]);
+}
+#endif
+
+#endif
@@ -0,0 +1,194 @@
+/*
+ * ADC filter test - runs adc_dma.h on a PC
+ *
+ * Fills the halves of the DMA buffer with a synthetic signal, with noise
+ * and spikes, as the ADC would, and checks what the oversampling, the
+ * median and the IIR filter make of it.
+ *
+ * Build:   gcc -O2 -Wall -o adcsim adcsim.c -lm
+ *          (add -DADC_DMA_OS_BITS=n, -DADC_DMA_IIR_SHIFT=n or
+ *          -DADC_DMA_MEDIAN=0 to test other settings)
+ * Use:     ./adcsim
+ */
+
+#define ADC_DMA_HOST
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "adc_dma.h"
+
+// filtered values per second, ADC at 375 kHz, 252 cycles per sample
+#define RATE (375000.0 / 252 / ADC_DMA_HALF)
+
+// one LSB of the 10 bit ADC in filtered values
+#define SCALE (1 << ADC_DMA_OS_BITS)
+
+int errors;
+uint8_t half;
+
+/*
+ * normal noise, Box-Muller
+ */
+double gauss(double sigma)
+{
+	double u = (rand() + 1.0) / (RAND_MAX + 2.0);
+	double v = (rand() + 1.0) / (RAND_MAX + 2.0);
+	return sigma * sqrt(-2 * log(u)) * cos(2 * M_PI * v);
+}
+
+/*
+ * the ADC fills a half with the signal v (in LSB), noise and spikes
+ * of height spike one time in every, then the IRQ handles it
+ */
+uint16_t feed(double v, double sigma, int spike, int every)
+{
+	volatile uint16_t *s = &adc_dma_buf[half*ADC_DMA_HALF];
+
+	for(int i=0;i<ADC_DMA_HALF;i++)
+	{
+		double x = round(v + gauss(sigma));
+		if(every && (rand() % every == 0))
+			x += spike;
+		s[i] = x < 0 ? 0 : x > 1023 ? 1023 : x;
+	}
+	adc_dma_process(s);
+	half ^= 1;
+	return adc_dma_get();
+}
+
+void check_median(void)
+{
+	for(int a=0;a<4;a++)
+		for(int b=0;b<4;b++)
+			for(int c=0;c<4;c++)
+			{
+				int m = a + b + c - (a < b ? (a < c ? a : c) : (b < c ? b : c))
+					- (a > b ? (a > c ? a : c) : (b > c ? b : c));
+				if(adc_dma_median(a, b, c) != m)
+				{
+					printf("median of %d %d %d: %d\n", a, b, c, adc_dma_median(a, b, c));
+					errors++;
+				}
+			}
+}
+
+/*
+ * steps of a quarter LSB, a single sample can't see them
+ */
+void check_resolution(void)
+{
+	printf("input   single  filtered (in ADC LSB)\n");
+	for(double v=100;v<=101;v+=0.25)
+	{
+		double sum = 0;
+
+		adc_dma_count = 0;
+		for(int i=0;i<100;i++)
+			feed(v, 0.7, 0, 0);
+		for(int i=0;i<400;i++)
+			sum += feed(v, 0.7, 0, 0);
+		sum /= 400.0 * SCALE;
+		printf("%6.2f  %6.0f  %8.3f\n", v, round(v + gauss(0.7)), sum);
+		if(fabs(sum - v) > 0.5 / SCALE)
+		{
+			printf("  more than half a filtered LSB off\n");
+			errors++;
+		}
+	}
+}
+
+/*
+ * noise of the filtered values against single samples
+ */
+void check_noise(double sigma)
+{
+	double sum = 0, sum2 = 0, raw = 0, raw2 = 0;
+	int n = 2000;
+
+	adc_dma_count = 0;
+	for(int i=0;i<100;i++)
+		feed(400, sigma, 0, 0);
+	for(int i=0;i<n;i++)
+	{
+		double y = feed(400, sigma, 0, 0) / (double)SCALE;
+		double x = adc_dma_buf[(half^1)*ADC_DMA_HALF];
+		sum += y;
+		sum2 += y*y;
+		raw += x;
+		raw2 += x*x;
+	}
+	double sy = sqrt(sum2/n - (sum/n)*(sum/n));
+	double sx = sqrt(raw2/n - (raw/n)*(raw/n));
+	printf("noise %.1f LSB: single samples %.3f LSB, filtered %.3f LSB (%.1f bits better)\n",
+		sigma, sx, sy, log2(sx / sy));
+	if(sy > sx / 3)
+	{
+		printf("  the filters don't take out enough noise\n");
+		errors++;
+	}
+}
+
+/*
+ * values more than 1 LSB off with spikes in the samples
+ */
+void check_spikes(void)
+{
+	int off = 0, n = 4000;
+
+	adc_dma_count = 0;
+	for(int i=0;i<100;i++)
+		feed(300, 0.7, 0, 0);
+	for(int i=0;i<n;i++)
+		if(fabs(feed(300, 0.7, 400, 1000) / (double)SCALE - 300) > 1)
+			off++;
+	printf("spikes of 400 LSB in 1 of 1000 samples: %.2f%% of the values more than 1 LSB off\n",
+		off * 100.0 / n);
+#if ADC_DMA_MEDIAN
+	// spikes in values next to each other (or one apart) get through,
+	// and the IIR spreads them
+	if(off > n / 50)
+	{
+		printf("  the median should take out most spikes\n");
+		errors++;
+	}
+#endif
+}
+
+/*
+ * filtered values until 90% of a step
+ */
+void check_step(void)
+{
+	int n;
+
+	adc_dma_count = 0;
+	for(int i=0;i<100;i++)
+		feed(200, 0.7, 0, 0);
+	for(n=1;n<1000;n++)
+		if(feed(600, 0.7, 0, 0) >= 560*SCALE)
+			break;
+	printf("step of 400 LSB: 90%% after %d values, %.0f ms\n", n, n * 1000 / RATE);
+	// median adds one, the IIR ln(0.1)/ln(1 - 2^-shift)
+	if(n > 2 + ceil(log(0.1) / log(1 - 1.0 / (1 << ADC_DMA_IIR_SHIFT))))
+	{
+		printf("  too slow\n");
+		errors++;
+	}
+}
+
+int main(void)
+{
+	srand(1);
+	printf("%d samples per value, %.1f values per second, %d bits\n",
+		ADC_DMA_HALF, RATE, ADC_DMA_BITS);
+	check_median();
+	check_resolution();
+	check_noise(0.7);
+	check_noise(3);
+	check_spikes();
+	check_step();
+	printf(errors ? "%d errors\n" : "ok\n", errors);
+	return errors ? 1 : 0;
+}
@@ -0,0 +1,284 @@
+/*
+ * LED animation test - runs ws2812_anim.h on a PC
+ *
+ * Checks the easing curves, tracks, palettes and blending against floating
+ * point versions, then renders the ringdemo animation as a strip, a frame
+ * per row, as text or as a PPM image that can be saved and compared later.
+ *
+ * Build:   gcc -O2 -Wall -o animsim animsim.c -lm
+ *          (add -DWS2812_FB_LEDS=n for other rings)
+ * Use:     ./animsim           run the checks
+ *          ./animsim -t n      print n frames, a 0xRRGGBB per LED
+ *          ./animsim -w file   save the strip as PPM (8x2 pixels per LED)
+ *          ./animsim -c file   compare the strip with a PPM saved before
+ */
+
+#define WS2812_FB_HOST
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "ws2812_fb.h"
+#include "ws2812_anim.h"
+#include "ringdemo_anim.h"
+
+// frames in the strip, a turn of the glow
+#define STRIP_FRAMES 240
+#define STRIP_W (WS2812_FB_LEDS*8)
+#define STRIP_H (STRIP_FRAMES*2)
+
+uint8_t strip[STRIP_H][STRIP_W][3];
+
+int errors;
+
+void fail(const char *what, int a, int b, int c)
+{
+	printf("%s: %d %d %d\n", what, a, b, c);
+	errors++;
+}
+
+/*
+ * easing curves in floating point
+ */
+double ease_ref(uint8_t ease, double u)
+{
+	switch(ease)
+	{
+	case ANIM_IN:
+		return u*u;
+	case ANIM_OUT:
+		return 1 - (1-u)*(1-u);
+	case ANIM_INOUT:
+		return u*u*(3 - 2*u);
+	case ANIM_STEP:
+		return 0;
+	}
+	return u;
+}
+
+void check_ease(void)
+{
+	for(uint8_t e=ANIM_LINEAR;e<=ANIM_STEP;e++)
+	{
+		uint16_t last = 0;
+		for(uint16_t u=0;u<=ANIM_EASE_ONE;u++)
+		{
+			uint16_t v = anim_ease(e, u);
+			if(fabs(v - ANIM_EASE_ONE*ease_ref(e, u/(double)ANIM_EASE_ONE)) > 1.0)
+				fail("ease: curve, u, value", e, u, v);
+			if(v < last)
+				fail("ease: goes back, curve, u, value", e, u, v);
+			last = v;
+		}
+		if((anim_ease(e, 0) != 0) || ((e != ANIM_STEP) && (anim_ease(e, ANIM_EASE_ONE) != ANIM_EASE_ONE)))
+			fail("ease: ends, curve", e, anim_ease(e, 0), anim_ease(e, ANIM_EASE_ONE));
+	}
+}
+
+void check_tracks(void)
+{
+	const anim_key_t keys[] =
+	{
+		{   0, ANIM_Q8(-2), ANIM_IN },
+		{  10, ANIM_Q8(5.5), ANIM_STEP },
+		{  25, ANIM_Q8(1), ANIM_INOUT },
+		{ 100, ANIM_Q8(-2), ANIM_LINEAR },
+	};
+	const anim_track_t tr = ANIM_TRACK(keys);
+	const anim_key_t one[] = { { 0, ANIM_Q8(3.25), ANIM_LINEAR } };
+	const anim_track_t tr1 = ANIM_TRACK(one);
+
+	for(uint32_t loop=0;loop<3;loop++)
+		for(uint8_t i=0;i<4;i++)
+			if(anim_track(&tr, loop*100 + keys[i].t) != keys[i].v)
+				fail("track: key, frame, value", i, loop*100 + keys[i].t,
+					anim_track(&tr, loop*100 + keys[i].t));
+	for(uint32_t f=0;f<100;f++)
+	{
+		uint8_t i = f < 10 ? 0 : f < 25 ? 1 : 2;
+		double u = (f - keys[i].t) / (double)(keys[i+1].t - keys[i].t);
+		double v = keys[i].v + (keys[i+1].v - keys[i].v) * ease_ref(keys[i].ease, u);
+		if(fabs(anim_track(&tr, f) - v) > 1.0)
+			fail("track: frame, value, expected", f, anim_track(&tr, f), v);
+	}
+	if((anim_track(&tr1, 0) != one[0].v) || (anim_track(&tr1, 12345) != one[0].v))
+		fail("track: a single key", anim_track(&tr1, 0), anim_track(&tr1, 12345), one[0].v);
+}
+
+void check_palette(void)
+{
+	const uint32_t pal[] = { 0xFF0000, 0x00FF80, 0x0000FF, 0x102030 };
+
+	for(int k=-4;k<8;k++)
+		if(anim_palette(pal, 4, k*ANIM_ONE) != pal[(k+8)%4])
+			fail("palette: index, color, expected", k, anim_palette(pal, 4, k*ANIM_ONE), pal[(k+8)%4]);
+	for(int x=0;x<4*ANIM_ONE;x++)
+	{
+		uint32_t c = anim_palette(pal, 4, x);
+		uint32_t c0 = pal[x/ANIM_ONE], c1 = pal[(x/ANIM_ONE+1)%4];
+		for(int s=0;s<24;s+=8)
+		{
+			double a = (c0 >> s) & 0xFF, b = (c1 >> s) & 0xFF;
+			double v = a + (b - a) * (x % ANIM_ONE) / ANIM_ONE;
+			if(fabs(((c >> s) & 0xFF) - v) > 1.0)
+				fail("palette: index, shift, value", x, s, (c >> s) & 0xFF);
+		}
+	}
+}
+
+/*
+ * a layer in floating point, added to a frame
+ */
+void layer_ref(const anim_layer_t *l, uint32_t frame, double *fb)
+{
+	double ring = WS2812_FB_LEDS;
+	double pos = fmod(anim_track(&l->pos, frame) / 256.0 + ring, ring);
+	double w = anim_track(&l->width, frame) / 256.0;
+	double level = fmin(anim_track(&l->level, frame) / 256.0, 1.0);
+	uint32_t rgb = anim_palette(l->pal, l->pal_n, anim_track(&l->color, frame));
+	uint8_t grb[3] = { rgb >> 8, rgb >> 16, rgb };
+
+	if((level <= 0) || (w <= 0))
+		return;
+	for(int n=0;n<WS2812_FB_LEDS;n++)
+	{
+		double d = fabs(n - pos);
+		if(d > ring/2)
+			d = ring - d;
+		if(d >= w)
+			continue;
+		for(int c=0;c<3;c++)
+			fb[n*3+c] = fmin(fb[n*3+c] + grb[c] * level * (w - d) / w, 255);
+	}
+}
+
+void check_render(void)
+{
+	const anim_key_t zero[] = { { 0, 0, ANIM_LINEAR } };
+	const anim_key_t full[] = { { 0, ANIM_ONE, ANIM_LINEAR } };
+	const anim_key_t two[] = { { 0, ANIM_Q8(2), ANIM_LINEAR } };
+	const uint32_t white[] = { 0xFFFFFF }, blue[] = { 0x0000FF };
+	const anim_layer_t spot[] =
+	{
+		// one LED at full color
+		{ ANIM_TRACK(zero), ANIM_TRACK(full), ANIM_TRACK(zero), ANIM_TRACK(full), blue, 1 },
+		// around LED 0, half on the neighbours, one of them at the other end
+		{ ANIM_TRACK(zero), ANIM_TRACK(two), ANIM_TRACK(zero), ANIM_TRACK(full), white, 1 },
+	};
+	double fb[WS2812_FB_LEDS*3];
+	int maxerr = 0;
+
+	anim_render(spot, 1, 0);
+	for(int i=0;i<WS2812_FB_LEDS*3;i++)
+		if(ws2812_fb[i] != (i == 2 ? 0xFF : 0))
+			fail("render: one LED, byte, value", i, ws2812_fb[i], 0);
+
+	// added twice, saturates
+	anim_render(spot, 2, 0);
+	if((ws2812_fb[0] != 0xFF) || (ws2812_fb[2] != 0xFF) || (ws2812_fb[3] != 0x80) ||
+	   (ws2812_fb[(WS2812_FB_LEDS-1)*3] != 0x80) || (ws2812_fb[6] != 0))
+		fail("render: two layers", ws2812_fb[0], ws2812_fb[3], ws2812_fb[(WS2812_FB_LEDS-1)*3]);
+
+	// the ringdemo animation against the floating point layers
+	for(uint32_t f=0;f<3600;f++)
+	{
+		memset(fb, 0, sizeof(fb));
+		for(uint8_t l=0;l<RING_LAYERS;l++)
+			layer_ref(&ring_layers[l], f, fb);
+		anim_render(ring_layers, RING_LAYERS, f);
+		for(int i=0;i<WS2812_FB_LEDS*3;i++)
+		{
+			int e = abs(ws2812_fb[i] - (int)lround(fb[i]));
+			if(e > maxerr)
+				maxerr = e;
+		}
+	}
+	printf("ringdemo animation: 3600 frames, largest difference with floating point %d\n", maxerr);
+	// the light and the color are rounded in each layer
+	if(maxerr > 3)
+		errors++;
+}
+
+void render_strip(void)
+{
+	for(int f=0;f<STRIP_FRAMES;f++)
+	{
+		anim_render(ring_layers, RING_LAYERS, f);
+		for(int n=0;n<WS2812_FB_LEDS;n++)
+			for(int y=f*2;y<f*2+2;y++)
+				for(int x=n*8;x<n*8+8;x++)
+				{
+					strip[y][x][0] = ws2812_fb[n*3+1];
+					strip[y][x][1] = ws2812_fb[n*3];
+					strip[y][x][2] = ws2812_fb[n*3+2];
+				}
+	}
+}
+
+int main(int argc, char *argv[])
+{
+	FILE *f;
+
+	if(argc == 1)
+	{
+		check_ease();
+		check_tracks();
+		check_palette();
+		check_render();
+		printf(errors ? "%d errors\n" : "ok\n", errors);
+		return errors ? 1 : 0;
+	}
+
+	if((argc == 3) && (strcmp(argv[1], "-t") == 0))
+	{
+		for(int n=atoi(argv[2]),fr=0;fr<n;fr++)
+		{
+			anim_render(ring_layers, RING_LAYERS, fr);
+			printf("%4d", fr);
+			for(int i=0;i<WS2812_FB_LEDS;i++)
+				printf(" %02X%02X%02X", ws2812_fb[i*3+1], ws2812_fb[i*3], ws2812_fb[i*3+2]);
+			printf("\n");
+		}
+		return 0;
+	}
+
+	if((argc != 3) || ((strcmp(argv[1], "-w") != 0) && (strcmp(argv[1], "-c") != 0)))
+	{
+		printf("use: %s [-t frames | -w file | -c file]\n", argv[0]);
+		return 1;
+	}
+
+	render_strip();
+	if(argv[1][1] == 'w')
+	{
+		if(!(f = fopen(argv[2], "wb")))
+		{
+			perror(argv[2]);
+			return 1;
+		}
+		fprintf(f, "P6\n%d %d\n255\n", STRIP_W, STRIP_H);
+		fwrite(strip, 1, sizeof(strip), f);
+		fclose(f);
+		return 0;
+	}
+
+	static uint8_t old[STRIP_H][STRIP_W][3];
+	int w, h;
+	if(!(f = fopen(argv[2], "rb")) || (fscanf(f, "P6 %d %d 255", &w, &h) != 2) ||
+	   (w != STRIP_W) || (h != STRIP_H) || (fgetc(f) != '\n') ||
+	   (fread(old, 1, sizeof(old), f) != sizeof(old)))
+	{
+		printf("%s: not a strip of this ring\n", argv[2]);
+		return 1;
+	}
+	fclose(f);
+	for(int y=0;y<STRIP_H;y+=2)
+		if(memcmp(strip[y], old[y], sizeof(strip[y])))
+		{
+			printf("frame %d differs\n", y/2);
+			errors++;
+		}
+	printf(errors ? "%d frames differ\n" : "strip ok\n", errors);
+	return errors ? 1 : 0;
+}
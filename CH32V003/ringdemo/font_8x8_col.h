@@ -0,0 +1,530 @@
+/*
+ * fontdata_col: 256 glyphs 8x8 from ../fonts/font_8x8.h, layout cols
+ * generated by CH32V003/fonts/fontc.py, do not edit
+ */
+
+#ifndef _FONTDATA_COL_H
+#define _FONTDATA_COL_H
+
+#define FONTDATA_COL_W 8
+#define FONTDATA_COL_H 8
+#define FONTDATA_COL_BYTES 8		// bytes per glyph
+#define FONTDATA_COL_COUNT 256
+#define FONTDATA_COL_GLYPH(c) ((uint8_t)(c) - 0)
+
+const uint8_t fontdata_col[] = {
+	/* 0 0x00 */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 1 0x01 */
+	0x7E, 0x81, 0x95, 0xB1, 0xB1, 0x95, 0x81, 0x7E,
+	/* 2 0x02 */
+	0x7E, 0xFF, 0xEB, 0xCF, 0xCF, 0xEB, 0xFF, 0x7E,
+	/* 3 0x03 */
+	0x0E, 0x1F, 0x3F, 0x7E, 0x3F, 0x1F, 0x0E, 0x00,
+	/* 4 0x04 */
+	0x08, 0x1C, 0x3E, 0x7F, 0x3E, 0x1C, 0x08, 0x00,
+	/* 5 0x05 */
+	0x38, 0x3A, 0x9F, 0xFF, 0x9F, 0x3A, 0x38, 0x00,
+	/* 6 0x06 */
+	0x18, 0x3C, 0xBE, 0xFF, 0xBE, 0x3C, 0x18, 0x00,
+	/* 7 0x07 */
+	0x00, 0x00, 0x18, 0x3C, 0x3C, 0x18, 0x00, 0x00,
+	/* 8 0x08 */
+	0xFF, 0xFF, 0xE7, 0xC3, 0xC3, 0xE7, 0xFF, 0xFF,
+	/* 9 0x09 */
+	0x00, 0x3C, 0x66, 0x42, 0x42, 0x66, 0x3C, 0x00,
+	/* 10 0x0A */
+	0xFF, 0xC3, 0x99, 0xBD, 0xBD, 0x99, 0xC3, 0xFF,
+	/* 11 0x0B */
+	0x70, 0xF8, 0x88, 0x88, 0xFD, 0x7F, 0x07, 0x0F,
+	/* 12 0x0C */
+	0x00, 0x4E, 0x5F, 0xF1, 0xF1, 0x5F, 0x4E, 0x00,
+	/* 13 0x0D */
+	0xC0, 0xE0, 0xFF, 0x7F, 0x05, 0x05, 0x07, 0x07,
+	/* 14 0x0E */
+	0xC0, 0xFF, 0x7F, 0x05, 0x05, 0x65, 0x7F, 0x3F,
+	/* 15 0x0F */
+	0x5A, 0x5A, 0x3C, 0xE7, 0xE7, 0x3C, 0x5A, 0x5A,
+	/* 16 0x10 */
+	0x7F, 0x3E, 0x3E, 0x1C, 0x1C, 0x08, 0x08, 0x00,
+	/* 17 0x11 */
+	0x08, 0x08, 0x1C, 0x1C, 0x3E, 0x3E, 0x7F, 0x00,
+	/* 18 0x12 */
+	0x00, 0x24, 0x66, 0xFF, 0xFF, 0x66, 0x24, 0x00,
+	/* 19 0x13 */
+	0x00, 0x5F, 0x5F, 0x00, 0x00, 0x5F, 0x5F, 0x00,
+	/* 20 0x14 */
+	0x06, 0x0F, 0x09, 0x7F, 0x7F, 0x01, 0x7F, 0x7F,
+	/* 21 0x15 */
+	0x40, 0x9A, 0xBF, 0xA5, 0xA5, 0xFD, 0x59, 0x02,
+	/* 22 0x16 */
+	0x00, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x00,
+	/* 23 0x17 */
+	0x80, 0x94, 0xB6, 0xFF, 0xFF, 0xB6, 0x94, 0x80,
+	/* 24 0x18 */
+	0x00, 0x04, 0x06, 0x7F, 0x7F, 0x06, 0x04, 0x00,
+	/* 25 0x19 */
+	0x00, 0x10, 0x30, 0x7F, 0x7F, 0x30, 0x10, 0x00,
+	/* 26 0x1A */
+	0x08, 0x08, 0x08, 0x2A, 0x3E, 0x1C, 0x08, 0x00,
+	/* 27 0x1B */
+	0x08, 0x1C, 0x3E, 0x2A, 0x08, 0x08, 0x08, 0x00,
+	/* 28 0x1C */
+	0x3C, 0x3C, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00,
+	/* 29 0x1D */
+	0x08, 0x1C, 0x3E, 0x08, 0x08, 0x3E, 0x1C, 0x08,
+	/* 30 0x1E */
+	0x30, 0x38, 0x3C, 0x3E, 0x3E, 0x3C, 0x38, 0x30,
+	/* 31 0x1F */
+	0x06, 0x0E, 0x1E, 0x3E, 0x3E, 0x1E, 0x0E, 0x06,
+	/* 32 ' ' */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 33 '!' */
+	0x00, 0x00, 0x06, 0x5F, 0x5F, 0x06, 0x00, 0x00,
+	/* 34 '"' */
+	0x00, 0x03, 0x07, 0x00, 0x00, 0x07, 0x03, 0x00,
+	/* 35 '#' */
+	0x14, 0x7F, 0x7F, 0x14, 0x7F, 0x7F, 0x14, 0x00,
+	/* 36 '$' */
+	0x00, 0x24, 0x2E, 0x6B, 0x6B, 0x3A, 0x12, 0x00,
+	/* 37 '%' */
+	0x46, 0x66, 0x30, 0x18, 0x0C, 0x66, 0x62, 0x00,
+	/* 38 '&' */
+	0x30, 0x7A, 0x4F, 0x5D, 0x37, 0x7A, 0x48, 0x00,
+	/* 39 ''' */
+	0x00, 0x00, 0x04, 0x07, 0x03, 0x00, 0x00, 0x00,
+	/* 40 '(' */
+	0x00, 0x00, 0x1C, 0x3E, 0x63, 0x41, 0x00, 0x00,
+	/* 41 ')' */
+	0x00, 0x00, 0x41, 0x63, 0x3E, 0x1C, 0x00, 0x00,
+	/* 42 0x2A */
+	0x08, 0x2A, 0x3E, 0x1C, 0x1C, 0x3E, 0x2A, 0x08,
+	/* 43 '+' */
+	0x00, 0x08, 0x08, 0x3E, 0x3E, 0x08, 0x08, 0x00,
+	/* 44 ',' */
+	0x00, 0x00, 0x80, 0xE0, 0x60, 0x00, 0x00, 0x00,
+	/* 45 '-' */
+	0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00,
+	/* 46 '.' */
+	0x00, 0x00, 0x00, 0x60, 0x60, 0x00, 0x00, 0x00,
+	/* 47 0x2F */
+	0x60, 0x30, 0x18, 0x0C, 0x06, 0x03, 0x01, 0x00,
+	/* 48 '0' */
+	0x1C, 0x3E, 0x63, 0x49, 0x63, 0x3E, 0x1C, 0x00,
+	/* 49 '1' */
+	0x00, 0x40, 0x42, 0x7F, 0x7F, 0x40, 0x40, 0x00,
+	/* 50 '2' */
+	0x42, 0x63, 0x71, 0x59, 0x49, 0x6F, 0x66, 0x00,
+	/* 51 '3' */
+	0x22, 0x63, 0x49, 0x49, 0x49, 0x7F, 0x36, 0x00,
+	/* 52 '4' */
+	0x18, 0x1C, 0x16, 0x53, 0x7F, 0x7F, 0x50, 0x00,
+	/* 53 '5' */
+	0x2F, 0x6F, 0x49, 0x49, 0x49, 0x79, 0x31, 0x00,
+	/* 54 '6' */
+	0x3C, 0x7E, 0x4B, 0x49, 0x49, 0x78, 0x30, 0x00,
+	/* 55 '7' */
+	0x03, 0x03, 0x71, 0x79, 0x0D, 0x07, 0x03, 0x00,
+	/* 56 '8' */
+	0x36, 0x7F, 0x49, 0x49, 0x49, 0x7F, 0x36, 0x00,
+	/* 57 '9' */
+	0x06, 0x4F, 0x49, 0x49, 0x69, 0x3F, 0x1E, 0x00,
+	/* 58 ':' */
+	0x00, 0x00, 0x00, 0x66, 0x66, 0x00, 0x00, 0x00,
+	/* 59 ';' */
+	0x00, 0x00, 0x80, 0xE6, 0x66, 0x00, 0x00, 0x00,
+	/* 60 '<' */
+	0x00, 0x00, 0x08, 0x1C, 0x36, 0x63, 0x41, 0x00,
+	/* 61 '=' */
+	0x00, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x00,
+	/* 62 '>' */
+	0x00, 0x41, 0x63, 0x36, 0x1C, 0x08, 0x00, 0x00,
+	/* 63 '?' */
+	0x02, 0x03, 0x01, 0x59, 0x5D, 0x07, 0x02, 0x00,
+	/* 64 '@' */
+	0x3E, 0x7F, 0x41, 0x5D, 0x5D, 0x1F, 0x1E, 0x00,
+	/* 65 'A' */
+	0x7C, 0x7E, 0x0B, 0x09, 0x0B, 0x7E, 0x7C, 0x00,
+	/* 66 'B' */
+	0x41, 0x7F, 0x7F, 0x49, 0x49, 0x7F, 0x36, 0x00,
+	/* 67 'C' */
+	0x1C, 0x3E, 0x63, 0x41, 0x41, 0x63, 0x22, 0x00,
+	/* 68 'D' */
+	0x41, 0x7F, 0x7F, 0x41, 0x63, 0x3E, 0x1C, 0x00,
+	/* 69 'E' */
+	0x41, 0x7F, 0x7F, 0x49, 0x5D, 0x41, 0x63, 0x00,
+	/* 70 'F' */
+	0x41, 0x7F, 0x7F, 0x49, 0x1D, 0x01, 0x03, 0x00,
+	/* 71 'G' */
+	0x1C, 0x3E, 0x63, 0x41, 0x51, 0x33, 0x72, 0x00,
+	/* 72 'H' */
+	0x7F, 0x7F, 0x08, 0x08, 0x08, 0x7F, 0x7F, 0x00,
+	/* 73 'I' */
+	0x00, 0x00, 0x41, 0x7F, 0x7F, 0x41, 0x00, 0x00,
+	/* 74 'J' */
+	0x30, 0x70, 0x40, 0x41, 0x7F, 0x3F, 0x01, 0x00,
+	/* 75 'K' */
+	0x41, 0x7F, 0x7F, 0x08, 0x1C, 0x77, 0x63, 0x00,
+	/* 76 'L' */
+	0x41, 0x7F, 0x7F, 0x41, 0x40, 0x60, 0x70, 0x00,
+	/* 77 'M' */
+	0x7F, 0x7F, 0x0E, 0x1C, 0x0E, 0x7F, 0x7F, 0x00,
+	/* 78 'N' */
+	0x7F, 0x7F, 0x06, 0x0C, 0x18, 0x7F, 0x7F, 0x00,
+	/* 79 'O' */
+	0x3E, 0x7F, 0x41, 0x41, 0x41, 0x7F, 0x3E, 0x00,
+	/* 80 'P' */
+	0x41, 0x7F, 0x7F, 0x49, 0x09, 0x0F, 0x06, 0x00,
+	/* 81 'Q' */
+	0x3E, 0x7F, 0x41, 0x41, 0xE1, 0xFF, 0xBE, 0x00,
+	/* 82 'R' */
+	0x41, 0x7F, 0x7F, 0x09, 0x19, 0x7F, 0x66, 0x00,
+	/* 83 'S' */
+	0x00, 0x22, 0x67, 0x4D, 0x59, 0x73, 0x22, 0x00,
+	/* 84 'T' */
+	0x00, 0x07, 0x43, 0x7F, 0x7F, 0x43, 0x07, 0x00,
+	/* 85 'U' */
+	0x3F, 0x7F, 0x40, 0x40, 0x40, 0x7F, 0x3F, 0x00,
+	/* 86 'V' */
+	0x1F, 0x3F, 0x60, 0x40, 0x60, 0x3F, 0x1F, 0x00,
+	/* 87 'W' */
+	0x3F, 0x7F, 0x60, 0x38, 0x60, 0x7F, 0x3F, 0x00,
+	/* 88 'X' */
+	0x63, 0x77, 0x1C, 0x08, 0x1C, 0x77, 0x63, 0x00,
+	/* 89 'Y' */
+	0x00, 0x07, 0x4F, 0x78, 0x78, 0x4F, 0x07, 0x00,
+	/* 90 'Z' */
+	0x47, 0x63, 0x71, 0x59, 0x4D, 0x67, 0x73, 0x00,
+	/* 91 '[' */
+	0x00, 0x00, 0x7F, 0x7F, 0x41, 0x41, 0x00, 0x00,
+	/* 92 0x5C */
+	0x01, 0x03, 0x06, 0x0C, 0x18, 0x30, 0x60, 0x00,
+	/* 93 ']' */
+	0x00, 0x00, 0x41, 0x41, 0x7F, 0x7F, 0x00, 0x00,
+	/* 94 '^' */
+	0x08, 0x0C, 0x06, 0x03, 0x06, 0x0C, 0x08, 0x00,
+	/* 95 '_' */
+	0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+	/* 96 '`' */
+	0x00, 0x00, 0x01, 0x03, 0x06, 0x04, 0x00, 0x00,
+	/* 97 'a' */
+	0x20, 0x74, 0x54, 0x54, 0x3C, 0x78, 0x40, 0x00,
+	/* 98 'b' */
+	0x41, 0x7F, 0x3F, 0x44, 0x44, 0x7C, 0x38, 0x00,
+	/* 99 'c' */
+	0x38, 0x7C, 0x44, 0x44, 0x44, 0x6C, 0x28, 0x00,
+	/* 100 'd' */
+	0x38, 0x7C, 0x44, 0x45, 0x3F, 0x7F, 0x40, 0x00,
+	/* 101 'e' */
+	0x38, 0x7C, 0x54, 0x54, 0x54, 0x5C, 0x18, 0x00,
+	/* 102 'f' */
+	0x48, 0x7E, 0x7F, 0x49, 0x09, 0x03, 0x02, 0x00,
+	/* 103 'g' */
+	0x98, 0xBC, 0xA4, 0xA4, 0xF8, 0x7C, 0x04, 0x00,
+	/* 104 'h' */
+	0x41, 0x7F, 0x7F, 0x08, 0x04, 0x7C, 0x78, 0x00,
+	/* 105 'i' */
+	0x00, 0x00, 0x44, 0x7D, 0x7D, 0x40, 0x00, 0x00,
+	/* 106 'j' */
+	0x00, 0x60, 0xE0, 0x80, 0x80, 0xFD, 0x7D, 0x00,
+	/* 107 'k' */
+	0x41, 0x7F, 0x7F, 0x10, 0x38, 0x6C, 0x44, 0x00,
+	/* 108 'l' */
+	0x00, 0x00, 0x41, 0x7F, 0x7F, 0x40, 0x00, 0x00,
+	/* 109 'm' */
+	0x7C, 0x7C, 0x0C, 0x78, 0x0C, 0x7C, 0x78, 0x00,
+	/* 110 'n' */
+	0x04, 0x7C, 0x78, 0x04, 0x04, 0x7C, 0x78, 0x00,
+	/* 111 'o' */
+	0x38, 0x7C, 0x44, 0x44, 0x44, 0x7C, 0x38, 0x00,
+	/* 112 'p' */
+	0x84, 0xFC, 0xF8, 0xA4, 0x24, 0x3C, 0x18, 0x00,
+	/* 113 'q' */
+	0x18, 0x3C, 0x24, 0xA4, 0xF8, 0xFC, 0x84, 0x00,
+	/* 114 'r' */
+	0x44, 0x7C, 0x78, 0x4C, 0x04, 0x0C, 0x08, 0x00,
+	/* 115 's' */
+	0x48, 0x5C, 0x54, 0x54, 0x54, 0x74, 0x24, 0x00,
+	/* 116 't' */
+	0x04, 0x04, 0x3F, 0x7F, 0x44, 0x64, 0x20, 0x00,
+	/* 117 'u' */
+	0x3C, 0x7C, 0x40, 0x40, 0x3C, 0x7C, 0x40, 0x00,
+	/* 118 'v' */
+	0x1C, 0x3C, 0x60, 0x40, 0x60, 0x3C, 0x1C, 0x00,
+	/* 119 'w' */
+	0x3C, 0x7C, 0x60, 0x38, 0x60, 0x7C, 0x3C, 0x00,
+	/* 120 'x' */
+	0x44, 0x6C, 0x38, 0x10, 0x38, 0x6C, 0x44, 0x00,
+	/* 121 'y' */
+	0x9C, 0xBC, 0xA0, 0xA0, 0xA0, 0xFC, 0x7C, 0x00,
+	/* 122 'z' */
+	0x00, 0x4C, 0x64, 0x74, 0x5C, 0x4C, 0x64, 0x00,
+	/* 123 '{' */
+	0x00, 0x08, 0x08, 0x3E, 0x77, 0x41, 0x41, 0x00,
+	/* 124 '|' */
+	0x00, 0x00, 0x00, 0x7F, 0x7F, 0x00, 0x00, 0x00,
+	/* 125 '}' */
+	0x00, 0x41, 0x41, 0x77, 0x3E, 0x08, 0x08, 0x00,
+	/* 126 '~' */
+	0x02, 0x03, 0x01, 0x03, 0x02, 0x03, 0x01, 0x00,
+	/* 127 0x7F */
+	0x70, 0x78, 0x4C, 0x46, 0x4C, 0x78, 0x70, 0x00,
+	/* 128 0x80 */
+	0x1E, 0xBF, 0xA1, 0xA1, 0xE1, 0x73, 0x12, 0x00,
+	/* 129 0x81 */
+	0x3D, 0x7D, 0x40, 0x40, 0x3D, 0x7D, 0x40, 0x00,
+	/* 130 0x82 */
+	0x38, 0x7C, 0x54, 0x56, 0x57, 0x5D, 0x18, 0x00,
+	/* 131 0x83 */
+	0x22, 0x75, 0x55, 0x55, 0x3D, 0x79, 0x42, 0x00,
+	/* 132 0x84 */
+	0x21, 0x75, 0x54, 0x54, 0x3C, 0x79, 0x41, 0x00,
+	/* 133 0x85 */
+	0x20, 0x74, 0x55, 0x57, 0x3E, 0x78, 0x40, 0x00,
+	/* 134 0x86 */
+	0x20, 0x74, 0x57, 0x57, 0x3C, 0x78, 0x40, 0x00,
+	/* 135 0x87 */
+	0x18, 0x3C, 0xA4, 0xA4, 0xE4, 0x64, 0x24, 0x00,
+	/* 136 0x88 */
+	0x3A, 0x7D, 0x55, 0x55, 0x55, 0x5D, 0x1A, 0x00,
+	/* 137 0x89 */
+	0x39, 0x7D, 0x54, 0x54, 0x54, 0x5D, 0x19, 0x00,
+	/* 138 0x8A */
+	0x38, 0x7C, 0x55, 0x57, 0x56, 0x5C, 0x18, 0x00,
+	/* 139 0x8B */
+	0x00, 0x01, 0x45, 0x7C, 0x7C, 0x41, 0x01, 0x00,
+	/* 140 0x8C */
+	0x02, 0x01, 0x45, 0x7D, 0x7D, 0x41, 0x02, 0x00,
+	/* 141 0x8D */
+	0x00, 0x00, 0x49, 0x7B, 0x7A, 0x40, 0x00, 0x00,
+	/* 142 0x8E */
+	0x79, 0x7D, 0x16, 0x12, 0x16, 0x7D, 0x79, 0x00,
+	/* 143 0x8F */
+	0x78, 0x7E, 0x17, 0x15, 0x17, 0x7E, 0x78, 0x00,
+	/* 144 0x90 */
+	0x7C, 0x7C, 0x56, 0x57, 0x55, 0x44, 0x44, 0x00,
+	/* 145 0x91 */
+	0x20, 0x74, 0x54, 0x7C, 0x7C, 0x54, 0x54, 0x00,
+	/* 146 0x92 */
+	0x7C, 0x7E, 0x0B, 0x09, 0x7F, 0x7F, 0x49, 0x00,
+	/* 147 0x93 */
+	0x3A, 0x7D, 0x45, 0x45, 0x45, 0x7D, 0x3A, 0x00,
+	/* 148 0x94 */
+	0x39, 0x7D, 0x44, 0x44, 0x44, 0x7D, 0x39, 0x00,
+	/* 149 0x95 */
+	0x38, 0x7C, 0x45, 0x47, 0x46, 0x7C, 0x38, 0x00,
+	/* 150 0x96 */
+	0x3A, 0x79, 0x41, 0x41, 0x39, 0x7A, 0x40, 0x00,
+	/* 151 0x97 */
+	0x3C, 0x7D, 0x43, 0x42, 0x3C, 0x7C, 0x40, 0x00,
+	/* 152 0x98 */
+	0x9D, 0xBD, 0xA0, 0xA0, 0xA0, 0xFD, 0x7D, 0x00,
+	/* 153 0x99 */
+	0x19, 0x3D, 0x66, 0x42, 0x66, 0x3D, 0x19, 0x00,
+	/* 154 0x9A */
+	0x3D, 0x7D, 0x40, 0x40, 0x40, 0x7D, 0x3D, 0x00,
+	/* 155 0x9B */
+	0x18, 0x3C, 0x24, 0xE7, 0xE7, 0x24, 0x24, 0x00,
+	/* 156 0x9C */
+	0x48, 0x7E, 0x7F, 0x49, 0x43, 0x66, 0x20, 0x00,
+	/* 157 0x9D */
+	0x00, 0x2B, 0x2F, 0xFC, 0xFC, 0x2F, 0x2B, 0x00,
+	/* 158 0x9E */
+	0xFF, 0xFF, 0x09, 0x09, 0x2F, 0xF6, 0xF8, 0xA0,
+	/* 159 0x9F */
+	0x20, 0x60, 0x48, 0x7E, 0x3F, 0x09, 0x03, 0x02,
+	/* 160 0xA0 */
+	0x20, 0x74, 0x56, 0x57, 0x3D, 0x78, 0x40, 0x00,
+	/* 161 0xA1 */
+	0x00, 0x00, 0x48, 0x7A, 0x7B, 0x41, 0x00, 0x00,
+	/* 162 0xA2 */
+	0x38, 0x7C, 0x44, 0x46, 0x47, 0x7D, 0x38, 0x00,
+	/* 163 0xA3 */
+	0x3C, 0x7C, 0x42, 0x43, 0x3D, 0x7C, 0x40, 0x00,
+	/* 164 0xA4 */
+	0x0A, 0x7B, 0x71, 0x0B, 0x0A, 0x7B, 0x71, 0x00,
+	/* 165 0xA5 */
+	0x7A, 0x7B, 0x19, 0x33, 0x62, 0x7B, 0x79, 0x00,
+	/* 166 0xA6 */
+	0x00, 0x26, 0x2F, 0x29, 0x2F, 0x2F, 0x28, 0x00,
+	/* 167 0xA7 */
+	0x00, 0x26, 0x2F, 0x29, 0x2F, 0x26, 0x00, 0x00,
+	/* 168 0xA8 */
+	0x00, 0x20, 0x70, 0x5D, 0x4D, 0x40, 0x60, 0x20,
+	/* 169 0xA9 */
+	0x38, 0x38, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00,
+	/* 170 0xAA */
+	0x08, 0x08, 0x08, 0x08, 0x08, 0x38, 0x38, 0x00,
+	/* 171 0xAB */
+	0x42, 0x6F, 0x3F, 0x18, 0xCC, 0xEE, 0xBB, 0x91,
+	/* 172 0xAC */
+	0x42, 0x6F, 0x3F, 0x58, 0x6C, 0xD6, 0xFB, 0x41,
+	/* 173 0xAD */
+	0x00, 0x00, 0x30, 0x7D, 0x7D, 0x30, 0x00, 0x00,
+	/* 174 0xAE */
+	0x08, 0x1C, 0x36, 0x22, 0x08, 0x1C, 0x36, 0x22,
+	/* 175 0xAF */
+	0x22, 0x36, 0x1C, 0x08, 0x22, 0x36, 0x1C, 0x08,
+	/* 176 0xB0 */
+	0xAA, 0x00, 0x55, 0x00, 0xAA, 0x00, 0x55, 0x00,
+	/* 177 0xB1 */
+	0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55,
+	/* 178 0xB2 */
+	0xAA, 0xFF, 0x55, 0xFF, 0xAA, 0xFF, 0x55, 0xFF,
+	/* 179 0xB3 */
+	0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00,
+	/* 180 0xB4 */
+	0x10, 0x10, 0x10, 0xFF, 0xFF, 0x00, 0x00, 0x00,
+	/* 181 0xB5 */
+	0x14, 0x14, 0x14, 0xFF, 0xFF, 0x00, 0x00, 0x00,
+	/* 182 0xB6 */
+	0x10, 0x10, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00,
+	/* 183 0xB7 */
+	0x10, 0x10, 0xF0, 0xF0, 0x10, 0xF0, 0xF0, 0x00,
+	/* 184 0xB8 */
+	0x14, 0x14, 0x14, 0xFC, 0xFC, 0x00, 0x00, 0x00,
+	/* 185 0xB9 */
+	0x14, 0x14, 0xF7, 0xF7, 0x00, 0xFF, 0xFF, 0x00,
+	/* 186 0xBA */
+	0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00,
+	/* 187 0xBB */
+	0x14, 0x14, 0xF4, 0xF4, 0x04, 0xFC, 0xFC, 0x00,
+	/* 188 0xBC */
+	0x14, 0x14, 0x17, 0x17, 0x10, 0x1F, 0x1F, 0x00,
+	/* 189 0xBD */
+	0x10, 0x10, 0x1F, 0x1F, 0x10, 0x1F, 0x1F, 0x00,
+	/* 190 0xBE */
+	0x14, 0x14, 0x14, 0x1F, 0x1F, 0x00, 0x00, 0x00,
+	/* 191 0xBF */
+	0x10, 0x10, 0x10, 0xF0, 0xF0, 0x00, 0x00, 0x00,
+	/* 192 0xC0 */
+	0x00, 0x00, 0x00, 0x1F, 0x1F, 0x10, 0x10, 0x10,
+	/* 193 0xC1 */
+	0x10, 0x10, 0x10, 0x1F, 0x1F, 0x10, 0x10, 0x10,
+	/* 194 0xC2 */
+	0x10, 0x10, 0x10, 0xF0, 0xF0, 0x10, 0x10, 0x10,
+	/* 195 0xC3 */
+	0x00, 0x00, 0x00, 0xFF, 0xFF, 0x10, 0x10, 0x10,
+	/* 196 0xC4 */
+	0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+	/* 197 0xC5 */
+	0x10, 0x10, 0x10, 0xFF, 0xFF, 0x10, 0x10, 0x10,
+	/* 198 0xC6 */
+	0x00, 0x00, 0x00, 0xFF, 0xFF, 0x14, 0x14, 0x14,
+	/* 199 0xC7 */
+	0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x10,
+	/* 200 0xC8 */
+	0x00, 0x00, 0x1F, 0x1F, 0x10, 0x17, 0x17, 0x14,
+	/* 201 0xC9 */
+	0x00, 0x00, 0xFC, 0xFC, 0x04, 0xF4, 0xF4, 0x14,
+	/* 202 0xCA */
+	0x14, 0x14, 0x17, 0x17, 0x10, 0x17, 0x17, 0x14,
+	/* 203 0xCB */
+	0x14, 0x14, 0xF4, 0xF4, 0x04, 0xF4, 0xF4, 0x14,
+	/* 204 0xCC */
+	0x00, 0x00, 0xFF, 0xFF, 0x00, 0xF7, 0xF7, 0x14,
+	/* 205 0xCD */
+	0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+	/* 206 0xCE */
+	0x14, 0x14, 0xF7, 0xF7, 0x00, 0xF7, 0xF7, 0x14,
+	/* 207 0xCF */
+	0x14, 0x14, 0x14, 0x17, 0x17, 0x14, 0x14, 0x14,
+	/* 208 0xD0 */
+	0x10, 0x10, 0x1F, 0x1F, 0x10, 0x1F, 0x1F, 0x10,
+	/* 209 0xD1 */
+	0x14, 0x14, 0x14, 0xF4, 0xF4, 0x14, 0x14, 0x14,
+	/* 210 0xD2 */
+	0x10, 0x10, 0xF0, 0xF0, 0x10, 0xF0, 0xF0, 0x10,
+	/* 211 0xD3 */
+	0x00, 0x00, 0x1F, 0x1F, 0x10, 0x1F, 0x1F, 0x10,
+	/* 212 0xD4 */
+	0x00, 0x00, 0x00, 0x1F, 0x1F, 0x14, 0x14, 0x14,
+	/* 213 0xD5 */
+	0x00, 0x00, 0x00, 0xFC, 0xFC, 0x14, 0x14, 0x14,
+	/* 214 0xD6 */
+	0x00, 0x00, 0xF0, 0xF0, 0x10, 0xF0, 0xF0, 0x10,
+	/* 215 0xD7 */
+	0x10, 0x10, 0xFF, 0xFF, 0x10, 0xFF, 0xFF, 0x10,
+	/* 216 0xD8 */
+	0x14, 0x14, 0x14, 0xFF, 0xFF, 0x14, 0x14, 0x14,
+	/* 217 0xD9 */
+	0x10, 0x10, 0x10, 0x1F, 0x1F, 0x00, 0x00, 0x00,
+	/* 218 0xDA */
+	0x00, 0x00, 0x00, 0xF0, 0xF0, 0x10, 0x10, 0x10,
+	/* 219 0xDB */
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	/* 220 0xDC */
+	0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0,
+	/* 221 0xDD */
+	0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+	/* 222 0xDE */
+	0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
+	/* 223 0xDF */
+	0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+	/* 224 0xE0 */
+	0x38, 0x7C, 0x44, 0x6C, 0x38, 0x6C, 0x44, 0x00,
+	/* 225 0xE1 */
+	0x7E, 0x7F, 0x01, 0x09, 0x5F, 0x76, 0x20, 0x00,
+	/* 226 0xE2 */
+	0x7F, 0x7F, 0x01, 0x01, 0x01, 0x03, 0x03, 0x00,
+	/* 227 0xE3 */
+	0x04, 0x7C, 0x7C, 0x04, 0x7C, 0x7C, 0x04, 0x00,
+	/* 228 0xE4 */
+	0x63, 0x77, 0x5D, 0x49, 0x41, 0x63, 0x63, 0x00,
+	/* 229 0xE5 */
+	0x38, 0x7C, 0x44, 0x7C, 0x3C, 0x04, 0x04, 0x00,
+	/* 230 0xE6 */
+	0x80, 0xFC, 0x7C, 0x40, 0x40, 0x7C, 0x3C, 0x00,
+	/* 231 0xE7 */
+	0x04, 0x06, 0x02, 0x7E, 0x7C, 0x06, 0x02, 0x00,
+	/* 232 0xE8 */
+	0x00, 0x99, 0xBD, 0xE7, 0xE7, 0xBD, 0x99, 0x00,
+	/* 233 0xE9 */
+	0x1C, 0x3E, 0x6B, 0x49, 0x6B, 0x3E, 0x1C, 0x00,
+	/* 234 0xEA */
+	0x4C, 0x7E, 0x73, 0x01, 0x73, 0x7E, 0x4C, 0x00,
+	/* 235 0xEB */
+	0x00, 0x30, 0x78, 0x4A, 0x4F, 0x7D, 0x39, 0x00,
+	/* 236 0xEC */
+	0x18, 0x3C, 0x24, 0x3C, 0x3C, 0x24, 0x3C, 0x18,
+	/* 237 0xED */
+	0x98, 0xFC, 0x64, 0x3C, 0x3E, 0x27, 0x3D, 0x18,
+	/* 238 0xEE */
+	0x00, 0x1C, 0x3E, 0x6B, 0x49, 0x49, 0x49, 0x00,
+	/* 239 0xEF */
+	0x7C, 0x7E, 0x02, 0x02, 0x02, 0x7E, 0x7C, 0x00,
+	/* 240 0xF0 */
+	0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x00,
+	/* 241 0xF1 */
+	0x00, 0x44, 0x44, 0x5F, 0x5F, 0x44, 0x44, 0x00,
+	/* 242 0xF2 */
+	0x00, 0x40, 0x51, 0x5B, 0x4E, 0x44, 0x40, 0x00,
+	/* 243 0xF3 */
+	0x00, 0x40, 0x44, 0x4E, 0x5B, 0x51, 0x40, 0x00,
+	/* 244 0xF4 */
+	0x00, 0x00, 0x00, 0xFE, 0xFF, 0x01, 0x07, 0x06,
+	/* 245 0xF5 */
+	0x60, 0xE0, 0x80, 0xFF, 0x7F, 0x00, 0x00, 0x00,
+	/* 246 0xF6 */
+	0x00, 0x08, 0x08, 0x2A, 0x2A, 0x08, 0x08, 0x00,
+	/* 247 0xF7 */
+	0x24, 0x36, 0x12, 0x36, 0x24, 0x36, 0x12, 0x00,
+	/* 248 0xF8 */
+	0x00, 0x06, 0x0F, 0x09, 0x0F, 0x06, 0x00, 0x00,
+	/* 249 0xF9 */
+	0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00,
+	/* 250 0xFA */
+	0x00, 0x00, 0x00, 0x08, 0x08, 0x00, 0x00, 0x00,
+	/* 251 0xFB */
+	0x10, 0x30, 0x70, 0xC0, 0xFF, 0xFF, 0x01, 0x01,
+	/* 252 0xFC */
+	0x00, 0x01, 0x1F, 0x1E, 0x01, 0x1F, 0x1E, 0x00,
+	/* 253 0xFD */
+	0x00, 0x11, 0x19, 0x1D, 0x17, 0x12, 0x00, 0x00,
+	/* 254 0xFE */
+	0x00, 0x00, 0x3C, 0x3C, 0x3C, 0x3C, 0x00, 0x00,
+	/* 255 0xFF */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+#endif
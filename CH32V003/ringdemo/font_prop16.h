@@ -0,0 +1,192 @@
+/*
+ * font_prop16: 19 proportional glyphs 16 pixels high, 1 bpp
+ * from ../fonts/font_8x8.h (scale 2)
+ * generated by CH32V003/fonts/pfontc.py, do not edit
+ */
+
+#ifndef _FONT_PROP16_H
+#define _FONT_PROP16_H
+
+#ifndef _PFONT_TYPES
+#define _PFONT_TYPES
+
+#include <stdint.h>
+#include <stddef.h>
+
+typedef struct {
+	uint16_t offset;		// first byte in the data
+	uint8_t width;			// columns in the data
+	uint8_t advance;		// where the next glyph starts
+} pfont_glyph_t;
+
+typedef struct {
+	uint8_t left, right;	// glyphs, sorted by left and then right
+	int8_t dx;				// added to the advance of left
+} pfont_kern_t;
+
+typedef struct {
+	uint8_t height;			// rows in each glyph
+	uint8_t bpp;			// 1: pages of column bytes, 4: runs of level<<4 | (n-1)
+	uint8_t first, last;	// character codes
+	const uint8_t *map;		// glyph of each code from first, NULL if in order
+	const pfont_glyph_t *glyphs;
+	const pfont_kern_t *kern;
+	uint16_t nkern;
+	const uint8_t *data;
+} pfont_t;
+
+/*
+ * glyph for a character, characters not in the font use the space (0)
+ */
+static inline uint8_t pfont_glyph(const pfont_t *font, uint8_t c)
+{
+	if((c < font->first) || (c > font->last))
+		return 0;
+	return font->map ? font->map[c - font->first] : c - font->first;
+}
+
+/*
+ * kerning between two glyphs (binary search)
+ */
+static inline int8_t pfont_kern(const pfont_t *font, uint8_t left, uint8_t right)
+{
+	uint16_t lo = 0, hi = font->nkern;
+	uint16_t key = (left << 8) | right;
+
+	while(lo < hi)
+	{
+		uint16_t mid = (lo + hi) >> 1;
+		const pfont_kern_t *k = &font->kern[mid];
+		uint16_t v = (k->left << 8) | k->right;
+		if(v == key)
+			return k->dx;
+		if(v < key)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+	return 0;
+}
+
+/*
+ * width in pixels of a string, from the first to the last column drawn
+ */
+static inline int16_t pfont_width(const pfont_t *font, const char *str)
+{
+	int16_t w = 0;
+	uint8_t g, prev = 0xFF;
+
+	while(*str)
+	{
+		g = pfont_glyph(font, *str++);
+		if(prev != 0xFF)
+			w += font->glyphs[prev].advance + pfont_kern(font, prev, g);
+		prev = g;
+	}
+	if(prev != 0xFF)
+		w += font->glyphs[prev].width;
+	return w;
+}
+
+#endif
+
+// glyph for each character code
+const uint8_t font_prop16_map[] = {
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x04, 0x05, 0x00,
+	0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x12,
+};
+
+const uint8_t font_prop16_data[] = {
+	/* 0 ' ' */
+	/* 1 '%' */
+	0x18, 0x3C, 0x3C, 0x18, 0x00, 0x80, 0x80, 0xE0, 0xE0, 0x78, 0x78, 0x1C, 0x1C, 0x0C, 0x30, 0x38,
+	0x38, 0x1E, 0x1E, 0x07, 0x07, 0x01, 0x01, 0x00, 0x18, 0x3C, 0x3C, 0x18,
+	/* 2 '+' */
+	0xC0, 0xC0, 0xC0, 0xE0, 0xF8, 0xFC, 0xFC, 0xF8, 0xE0, 0xC0, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0x01,
+	0x07, 0x0F, 0x0F, 0x07, 0x01, 0x00, 0x00, 0x00,
+	/* 3 ',' */
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xE0, 0xF8, 0x7C, 0x7C, 0x18,
+	/* 4 '-' */
+	0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 5 '.' */
+	0x00, 0x00, 0x00, 0x00, 0x18, 0x3C, 0x3C, 0x18,
+	/* 6 '0' */
+	0xE0, 0xF8, 0xF8, 0xFE, 0x1E, 0x07, 0xC3, 0xC3, 0x07, 0x1E, 0xFE, 0xF8, 0xF8, 0xE0, 0x01, 0x07,
+	0x07, 0x1F, 0x1E, 0x38, 0x30, 0x30, 0x38, 0x1E, 0x1F, 0x07, 0x07, 0x01,
+	/* 7 '1' */
+	0x00, 0x00, 0x0C, 0x1E, 0xFE, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0x30, 0x38,
+	0x3F, 0x3F, 0x3F, 0x3F, 0x38, 0x30, 0x30, 0x30,
+	/* 8 '2' */
+	0x0C, 0x0E, 0x0E, 0x07, 0x07, 0x83, 0x83, 0xC3, 0xC3, 0xE7, 0xFF, 0x7E, 0x7E, 0x18, 0x30, 0x38,
+	0x38, 0x3E, 0x3E, 0x3F, 0x33, 0x31, 0x31, 0x38, 0x38, 0x3C, 0x3C, 0x18,
+	/* 9 '3' */
+	0x0C, 0x0E, 0x0E, 0x07, 0xC7, 0xC3, 0xC3, 0xC3, 0xC3, 0xE7, 0xFF, 0xFE, 0x3E, 0x18, 0x0C, 0x1C,
+	0x1C, 0x38, 0x38, 0x30, 0x30, 0x30, 0x30, 0x39, 0x3F, 0x1F, 0x1F, 0x06,
+	/* 10 '4' */
+	0x80, 0xE0, 0xE0, 0xF8, 0x38, 0x1E, 0x0E, 0x8F, 0xFF, 0xFF, 0xFF, 0xFE, 0x80, 0x00, 0x01, 0x03,
+	0x03, 0x03, 0x03, 0x03, 0x33, 0x33, 0x3F, 0x3F, 0x3F, 0x3F, 0x33, 0x33,
+	/* 11 '5' */
+	0x7E, 0xFF, 0xFF, 0xFF, 0xE7, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0x83, 0x83, 0x03, 0x0C, 0x1C,
+	0x1C, 0x38, 0x38, 0x30, 0x30, 0x30, 0x30, 0x39, 0x3F, 0x1F, 0x1F, 0x06,
+	/* 12 '6' */
+	0xE0, 0xF8, 0xF8, 0xFE, 0xCE, 0xC7, 0xC7, 0xC3, 0xC3, 0xC3, 0xC0, 0x80, 0x80, 0x00, 0x07, 0x1F,
+	0x1F, 0x3F, 0x39, 0x30, 0x30, 0x30, 0x30, 0x39, 0x3F, 0x1F, 0x1F, 0x06,
+	/* 13 '7' */
+	0x06, 0x0F, 0x0F, 0x07, 0x07, 0x83, 0x83, 0xE3, 0xE3, 0x73, 0x7F, 0x1F, 0x1F, 0x06, 0x00, 0x00,
+	0x00, 0x00, 0x1E, 0x3F, 0x3F, 0x1F, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+	/* 14 '8' */
+	0x18, 0x3E, 0xFE, 0xFF, 0xE7, 0xC3, 0xC3, 0xC3, 0xC3, 0xE7, 0xFF, 0xFE, 0x3E, 0x18, 0x06, 0x1F,
+	0x1F, 0x3F, 0x39, 0x30, 0x30, 0x30, 0x30, 0x39, 0x3F, 0x1F, 0x1F, 0x06,
+	/* 15 '9' */
+	0x18, 0x7E, 0x7E, 0xFF, 0xE7, 0xC3, 0xC3, 0xC3, 0xC3, 0xE7, 0xFF, 0xFE, 0xFE, 0xF8, 0x00, 0x00,
+	0x30, 0x30, 0x30, 0x30, 0x30, 0x38, 0x38, 0x1C, 0x1F, 0x07, 0x07, 0x01,
+	/* 16 ':' */
+	0x18, 0x3C, 0x3C, 0x18, 0x18, 0x3C, 0x3C, 0x18,
+	/* 17 'C' */
+	0xE0, 0xF8, 0xF8, 0xFE, 0x1E, 0x07, 0x07, 0x03, 0x03, 0x07, 0x07, 0x0E, 0x0E, 0x0C, 0x01, 0x07,
+	0x07, 0x1F, 0x1E, 0x38, 0x38, 0x30, 0x30, 0x38, 0x38, 0x1C, 0x1C, 0x0C,
+	/* 18 'F' */
+	0x03, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xC3, 0xF3, 0xF3, 0x03, 0x07, 0x0F, 0x0E, 0x30, 0x38,
+	0x3F, 0x3F, 0x3F, 0x3F, 0x38, 0x30, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00,
+};
+
+const pfont_glyph_t font_prop16_glyphs[] = {
+	{ 0, 0, 6 },	/* ' ' */
+	{ 0, 14, 16 },	/* '%' */
+	{ 28, 12, 14 },	/* '+' */
+	{ 52, 6, 8 },	/* ',' */
+	{ 64, 12, 14 },	/* '-' */
+	{ 88, 4, 6 },	/* '.' */
+	{ 96, 14, 16 },	/* '0' */
+	{ 124, 12, 14 },	/* '1' */
+	{ 148, 14, 16 },	/* '2' */
+	{ 176, 14, 16 },	/* '3' */
+	{ 204, 14, 16 },	/* '4' */
+	{ 232, 14, 16 },	/* '5' */
+	{ 260, 14, 16 },	/* '6' */
+	{ 288, 14, 16 },	/* '7' */
+	{ 316, 14, 16 },	/* '8' */
+	{ 344, 14, 16 },	/* '9' */
+	{ 372, 4, 6 },	/* ':' */
+	{ 380, 14, 16 },	/* 'C' */
+	{ 408, 14, 16 },	/* 'F' */
+};
+
+const pfont_kern_t font_prop16_kern[] = {
+	{ 3, 10, -2 }, { 3, 13, -4 }, { 3, 15, -2 }, { 4, 7, -4 }, { 4, 8, -4 }, { 4, 9, -4 },
+	{ 4, 13, -4 }, { 4, 18, -2 }, { 5, 10, -2 }, { 5, 13, -4 }, { 5, 15, -2 }, { 6, 3, -3 },
+	{ 6, 7, -3 }, { 6, 18, -2 }, { 7, 4, -4 }, { 7, 6, -3 }, { 7, 10, -4 }, { 7, 13, -4 },
+	{ 7, 15, -2 }, { 7, 17, -3 }, { 9, 3, -2 }, { 10, 13, -2 }, { 10, 15, -2 }, { 11, 3, -2 },
+	{ 12, 3, -2 }, { 12, 13, -4 }, { 12, 15, -2 }, { 13, 3, -4 }, { 13, 4, -3 }, { 13, 5, -4 },
+	{ 13, 7, -2 }, { 13, 10, -2 }, { 14, 3, -2 }, { 15, 3, -3 }, { 15, 7, -2 }, { 17, 3, -2 },
+	{ 17, 4, -4 }, { 18, 3, -4 }, { 18, 4, -4 }, { 18, 5, -4 }, { 18, 7, -2 }, { 18, 10, -3 },
+};
+
+const pfont_t font_prop16 = {
+	16, 1, 32, 70, font_prop16_map,
+	font_prop16_glyphs, font_prop16_kern, 42, font_prop16_data
+};
+
+#endif
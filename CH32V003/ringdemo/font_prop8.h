@@ -0,0 +1,400 @@
+/*
+ * font_prop8: 95 proportional glyphs 8 pixels high, 1 bpp
+ * from ../fonts/font_8x8.h (scale 1)
+ * generated by CH32V003/fonts/pfontc.py, do not edit
+ */
+
+#ifndef _FONT_PROP8_H
+#define _FONT_PROP8_H
+
+#ifndef _PFONT_TYPES
+#define _PFONT_TYPES
+
+#include <stdint.h>
+#include <stddef.h>
+
+typedef struct {
+	uint16_t offset;		// first byte in the data
+	uint8_t width;			// columns in the data
+	uint8_t advance;		// where the next glyph starts
+} pfont_glyph_t;
+
+typedef struct {
+	uint8_t left, right;	// glyphs, sorted by left and then right
+	int8_t dx;				// added to the advance of left
+} pfont_kern_t;
+
+typedef struct {
+	uint8_t height;			// rows in each glyph
+	uint8_t bpp;			// 1: pages of column bytes, 4: runs of level<<4 | (n-1)
+	uint8_t first, last;	// character codes
+	const uint8_t *map;		// glyph of each code from first, NULL if in order
+	const pfont_glyph_t *glyphs;
+	const pfont_kern_t *kern;
+	uint16_t nkern;
+	const uint8_t *data;
+} pfont_t;
+
+/*
+ * glyph for a character, characters not in the font use the space (0)
+ */
+static inline uint8_t pfont_glyph(const pfont_t *font, uint8_t c)
+{
+	if((c < font->first) || (c > font->last))
+		return 0;
+	return font->map ? font->map[c - font->first] : c - font->first;
+}
+
+/*
+ * kerning between two glyphs (binary search)
+ */
+static inline int8_t pfont_kern(const pfont_t *font, uint8_t left, uint8_t right)
+{
+	uint16_t lo = 0, hi = font->nkern;
+	uint16_t key = (left << 8) | right;
+
+	while(lo < hi)
+	{
+		uint16_t mid = (lo + hi) >> 1;
+		const pfont_kern_t *k = &font->kern[mid];
+		uint16_t v = (k->left << 8) | k->right;
+		if(v == key)
+			return k->dx;
+		if(v < key)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+	return 0;
+}
+
+/*
+ * width in pixels of a string, from the first to the last column drawn
+ */
+static inline int16_t pfont_width(const pfont_t *font, const char *str)
+{
+	int16_t w = 0;
+	uint8_t g, prev = 0xFF;
+
+	while(*str)
+	{
+		g = pfont_glyph(font, *str++);
+		if(prev != 0xFF)
+			w += font->glyphs[prev].advance + pfont_kern(font, prev, g);
+		prev = g;
+	}
+	if(prev != 0xFF)
+		w += font->glyphs[prev].width;
+	return w;
+}
+
+#endif
+
+const uint8_t font_prop8_data[] = {
+	/* 0 ' ' */
+	/* 1 '!' */
+	0x06, 0x5F, 0x5F, 0x06,
+	/* 2 '"' */
+	0x03, 0x07, 0x00, 0x00, 0x07, 0x03,
+	/* 3 '#' */
+	0x14, 0x7F, 0x7F, 0x14, 0x7F, 0x7F, 0x14,
+	/* 4 '$' */
+	0x24, 0x2E, 0x6B, 0x6B, 0x3A, 0x12,
+	/* 5 '%' */
+	0x46, 0x66, 0x30, 0x18, 0x0C, 0x66, 0x62,
+	/* 6 '&' */
+	0x30, 0x7A, 0x4F, 0x5D, 0x37, 0x7A, 0x48,
+	/* 7 ''' */
+	0x04, 0x07, 0x03,
+	/* 8 '(' */
+	0x1C, 0x3E, 0x63, 0x41,
+	/* 9 ')' */
+	0x41, 0x63, 0x3E, 0x1C,
+	/* 10 0x2A */
+	0x08, 0x2A, 0x3E, 0x1C, 0x1C, 0x3E, 0x2A, 0x08,
+	/* 11 '+' */
+	0x08, 0x08, 0x3E, 0x3E, 0x08, 0x08,
+	/* 12 ',' */
+	0x80, 0xE0, 0x60,
+	/* 13 '-' */
+	0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+	/* 14 '.' */
+	0x60, 0x60,
+	/* 15 0x2F */
+	0x60, 0x30, 0x18, 0x0C, 0x06, 0x03, 0x01,
+	/* 16 '0' */
+	0x1C, 0x3E, 0x63, 0x49, 0x63, 0x3E, 0x1C,
+	/* 17 '1' */
+	0x40, 0x42, 0x7F, 0x7F, 0x40, 0x40,
+	/* 18 '2' */
+	0x42, 0x63, 0x71, 0x59, 0x49, 0x6F, 0x66,
+	/* 19 '3' */
+	0x22, 0x63, 0x49, 0x49, 0x49, 0x7F, 0x36,
+	/* 20 '4' */
+	0x18, 0x1C, 0x16, 0x53, 0x7F, 0x7F, 0x50,
+	/* 21 '5' */
+	0x2F, 0x6F, 0x49, 0x49, 0x49, 0x79, 0x31,
+	/* 22 '6' */
+	0x3C, 0x7E, 0x4B, 0x49, 0x49, 0x78, 0x30,
+	/* 23 '7' */
+	0x03, 0x03, 0x71, 0x79, 0x0D, 0x07, 0x03,
+	/* 24 '8' */
+	0x36, 0x7F, 0x49, 0x49, 0x49, 0x7F, 0x36,
+	/* 25 '9' */
+	0x06, 0x4F, 0x49, 0x49, 0x69, 0x3F, 0x1E,
+	/* 26 ':' */
+	0x66, 0x66,
+	/* 27 ';' */
+	0x80, 0xE6, 0x66,
+	/* 28 '<' */
+	0x08, 0x1C, 0x36, 0x63, 0x41,
+	/* 29 '=' */
+	0x24, 0x24, 0x24, 0x24, 0x24, 0x24,
+	/* 30 '>' */
+	0x41, 0x63, 0x36, 0x1C, 0x08,
+	/* 31 '?' */
+	0x02, 0x03, 0x01, 0x59, 0x5D, 0x07, 0x02,
+	/* 32 '@' */
+	0x3E, 0x7F, 0x41, 0x5D, 0x5D, 0x1F, 0x1E,
+	/* 33 'A' */
+	0x7C, 0x7E, 0x0B, 0x09, 0x0B, 0x7E, 0x7C,
+	/* 34 'B' */
+	0x41, 0x7F, 0x7F, 0x49, 0x49, 0x7F, 0x36,
+	/* 35 'C' */
+	0x1C, 0x3E, 0x63, 0x41, 0x41, 0x63, 0x22,
+	/* 36 'D' */
+	0x41, 0x7F, 0x7F, 0x41, 0x63, 0x3E, 0x1C,
+	/* 37 'E' */
+	0x41, 0x7F, 0x7F, 0x49, 0x5D, 0x41, 0x63,
+	/* 38 'F' */
+	0x41, 0x7F, 0x7F, 0x49, 0x1D, 0x01, 0x03,
+	/* 39 'G' */
+	0x1C, 0x3E, 0x63, 0x41, 0x51, 0x33, 0x72,
+	/* 40 'H' */
+	0x7F, 0x7F, 0x08, 0x08, 0x08, 0x7F, 0x7F,
+	/* 41 'I' */
+	0x41, 0x7F, 0x7F, 0x41,
+	/* 42 'J' */
+	0x30, 0x70, 0x40, 0x41, 0x7F, 0x3F, 0x01,
+	/* 43 'K' */
+	0x41, 0x7F, 0x7F, 0x08, 0x1C, 0x77, 0x63,
+	/* 44 'L' */
+	0x41, 0x7F, 0x7F, 0x41, 0x40, 0x60, 0x70,
+	/* 45 'M' */
+	0x7F, 0x7F, 0x0E, 0x1C, 0x0E, 0x7F, 0x7F,
+	/* 46 'N' */
+	0x7F, 0x7F, 0x06, 0x0C, 0x18, 0x7F, 0x7F,
+	/* 47 'O' */
+	0x3E, 0x7F, 0x41, 0x41, 0x41, 0x7F, 0x3E,
+	/* 48 'P' */
+	0x41, 0x7F, 0x7F, 0x49, 0x09, 0x0F, 0x06,
+	/* 49 'Q' */
+	0x3E, 0x7F, 0x41, 0x41, 0xE1, 0xFF, 0xBE,
+	/* 50 'R' */
+	0x41, 0x7F, 0x7F, 0x09, 0x19, 0x7F, 0x66,
+	/* 51 'S' */
+	0x22, 0x67, 0x4D, 0x59, 0x73, 0x22,
+	/* 52 'T' */
+	0x07, 0x43, 0x7F, 0x7F, 0x43, 0x07,
+	/* 53 'U' */
+	0x3F, 0x7F, 0x40, 0x40, 0x40, 0x7F, 0x3F,
+	/* 54 'V' */
+	0x1F, 0x3F, 0x60, 0x40, 0x60, 0x3F, 0x1F,
+	/* 55 'W' */
+	0x3F, 0x7F, 0x60, 0x38, 0x60, 0x7F, 0x3F,
+	/* 56 'X' */
+	0x63, 0x77, 0x1C, 0x08, 0x1C, 0x77, 0x63,
+	/* 57 'Y' */
+	0x07, 0x4F, 0x78, 0x78, 0x4F, 0x07,
+	/* 58 'Z' */
+	0x47, 0x63, 0x71, 0x59, 0x4D, 0x67, 0x73,
+	/* 59 '[' */
+	0x7F, 0x7F, 0x41, 0x41,
+	/* 60 0x5C */
+	0x01, 0x03, 0x06, 0x0C, 0x18, 0x30, 0x60,
+	/* 61 ']' */
+	0x41, 0x41, 0x7F, 0x7F,
+	/* 62 '^' */
+	0x08, 0x0C, 0x06, 0x03, 0x06, 0x0C, 0x08,
+	/* 63 '_' */
+	0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+	/* 64 '`' */
+	0x01, 0x03, 0x06, 0x04,
+	/* 65 'a' */
+	0x20, 0x74, 0x54, 0x54, 0x3C, 0x78, 0x40,
+	/* 66 'b' */
+	0x41, 0x7F, 0x3F, 0x44, 0x44, 0x7C, 0x38,
+	/* 67 'c' */
+	0x38, 0x7C, 0x44, 0x44, 0x44, 0x6C, 0x28,
+	/* 68 'd' */
+	0x38, 0x7C, 0x44, 0x45, 0x3F, 0x7F, 0x40,
+	/* 69 'e' */
+	0x38, 0x7C, 0x54, 0x54, 0x54, 0x5C, 0x18,
+	/* 70 'f' */
+	0x48, 0x7E, 0x7F, 0x49, 0x09, 0x03, 0x02,
+	/* 71 'g' */
+	0x98, 0xBC, 0xA4, 0xA4, 0xF8, 0x7C, 0x04,
+	/* 72 'h' */
+	0x41, 0x7F, 0x7F, 0x08, 0x04, 0x7C, 0x78,
+	/* 73 'i' */
+	0x44, 0x7D, 0x7D, 0x40,
+	/* 74 'j' */
+	0x60, 0xE0, 0x80, 0x80, 0xFD, 0x7D,
+	/* 75 'k' */
+	0x41, 0x7F, 0x7F, 0x10, 0x38, 0x6C, 0x44,
+	/* 76 'l' */
+	0x41, 0x7F, 0x7F, 0x40,
+	/* 77 'm' */
+	0x7C, 0x7C, 0x0C, 0x78, 0x0C, 0x7C, 0x78,
+	/* 78 'n' */
+	0x04, 0x7C, 0x78, 0x04, 0x04, 0x7C, 0x78,
+	/* 79 'o' */
+	0x38, 0x7C, 0x44, 0x44, 0x44, 0x7C, 0x38,
+	/* 80 'p' */
+	0x84, 0xFC, 0xF8, 0xA4, 0x24, 0x3C, 0x18,
+	/* 81 'q' */
+	0x18, 0x3C, 0x24, 0xA4, 0xF8, 0xFC, 0x84,
+	/* 82 'r' */
+	0x44, 0x7C, 0x78, 0x4C, 0x04, 0x0C, 0x08,
+	/* 83 's' */
+	0x48, 0x5C, 0x54, 0x54, 0x54, 0x74, 0x24,
+	/* 84 't' */
+	0x04, 0x04, 0x3F, 0x7F, 0x44, 0x64, 0x20,
+	/* 85 'u' */
+	0x3C, 0x7C, 0x40, 0x40, 0x3C, 0x7C, 0x40,
+	/* 86 'v' */
+	0x1C, 0x3C, 0x60, 0x40, 0x60, 0x3C, 0x1C,
+	/* 87 'w' */
+	0x3C, 0x7C, 0x60, 0x38, 0x60, 0x7C, 0x3C,
+	/* 88 'x' */
+	0x44, 0x6C, 0x38, 0x10, 0x38, 0x6C, 0x44,
+	/* 89 'y' */
+	0x9C, 0xBC, 0xA0, 0xA0, 0xA0, 0xFC, 0x7C,
+	/* 90 'z' */
+	0x4C, 0x64, 0x74, 0x5C, 0x4C, 0x64,
+	/* 91 '{' */
+	0x08, 0x08, 0x3E, 0x77, 0x41, 0x41,
+	/* 92 '|' */
+	0x7F, 0x7F,
+	/* 93 '}' */
+	0x41, 0x41, 0x77, 0x3E, 0x08, 0x08,
+	/* 94 '~' */
+	0x02, 0x03, 0x01, 0x03, 0x02, 0x03, 0x01,
+};
+
+const pfont_glyph_t font_prop8_glyphs[] = {
+	{ 0, 0, 3 },	/* ' ' */
+	{ 0, 4, 5 },	/* '!' */
+	{ 4, 6, 7 },	/* '"' */
+	{ 10, 7, 8 },	/* '#' */
+	{ 17, 6, 7 },	/* '$' */
+	{ 23, 7, 8 },	/* '%' */
+	{ 30, 7, 8 },	/* '&' */
+	{ 37, 3, 4 },	/* ''' */
+	{ 40, 4, 5 },	/* '(' */
+	{ 44, 4, 5 },	/* ')' */
+	{ 48, 8, 9 },	/* 0x2A */
+	{ 56, 6, 7 },	/* '+' */
+	{ 62, 3, 4 },	/* ',' */
+	{ 65, 6, 7 },	/* '-' */
+	{ 71, 2, 3 },	/* '.' */
+	{ 73, 7, 8 },	/* 0x2F */
+	{ 80, 7, 8 },	/* '0' */
+	{ 87, 6, 7 },	/* '1' */
+	{ 93, 7, 8 },	/* '2' */
+	{ 100, 7, 8 },	/* '3' */
+	{ 107, 7, 8 },	/* '4' */
+	{ 114, 7, 8 },	/* '5' */
+	{ 121, 7, 8 },	/* '6' */
+	{ 128, 7, 8 },	/* '7' */
+	{ 135, 7, 8 },	/* '8' */
+	{ 142, 7, 8 },	/* '9' */
+	{ 149, 2, 3 },	/* ':' */
+	{ 151, 3, 4 },	/* ';' */
+	{ 154, 5, 6 },	/* '<' */
+	{ 159, 6, 7 },	/* '=' */
+	{ 165, 5, 6 },	/* '>' */
+	{ 170, 7, 8 },	/* '?' */
+	{ 177, 7, 8 },	/* '@' */
+	{ 184, 7, 8 },	/* 'A' */
+	{ 191, 7, 8 },	/* 'B' */
+	{ 198, 7, 8 },	/* 'C' */
+	{ 205, 7, 8 },	/* 'D' */
+	{ 212, 7, 8 },	/* 'E' */
+	{ 219, 7, 8 },	/* 'F' */
+	{ 226, 7, 8 },	/* 'G' */
+	{ 233, 7, 8 },	/* 'H' */
+	{ 240, 4, 5 },	/* 'I' */
+	{ 244, 7, 8 },	/* 'J' */
+	{ 251, 7, 8 },	/* 'K' */
+	{ 258, 7, 8 },	/* 'L' */
+	{ 265, 7, 8 },	/* 'M' */
+	{ 272, 7, 8 },	/* 'N' */
+	{ 279, 7, 8 },	/* 'O' */
+	{ 286, 7, 8 },	/* 'P' */
+	{ 293, 7, 8 },	/* 'Q' */
+	{ 300, 7, 8 },	/* 'R' */
+	{ 307, 6, 7 },	/* 'S' */
+	{ 313, 6, 7 },	/* 'T' */
+	{ 319, 7, 8 },	/* 'U' */
+	{ 326, 7, 8 },	/* 'V' */
+	{ 333, 7, 8 },	/* 'W' */
+	{ 340, 7, 8 },	/* 'X' */
+	{ 347, 6, 7 },	/* 'Y' */
+	{ 353, 7, 8 },	/* 'Z' */
+	{ 360, 4, 5 },	/* '[' */
+	{ 364, 7, 8 },	/* 0x5C */
+	{ 371, 4, 5 },	/* ']' */
+	{ 375, 7, 8 },	/* '^' */
+	{ 382, 8, 9 },	/* '_' */
+	{ 390, 4, 5 },	/* '`' */
+	{ 394, 7, 8 },	/* 'a' */
+	{ 401, 7, 8 },	/* 'b' */
+	{ 408, 7, 8 },	/* 'c' */
+	{ 415, 7, 8 },	/* 'd' */
+	{ 422, 7, 8 },	/* 'e' */
+	{ 429, 7, 8 },	/* 'f' */
+	{ 436, 7, 8 },	/* 'g' */
+	{ 443, 7, 8 },	/* 'h' */
+	{ 450, 4, 5 },	/* 'i' */
+	{ 454, 6, 7 },	/* 'j' */
+	{ 460, 7, 8 },	/* 'k' */
+	{ 467, 4, 5 },	/* 'l' */
+	{ 471, 7, 8 },	/* 'm' */
+	{ 478, 7, 8 },	/* 'n' */
+	{ 485, 7, 8 },	/* 'o' */
+	{ 492, 7, 8 },	/* 'p' */
+	{ 499, 7, 8 },	/* 'q' */
+	{ 506, 7, 8 },	/* 'r' */
+	{ 513, 7, 8 },	/* 's' */
+	{ 520, 7, 8 },	/* 't' */
+	{ 527, 7, 8 },	/* 'u' */
+	{ 534, 7, 8 },	/* 'v' */
+	{ 541, 7, 8 },	/* 'w' */
+	{ 548, 7, 8 },	/* 'x' */
+	{ 555, 7, 8 },	/* 'y' */
+	{ 562, 6, 7 },	/* 'z' */
+	{ 568, 6, 7 },	/* '{' */
+	{ 574, 2, 3 },	/* '|' */
+	{ 576, 6, 7 },	/* '}' */
+	{ 582, 7, 8 },	/* '~' */
+};
+
+const pfont_kern_t font_prop8_kern[] = {
+	{ 2, 42, -2 }, { 2, 74, -2 }, { 7, 42, -2 }, { 7, 74, -2 }, { 12, 23, -2 }, { 12, 84, -2 },
+	{ 13, 17, -2 }, { 13, 18, -2 }, { 13, 19, -2 }, { 13, 23, -2 }, { 13, 74, -2 }, { 14, 23, -2 },
+	{ 14, 84, -2 }, { 17, 2, -2 }, { 17, 7, -2 }, { 17, 13, -2 }, { 17, 20, -2 }, { 17, 23, -2 },
+	{ 17, 84, -2 }, { 22, 2, -2 }, { 22, 23, -2 }, { 23, 12, -2 }, { 23, 14, -2 }, { 23, 42, -2 },
+	{ 23, 74, -2 }, { 35, 13, -2 }, { 37, 13, -2 }, { 38, 12, -2 }, { 38, 13, -2 }, { 38, 14, -2 },
+	{ 38, 42, -2 }, { 38, 74, -2 }, { 42, 12, -2 }, { 44, 2, -2 }, { 44, 7, -2 }, { 44, 23, -2 },
+	{ 44, 84, -2 }, { 48, 12, -2 }, { 48, 14, -2 }, { 48, 74, -2 }, { 65, 2, -2 }, { 65, 23, -2 },
+	{ 70, 12, -2 }, { 70, 13, -2 }, { 70, 14, -2 }, { 70, 42, -2 }, { 70, 74, -2 }, { 82, 12, -2 },
+	{ 82, 14, -2 }, { 82, 17, -2 }, { 82, 74, -2 },
+};
+
+const pfont_t font_prop8 = {
+	8, 1, 32, 126, NULL,
+	font_prop8_glyphs, font_prop8_kern, 51, font_prop8_data
+};
+
+#endif
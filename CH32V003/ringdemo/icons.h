@@ -0,0 +1,35 @@
+/*
+ * Sprites for ssd1306_sprite.h, generated by sprconv.py from icons/
+ */
+
+// icon_thermo: 9x20 from icons/thermo.pbm
+const uint8_t icon_thermo_data[] =
+{
+	0x00, 0x00, 0xFE, 0x01, 0xFD, 0x01, 0xFE, 0x00, 0x00,
+	0xC0, 0x20, 0x9F, 0xC0, 0xFF, 0xC0, 0x9F, 0x20, 0xC0,
+	0x03, 0x04, 0x09, 0x0B, 0x0B, 0x0B, 0x09, 0x04, 0x03,
+};
+const uint8_t icon_thermo_mask[] =
+{
+	0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00,
+	0xC0, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xC0,
+	0x03, 0x07, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x07, 0x03,
+};
+const ssd1306_sprite_t icon_thermo = { 9, 20, icon_thermo_data, icon_thermo_mask };
+
+// icon_fan1: 11x11 from icons/fan1.pbm
+const uint8_t icon_fan1_data[] =
+{
+	0x70, 0x70, 0x20, 0x20, 0x23, 0xFF, 0x23, 0x20, 0x20, 0x70, 0x70,
+	0x00, 0x00, 0x00, 0x00, 0x06, 0x07, 0x06, 0x00, 0x00, 0x00, 0x00,
+};
+const ssd1306_sprite_t icon_fan1 = { 11, 11, icon_fan1_data, NULL };
+
+// icon_fan2: 11x11 from icons/fan2.pbm
+const uint8_t icon_fan2_data[] =
+{
+	0x03, 0x07, 0x06, 0x88, 0x50, 0x20, 0x50, 0x88, 0x06, 0x07, 0x03,
+	0x06, 0x07, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x07, 0x06,
+};
+const ssd1306_sprite_t icon_fan2 = { 11, 11, icon_fan2_data, NULL };
+
@@ -0,0 +1,831 @@
+/*
+ * OLED simulator - runs ssd1306.h on a PC through ssd1306_host.h
+ *
+ * Draws a scene for each drawing primitive and saves the panel image,
+ * or compares it with images saved before (golden images).
+ *
+ * Build:   gcc -O2 -I../common -o oledsim oledsim.c
+ *          (add -DSSD1306_128X64 or -DSSD1306_64X32 for other panels,
+ *          -DSSD1306_STATS for the frame statistics)
+ * Use:     ./oledsim -w dir    save PGM (1:1) and PNG (4:1) images in dir
+ *          ./oledsim -c dir    compare with the PGM images in dir
+ *          ./oledsim -b        check and time the fast drawing functions
+ *                              against per-pixel versions
+ */
+
+#if !defined (SSD1306_64X32) && !defined (SSD1306_128X32) && !defined (SSD1306_128X64)
+#define SSD1306_128X32
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "ssd1306.h"
+#include "ssd1306_host.h"
+#include "ssd1306_sprite.h"
+#include "icons.h"
+#include "font_prop8.h"
+#include "font_prop16.h"
+#include "ssd1306_pfont.h"
+#include "ssd1306_console.h"
+#define UI_DECIMAL_POINT ','
+#include "ui_fields.h"
+
+// 16x8 test image, for ssd1306_drawImage
+const unsigned char test_image[] =
+{
+	0xFF, 0xFF,
+	0x81, 0x01,
+	0xBD, 0x3D,
+	0xA5, 0x25,
+	0xA5, 0x25,
+	0xBD, 0x3D,
+	0x81, 0x01,
+	0xFF, 0xFF,
+};
+
+void scene_setbuf(void)
+{
+	ssd1306_setbuf(1);
+}
+
+void scene_pixel(void)
+{
+	for(int i=0;i<SSD1306_H;i+=3)
+		ssd1306_drawPixel(i*2, i, 1);
+	ssd1306_drawPixel(SSD1306_W-1, SSD1306_H-1, 1);
+	ssd1306_drawPixel(SSD1306_W, 0, 1);
+}
+
+void scene_xorpixel(void)
+{
+	ssd1306_fillRect(0, 0, SSD1306_W/2, SSD1306_H, 1);
+	for(int i=0;i<SSD1306_H;i++)
+		ssd1306_xorPixel(SSD1306_W/2 - SSD1306_H/2 + i, i);
+}
+
+void scene_image(void)
+{
+	for(int m=0;m<6;m++)
+		ssd1306_drawImage(m*10, m*4, test_image, 16, 8, m);
+}
+
+void scene_vline(void)
+{
+	for(int i=0;i<16;i++)
+		ssd1306_drawFastVLine(i*4, i, SSD1306_H-2*i, 1);
+	ssd1306_drawFastVLine(SSD1306_W-1, 5, 100, 1);
+}
+
+void scene_hline(void)
+{
+	for(int i=0;i<SSD1306_H;i+=2)
+		ssd1306_drawFastHLine(i, i, SSD1306_W-3*i, 1);
+	ssd1306_drawFastHLine(SSD1306_W-10, 1, 50, 1);
+}
+
+void scene_line(void)
+{
+	ssd1306_drawLine(0, 0, SSD1306_W-1, SSD1306_H-1, 1);
+	ssd1306_drawLine(0, SSD1306_H-1, SSD1306_W-1, 0, 1);
+	ssd1306_drawLine(SSD1306_W/2, 0, SSD1306_W/2+5, SSD1306_H-1, 1);
+}
+
+void scene_circle(void)
+{
+	ssd1306_drawCircle(SSD1306_W/4, SSD1306_H/2, SSD1306_H/2-1, 1);
+	ssd1306_drawCircle(SSD1306_W/2, SSD1306_H/2, SSD1306_H, 1);
+	ssd1306_drawCircle(SSD1306_W-4, 4, 10, 1);
+}
+
+void scene_fillcircle(void)
+{
+	ssd1306_fillCircle(SSD1306_W/4, SSD1306_H/2, SSD1306_H/2-1, 1);
+	ssd1306_fillCircle(SSD1306_W/2, SSD1306_H/2, SSD1306_H/3, 1);
+	ssd1306_fillCircle(SSD1306_W/2, SSD1306_H/2, SSD1306_H/6, 0);
+	ssd1306_fillCircle(SSD1306_W-4, 4, 10, 1);
+}
+
+void scene_rect(void)
+{
+	ssd1306_drawRect(0, 0, SSD1306_W, SSD1306_H, 1);
+	ssd1306_drawRect(3, 5, 20, 9, 1);
+	ssd1306_drawRect(SSD1306_W-8, 10, 20, 40, 1);
+}
+
+void scene_fillrect(void)
+{
+	ssd1306_fillRect(1, 1, SSD1306_W/2, SSD1306_H-5, 1);
+	ssd1306_fillRect(10, 3, 13, 11, 0);
+	ssd1306_fillRect(SSD1306_W-8, 3, 20, 7, 1);
+}
+
+void scene_xorrect(void)
+{
+	ssd1306_fillRect(0, 0, SSD1306_W/2, SSD1306_H, 1);
+	ssd1306_xorrect(SSD1306_W/4, 3, SSD1306_W/2, SSD1306_H-6);
+}
+
+void scene_char(void)
+{
+	for(int i=0;i<8;i++)
+		ssd1306_drawchar(i*9, i*3, 'A'+i, i&1);
+}
+
+void scene_str(void)
+{
+	ssd1306_drawstr(0, 0, "Temperatura:", 1);
+	ssd1306_drawstr(5, 13, "0123456789ABCDEFGHIJ", 1);
+	ssd1306_fillRect(0, 22, SSD1306_W, 10, 1);
+	ssd1306_drawstr(2, 23, "inverse", 0);
+}
+
+void scene_char_sz(void)
+{
+	ssd1306_drawchar_sz(0, 0, '2', 1, fontsize_16x16);
+	ssd1306_drawchar_sz(17, 3, '5', 1, fontsize_16x16);
+	ssd1306_drawchar_sz(40, 0, 'C', 1, fontsize_32x32);
+	ssd1306_drawchar_sz(80, 5, 'x', 0, fontsize_32x32);
+}
+
+void scene_str_sz(void)
+{
+	ssd1306_drawstr(0, 0, "Temperatura:", 1);
+	ssd1306_drawstr_sz(0, 12, "25,3C", 1, fontsize_16x16);
+}
+
+/*
+ * per-pixel versions of the drawing functions, as they were before
+ * the optimizations, used as reference for results and speed
+ */
+void ref_drawFastVLine(uint8_t x, uint8_t y, uint8_t h, uint8_t color)
+{
+	if((x >= SSD1306_W) || (y >= SSD1306_H)) return;
+	if((y+h-1) >= SSD1306_H) h = SSD1306_H-y;
+	while(h--)
+		ssd1306_drawPixel(x, y++, color);
+}
+
+void ref_drawFastHLine(uint8_t x, uint8_t y, uint8_t w, uint8_t color)
+{
+	if((x >= SSD1306_W) || (y >= SSD1306_H)) return;
+	if((x+w-1) >= SSD1306_W)  w = SSD1306_W-x;
+	while (w--)
+		ssd1306_drawPixel(x++, y, color);
+}
+
+void ref_fillRect(uint8_t x, uint8_t y, uint8_t w, uint8_t h, uint8_t color)
+{
+	uint8_t m, n=y, iw = w;
+	while(h--)
+	{
+		m=x;
+		w=iw;
+		while(w--)
+			ssd1306_drawPixel(m++, n, color);
+		n++;
+	}
+}
+
+void ref_xorrect(uint8_t x, uint8_t y, uint8_t w, uint8_t h, uint8_t color)
+{
+	uint8_t m, n=y, iw = w;
+	while(h--)
+	{
+		m=x;
+		w=iw;
+		while(w--)
+			ssd1306_xorPixel(m++, n);
+		n++;
+	}
+}
+
+void ref_fillCircle(uint8_t x, uint8_t y, uint8_t radius, uint8_t unused, uint8_t color)
+{
+	int16_t x_pos = -radius;
+	int16_t y_pos = 0;
+	int16_t err = 2 - 2 * radius;
+	int16_t e2;
+
+	do {
+		ssd1306_drawPixel(x - x_pos, y + y_pos, color);
+		ssd1306_drawPixel(x + x_pos, y + y_pos, color);
+		ssd1306_drawPixel(x + x_pos, y - y_pos, color);
+		ssd1306_drawPixel(x - x_pos, y - y_pos, color);
+		ref_drawFastHLine(x + x_pos, y + y_pos, 2 * (-x_pos) + 1, color);
+		ref_drawFastHLine(x + x_pos, y - y_pos, 2 * (-x_pos) + 1, color);
+		e2 = err;
+		if (e2 <= y_pos) {
+			err += ++y_pos * 2 + 1;
+			if(-x_pos == y_pos && e2 <= x_pos)
+				e2 = 0;
+		}
+		if(e2 > x_pos)
+			err += ++x_pos * 2 + 1;
+	} while(x_pos <= 0);
+}
+
+void ref_drawchar(uint8_t x, uint8_t y, uint8_t chr, uint8_t unused, uint8_t color)
+{
+	uint16_t i, j, col;
+	uint8_t d;
+
+	for(i=0;i<8;i++)
+	{
+		d = fontdata[(chr<<3)+i];
+		for(j=0;j<8;j++)
+		{
+			if(d&0x80)
+				col = color;
+			else
+				col = (~color)&1;
+			ssd1306_drawPixel(x+j, y+i, col);
+			d <<= 1;
+		}
+	}
+}
+
+void ref_drawchar_sz(uint8_t x, uint8_t y, uint8_t chr, uint8_t color, font_size_t font_size)
+{
+	uint16_t i, j, col;
+	uint8_t d, font_scale = (uint8_t)font_size;
+
+	for (i = 0; i < 8; i++)
+	{
+		d = fontdata[(chr << 3) + i];
+		for (j = 0; j < 8; j++)
+		{
+			if (d & 0x80)
+				col = color;
+			else
+				col = (~color) & 1;
+			for (uint8_t k = 0; k < font_scale; k++)
+				for (uint8_t l = 0; l < font_scale; l++)
+					ssd1306_drawPixel(x + (j * font_scale) + k, y + (i * font_scale) + l, col);
+			d <<= 1;
+		}
+	}
+}
+
+void ref_drawstr_sz(uint8_t x, uint8_t y, char *str, uint8_t color, font_size_t font_size)
+{
+	uint8_t c;
+
+	while((c=*str++))
+	{
+		ref_drawchar_sz(x, y, c, color, font_size);
+		x += 8 * font_size;
+		if(x>128 - 8 * font_size)
+			break;
+	}
+}
+
+void ref_sprite_draw(const ssd1306_sprite_t *spr, int16_t x, int16_t y, uint8_t mode)
+{
+	for(int i=0;i<spr->h;i++)
+		for(int j=0;j<spr->w;j++)
+		{
+			int px = x+j, py = y+i, k = (i/8)*spr->w + j;
+			if((px < 0) || (px >= SSD1306_W) || (py < 0) || (py >= SSD1306_H))
+				continue;
+			if(spr->mask && !((spr->mask[k] >> (i&7)) & 1))
+				continue;
+			uint8_t d = (spr->data[k] >> (i&7)) & 1;
+			switch(mode)
+			{
+				case 0: ssd1306_drawPixel(px, py, d); break;
+				case 1: ssd1306_drawPixel(px, py, !d); break;
+				case 2: if(!d) ssd1306_drawPixel(px, py, 0); break;
+				case 3: if(d) ssd1306_drawPixel(px, py, 1); break;
+				case 4: if(!d) ssd1306_drawPixel(px, py, 1); break;
+				case 5: if(d) ssd1306_drawPixel(px, py, 0); break;
+				case 6: if(d) ssd1306_xorPixel(px, py); break;
+			}
+		}
+}
+
+int16_t ref_drawpstr(const pfont_t *font, int16_t x, int16_t y, const char *str, uint8_t color)
+{
+	uint8_t g, prev = 0xFF;
+
+	while(*str)
+	{
+		g = pfont_glyph(font, *str++);
+		if(prev != 0xFF)
+			x += font->glyphs[prev].advance + pfont_kern(font, prev, g);
+		if(x >= SSD1306_W)
+			return x;
+		const pfont_glyph_t *pg = &font->glyphs[g];
+		for(int i=0;i<font->height;i++)
+			for(int j=0;j<pg->width;j++)
+			{
+				int px = x+j, py = y+i;
+				if((px < 0) || (px >= SSD1306_W) || (py < 0) || (py >= SSD1306_H))
+					continue;
+				if((font->data[pg->offset + (i/8)*pg->width + j] >> (i&7)) & 1)
+					ssd1306_drawPixel(px, py, color);
+			}
+		prev = g;
+	}
+	if(prev != 0xFF)
+		x += font->glyphs[prev].advance;
+	return x;
+}
+
+/*
+ * adapters so all functions can be called the same way
+ */
+void fast_xorrect(uint8_t x, uint8_t y, uint8_t w, uint8_t h, uint8_t color)
+{
+	ssd1306_xorrect(x, y, w, h);
+}
+
+void fast_fillCircle(uint8_t x, uint8_t y, uint8_t radius, uint8_t unused, uint8_t color)
+{
+	ssd1306_fillCircle(x, y, radius, color);
+}
+
+void ref_vline(uint8_t x, uint8_t y, uint8_t w, uint8_t h, uint8_t color)
+{
+	ref_drawFastVLine(x, y, h, color);
+}
+
+void fast_vline(uint8_t x, uint8_t y, uint8_t w, uint8_t h, uint8_t color)
+{
+	ssd1306_drawFastVLine(x, y, h, color);
+}
+
+void ref_hline(uint8_t x, uint8_t y, uint8_t w, uint8_t h, uint8_t color)
+{
+	ref_drawFastHLine(x, y, w, color);
+}
+
+void fast_hline(uint8_t x, uint8_t y, uint8_t w, uint8_t h, uint8_t color)
+{
+	ssd1306_drawFastHLine(x, y, w, color);
+}
+
+void fast_drawchar(uint8_t x, uint8_t y, uint8_t chr, uint8_t unused, uint8_t color)
+{
+	ssd1306_drawchar(x, y, chr, color);
+}
+
+/* h selects the size: 16x16, 32x32 or 64x64 */
+void ref_char_sz(uint8_t x, uint8_t y, uint8_t chr, uint8_t h, uint8_t color)
+{
+	ref_drawchar_sz(x, y, chr, color, 2 << (h % 3));
+}
+
+void fast_char_sz(uint8_t x, uint8_t y, uint8_t chr, uint8_t h, uint8_t color)
+{
+	ssd1306_drawchar_sz(x, y, chr, color, 2 << (h % 3));
+}
+
+/* w selects the sprite, h the mode, x and y are moved to have negative values */
+const ssd1306_sprite_t *bench_sprites[] = { &icon_thermo, &icon_fan1, &icon_fan2 };
+
+void ref_sprite(uint8_t x, uint8_t y, uint8_t w, uint8_t h, uint8_t color)
+{
+	ref_sprite_draw(bench_sprites[w % 3], x - 16, y - 16, h % 7);
+}
+
+void fast_sprite(uint8_t x, uint8_t y, uint8_t w, uint8_t h, uint8_t color)
+{
+	ssd1306_sprite_draw(bench_sprites[w % 3], x - 16, y - 16, h % 7);
+}
+
+/* w selects the string, h the font, x and y are moved to have negative values */
+const char *bench_strings[] = { "Temperatura: 25,3C", "F.r, Pj 7.", "0123456789", "-12.5%" };
+const pfont_t *bench_pfonts[] = { &font_prop8, &font_prop16 };
+
+void ref_pstr(uint8_t x, uint8_t y, uint8_t w, uint8_t h, uint8_t color)
+{
+	ref_drawpstr(bench_pfonts[h & 1], x - 16, y - 16, bench_strings[w & 3], color);
+}
+
+void fast_pstr(uint8_t x, uint8_t y, uint8_t w, uint8_t h, uint8_t color)
+{
+	ssd1306_drawpstr(bench_pfonts[h & 1], x - 16, y - 16, bench_strings[w & 3], color);
+}
+
+typedef void (*drawfn_t)(uint8_t x, uint8_t y, uint8_t w, uint8_t h, uint8_t color);
+
+typedef struct {
+	const char *name;
+	drawfn_t ref, fast;
+	uint8_t maxsz;		// maximum w and h of random calls
+} bench_t;
+
+const bench_t benches[] =
+{
+	{ "vline", ref_vline, fast_vline, 255 },
+	{ "hline", ref_hline, fast_hline, 255 },
+	{ "fillRect", ref_fillRect, ssd1306_fillRect, 255 },
+	{ "xorrect", ref_xorrect, fast_xorrect, 255 },
+	{ "fillCircle", ref_fillCircle, fast_fillCircle, 40 },
+	{ "drawchar", ref_drawchar, fast_drawchar, 255 },
+	{ "drawchar_sz", ref_char_sz, fast_char_sz, 255 },
+	{ "sprite", ref_sprite, fast_sprite, 255 },
+	{ "pstr", ref_pstr, fast_pstr, 255 },
+};
+
+#define NBENCHES (sizeof(benches)/sizeof(benches[0]))
+#define NCALLS 2000
+
+uint32_t seed = 1;
+
+uint8_t rnd8(void)
+{
+	seed = seed * 1103515245 + 12345;
+	return seed >> 16;
+}
+
+/*
+ * cycle counter on x86, nanoseconds elsewhere
+ */
+uint64_t cycles(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+	return __builtin_ia32_rdtsc();
+#else
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec*1000000000ull + ts.tv_nsec;
+#endif
+}
+
+/*
+ * run NCALLS calls of a function and return the cycles taken
+ */
+uint64_t run_calls(drawfn_t fn, uint8_t args[][5])
+{
+	uint64_t start = cycles();
+	for(int i=0;i<NCALLS;i++)
+		fn(args[i][0], args[i][1], args[i][2], args[i][3], args[i][4]);
+	return cycles() - start;
+}
+
+/*
+ * check the fast functions give the same result as the per-pixel ones
+ * with random arguments (including coordinates that wrap past 255)
+ * and compare their speed
+ */
+int bench(void)
+{
+	static uint8_t args[NCALLS][5];
+	uint8_t start[sizeof(ssd1306_buffer)], ref[sizeof(ssd1306_buffer)];
+	uint64_t tref, tfast;
+	int errors = 0;
+
+	printf("%-12s %14s %14s %8s\n", "function", "ref cyc/call", "fast cyc/call", "speedup");
+	for(unsigned b=0;b<NBENCHES;b++)
+	{
+		for(int i=0;i<NCALLS;i++)
+		{
+			/* mostly on screen, some anywhere */
+			uint8_t any = (rnd8() & 7) == 0;
+			args[i][0] = any ? rnd8() : rnd8() % (SSD1306_W+8);
+			args[i][1] = any ? rnd8() : rnd8() % (SSD1306_H+8);
+			args[i][2] = rnd8() % (benches[b].maxsz+1);
+			args[i][3] = rnd8() % (benches[b].maxsz+1);
+			args[i][4] = rnd8() & 1;
+		}
+		for(unsigned i=0;i<sizeof(start);i++)
+			start[i] = rnd8();
+
+		memcpy(ssd1306_buffer, start, sizeof(start));
+		tref = run_calls(benches[b].ref, args);
+		memcpy(ref, ssd1306_buffer, sizeof(ref));
+
+		memcpy(ssd1306_buffer, start, sizeof(start));
+		tfast = run_calls(benches[b].fast, args);
+
+		if(memcmp(ref, ssd1306_buffer, sizeof(ref)))
+		{
+			printf("%-12s results differ!\n", benches[b].name);
+			errors++;
+			continue;
+		}
+		printf("%-12s %14.0f %14.0f %7.1fx\n", benches[b].name,
+			(double)tref/NCALLS, (double)tfast/NCALLS, (double)tref/tfast);
+	}
+
+	/* the full screen fill */
+	tref = cycles();
+	ref_fillRect(0, 0, SSD1306_W, SSD1306_H, 1);
+	tref = cycles() - tref;
+	ssd1306_setbuf(0);
+	tfast = cycles();
+	ssd1306_fillRect(0, 0, SSD1306_W, SSD1306_H, 1);
+	tfast = cycles() - tfast;
+	printf("%-12s %14.0f %14.0f %7.1fx\n", "full screen", (double)tref, (double)tfast,
+		(double)tref/tfast);
+
+	/* the temperature readout of ringdemo, the same few glyphs every time */
+	tref = cycles();
+	for(int i=0;i<NCALLS;i++)
+		ref_drawstr_sz(0, 12, i & 1 ? "23,4C" : "23,5C", 1, fontsize_16x16);
+	tref = cycles() - tref;
+	memcpy(ref, ssd1306_buffer, sizeof(ref));
+	tfast = cycles();
+	for(int i=0;i<NCALLS;i++)
+		ssd1306_drawstr_sz(0, 12, i & 1 ? "23,4C" : "23,5C", 1, fontsize_16x16);
+	tfast = cycles() - tfast;
+	if(memcmp(ref, ssd1306_buffer, sizeof(ref)))
+	{
+		printf("%-12s results differ!\n", "readout");
+		errors++;
+	}
+	else
+		printf("%-12s %14.0f %14.0f %7.1fx\n", "readout", (double)tref/NCALLS,
+			(double)tfast/NCALLS, (double)tref/tfast);
+#ifdef SSD1306_GLYPH_CACHE
+	printf("glyph cache: %lu hits, %lu misses\n", (unsigned long)ssd1306_glyph_hits,
+		(unsigned long)ssd1306_glyph_misses);
+#endif
+
+	return errors;
+}
+
+/*
+ * end of a DMA refresh
+ */
+uint64_t done_ns;
+
+void refresh_done(void)
+{
+	done_ns = ssd1306_host.time_ns;
+}
+
+/*
+ * send the changes to the OLED, by DMA when compiled with SSD1306_I2C_DMA
+ */
+void show(void)
+{
+#ifdef SSD1306_I2C_DMA
+	ssd1306_refresh_dma(refresh_done);
+	while(ssd1306_refresh_busy())
+		ssd1306_host_run(100);
+#else
+	ssd1306_refresh();
+	done_ns = ssd1306_host.time_ns;
+#endif
+}
+
+void scene_sprite(void)
+{
+	// sprites half over a set background to show all the modes
+	ssd1306_fillRect(0, 10, SSD1306_W, SSD1306_H-10, 1);
+	for(int m=0;m<7;m++)
+		ssd1306_sprite_draw(&icon_thermo, m*(SSD1306_W/7), m*2 - 2, m);
+	ssd1306_sprite_draw(&icon_fan1, -5, SSD1306_H-6, SSD1306_SPR_XOR);
+	ssd1306_sprite_draw(&icon_fan2, SSD1306_W-6, 3, SSD1306_SPR_WRITE);
+}
+
+/*
+ * stripes for the layers background
+ */
+void layers_bg(uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1)
+{
+	for(uint8_t y=y0;y<=y1;y++)
+		for(uint8_t x=x0;x<=x1;x++)
+			ssd1306_drawPixel(x, y, ((x+y)%6) < 2);
+}
+
+void scene_layers(void)
+{
+	ssd1306_layer_t *thermo, *fan, *top;
+
+	ssd1306_layer_bg = layers_bg;
+	ssd1306_layers_invalidate(0, 0, SSD1306_W-1, SSD1306_H-1);
+	fan = ssd1306_layer_add(&icon_fan1, 12, 9, SSD1306_SPR_XOR, 2);
+	thermo = ssd1306_layer_add(&icon_thermo, 10, 3, SSD1306_SPR_WRITE, 1);
+	top = ssd1306_layer_add(&icon_fan2, 40, 14, SSD1306_SPR_SET1, 3);
+	ssd1306_layers_compose();
+
+	// animate: move, change frame, hide
+	ssd1306_layer_move(thermo, 30, 10);
+	ssd1306_layer_sprite(fan, &icon_fan2);
+	ssd1306_layers_compose();
+	ssd1306_layer_move(fan, 33, 12);
+	ssd1306_layer_show(top, 0);
+	ssd1306_layers_compose();
+
+	ssd1306_layer_remove(fan);
+	ssd1306_layer_remove(thermo);
+	ssd1306_layer_remove(top);
+	ssd1306_layer_bg = NULL;
+}
+
+void scene_pstr(void)
+{
+	int16_t x;
+
+	// proportional text with kerning, scaled digits, inverse and clipped
+	ssd1306_drawpstr(&font_prop8, 0, 0, "Temperatura: 25,3C", 1);
+	x = ssd1306_drawpstr(&font_prop16, 0, 9, "25,3C", 1);
+	ssd1306_fillRect(x, 9, SSD1306_W-x, 16, 1);
+	ssd1306_drawpstr(&font_prop8, x+2, 13, "LT 7. Fly", 0);
+	ssd1306_drawpstr(&font_prop8, -3, 26, "F.r, Pj 7. clip", 1);
+}
+
+/*
+ * text fields with the fonts of ringdemo
+ */
+void draw_cell8(int16_t x, int16_t y, char c)
+{
+	ssd1306_drawchar(x, y, c, 1);
+}
+
+void draw_cell16(int16_t x, int16_t y, char c)
+{
+	ssd1306_drawchar_sz(x, y, c, 1, fontsize_16x16);
+}
+
+const ui_backend_t cell8 = { draw_cell8 };
+const ui_backend_t cell16 = { draw_cell16 };
+
+void scene_ui(void)
+{
+	ui_field_t label = UI_FIELD(&cell8, 0, 0, 8, 12);
+	ui_field_t value = UI_FIELD(&cell16, 0, 12, 16, 5);
+	ui_field_t clock = UI_FIELD(&cell8, 96, 0, 8, 4);
+
+	// shorter texts, negative numbers, a number that doesn't fit
+	ui_text(&label, "Temperatura:");
+	ui_text(&label, "Umidade");
+	ui_number(&value, 123456, 1, 0);
+	ui_number(&value, -53, 1, 0);
+	ui_text(&clock, "9:59");
+	ui_number(&clock, 1000, 0, 1);
+}
+
+void scene_console(void)
+{
+	char line[24];
+
+	// more lines than the screen, a line that wraps, scrolled by the start line
+	ssd1306_console_init();
+	ssd1306_console_puts("log 0");
+	ssd1306_console_refresh();
+	for(int i=1;i<10;i++)
+	{
+		snprintf(line, sizeof(line), "\nlog %d", i);
+		ssd1306_console_puts(line);
+		ssd1306_console_refresh();
+	}
+	ssd1306_console_puts("\n0123456789abcdefghij");
+	ssd1306_console_refresh();
+}
+
+typedef struct {
+	const char *name;
+	void (*draw)(void);
+} scene_t;
+
+const scene_t scenes[] =
+{
+	{ "setbuf", scene_setbuf },
+	{ "pixel", scene_pixel },
+	{ "xorpixel", scene_xorpixel },
+	{ "image", scene_image },
+	{ "vline", scene_vline },
+	{ "hline", scene_hline },
+	{ "line", scene_line },
+	{ "circle", scene_circle },
+	{ "fillcircle", scene_fillcircle },
+	{ "rect", scene_rect },
+	{ "fillrect", scene_fillrect },
+	{ "xorrect", scene_xorrect },
+	{ "char", scene_char },
+	{ "str", scene_str },
+	{ "char_sz", scene_char_sz },
+	{ "str_sz", scene_str_sz },
+	{ "sprite", scene_sprite },
+	{ "layers", scene_layers },
+	{ "pstr", scene_pstr },
+	{ "ui", scene_ui },
+	{ "console", scene_console },
+};
+
+#define NSCENES (sizeof(scenes)/sizeof(scenes[0]))
+
+int main(int argc, char *argv[])
+{
+	char fname[256];
+	int errors = 0;
+
+	if((argc == 2) && (strcmp(argv[1], "-b") == 0))
+		return bench() ? 1 : 0;
+
+	if((argc != 3) || ((strcmp(argv[1], "-w") != 0) && (strcmp(argv[1], "-c") != 0)))
+	{
+		printf("use: %s -w|-c dir\n       %s -b\n", argv[0], argv[0]);
+		return 2;
+	}
+
+	ssd1306_init();
+	for(unsigned i=0;i<NSCENES;i++)
+	{
+		ssd1306_setbuf(0);
+		scenes[i].draw();
+		uint32_t bytes = ssd1306_bytes_sent;
+		show();
+		bytes = ssd1306_bytes_sent - bytes;
+
+		if(argv[1][1] == 'w')
+		{
+			snprintf(fname, sizeof(fname), "%s/%s.pgm", argv[2], scenes[i].name);
+			errors += ssd1306_host_save_pgm(fname, 1);
+			snprintf(fname, sizeof(fname), "%s/%s.png", argv[2], scenes[i].name);
+			errors += ssd1306_host_save_png(fname, 4);
+		}
+		else
+		{
+			snprintf(fname, sizeof(fname), "%s/%s.pgm", argv[2], scenes[i].name);
+			int diff = ssd1306_host_compare_pgm(fname);
+			if(diff < 0)
+				printf("%-12s cannot read %s\n", scenes[i].name, fname);
+			else if(diff)
+				printf("%-12s %d pixels differ\n", scenes[i].name, diff);
+			else
+				printf("%-12s ok, %u bytes sent\n", scenes[i].name, bytes);
+			if(diff)
+				errors++;
+		}
+	}
+
+	// a new console line, then a full refresh as without the console
+	uint32_t con_bytes = ssd1306_bytes_sent;
+	ssd1306_console_puts("\nnew line");
+	ssd1306_console_refresh();
+	con_bytes = ssd1306_bytes_sent - con_bytes;
+	ssd1306_console_exit();
+	uint32_t full_bytes = ssd1306_bytes_sent;
+	ssd1306_refresh();
+	full_bytes = ssd1306_bytes_sent - full_bytes;
+	printf("console line: %u bytes sent, full refresh %u bytes\n", con_bytes, full_bytes);
+
+	// a ringdemo frame where only the temperature changes
+	ui_field_t label = UI_FIELD(&cell8, 0, 0, 8, 12);
+	ui_field_t value = UI_FIELD(&cell16, 0, 12, 16, 4);
+	ui_field_t unit = UI_FIELD(&cell16, 64, 12, 16, 1);
+	ssd1306_setbuf(0);
+	ui_text(&label, "Temperatura:");
+	ui_number(&value, 253, 1, 1);
+	ui_text(&unit, "C");
+	show();
+	uint32_t cells = ui_cells_drawn;
+	ui_text(&label, "Temperatura:");
+	ui_number(&value, 254, 1, 1);
+	ui_text(&unit, "C");
+	cells = ui_cells_drawn - cells;
+	uint32_t bytes = ssd1306_bytes_sent;
+	uint64_t start = ssd1306_host.time_ns, cpu = ssd1306_host.cpu_ns;
+	show();
+	printf("ringdemo frame: %u cells drawn, %u bytes sent, %u us on the bus, CPU waited %u us\n",
+		cells, ssd1306_bytes_sent - bytes, (unsigned)((done_ns - start)/1000),
+		(unsigned)((ssd1306_host.cpu_ns - cpu)/1000));
+
+#ifdef SSD1306_I2C_DMA
+	// a DMA refresh that can't start leaves the changes for the next one
+	ui_number(&value, 251, 1, 1);
+	ssd1306_host.fail_dma = 1;
+	if(ssd1306_refresh_dma(refresh_done) != 2)
+	{
+		printf("failed DMA refresh not reported\n");
+		errors++;
+	}
+	show();
+	int diff = 0;
+	for(int y=0;y<SSD1306_H;y++)
+		for(int x=0;x<SSD1306_W;x++)
+			diff += ssd1306_host_pixel(x, y) != ((ssd1306_buffer[(y/8)*SSD1306_W + x] >> (y&7)) & 1);
+	if(diff)
+	{
+		printf("failed DMA refresh: %d pixels not sent again\n", diff);
+		errors++;
+	}
+	else
+		printf("failed DMA refresh: sent again by the next one\n");
+#endif
+
+#ifdef SSD1306_STATS
+	// statistics of some ringdemo frames, one of them with an I2C timeout
+	memset(&ssd1306_stats, 0, sizeof(ssd1306_stats));
+	for(int i=0;i<10;i++)
+	{
+		ssd1306_frame_begin();
+		ui_text(&label, "Temperatura:");
+		ui_number(&value, 250 + i*7, 1, 1);
+		ui_text(&unit, "C");
+		if(i == 5)
+			ssd1306_host.fail = 1;
+		show();
+	}
+	ssd1306_stats_print();
+#endif
+
+	return errors ? 1 : 0;
+}
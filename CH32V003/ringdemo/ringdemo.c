@@ -5,131 +5,136 @@
 // NOTE: CONNECT WS2812's to PC6
 
 #define SSD1306_128X32
+// measure the frames, printed every STATS_FRAMES
+#define SSD1306_STATS
+#define STATS_FRAMES 10
+// the refresh is sent by DMA while the LEDs go on
+#define SSD1306_I2C_DMA
 
 #include "ch32v003fun.h"
 #include <stdio.h>
 #include <string.h>
 #include "ssd1306_i2c.h"
 #include "ssd1306.h"
+#include "adc_dma.h"
+#define UI_DECIMAL_POINT ','
+#include "ui_fields.h"
 
-#define WS2812DMA_IMPLEMENTATION
-//#define WSRBG //For WS2816C's.
-#define WSGRB // For SK6805-EC15
+// LEDs in GRB order (SK6805-EC15), colors through a gamma curve
 #define NR_LEDS 12
+#define WS2812_FB_LEDS NR_LEDS
+#define WS2812_FB_LUT
+#define WS2812_FB_GAMMA
 
-#include "ws2812b_dma_spi_led_driver.h"
+#include "ws2812_fb.h"
+#include "ws2812_anim.h"
+#include "ringdemo_anim.h"
+#define SCHED_TASKS 3
+#include "sched.h"
 
-int led_on = -1;
-uint32_t led_color = 0xFF0000;
-int led_dir = 1;
+// animation frame and temperature reading, in ms
+#define FRAME_MS 20
+#define TEMP_MS 1000
 
-// Callbacks that you must implement.
-uint32_t WS2812BLEDCallback( int ledno )
+// events
+#define EV_OLED_DONE 0x01		// end of the OLED refresh (I2C IRQ)
+
+/*
+ * text fields: cells of the 8x8 and 16x16 fonts, drawn with background
+ */
+void draw_cell8(int16_t x, int16_t y, char c)
 {
-	return (ledno == led_on)? led_color : 0;
+	ssd1306_drawchar(x, y, c, 1);
 }
 
+void draw_cell16(int16_t x, int16_t y, char c)
+{
+	ssd1306_drawchar_sz(x, y, c, 1, fontsize_16x16);
+}
+
+const ui_backend_t cell8 = { draw_cell8 };
+const ui_backend_t cell16 = { draw_cell16 };
+
+ui_field_t label = UI_FIELD(&cell8, 0, 0, 8, 12);
+ui_field_t value = UI_FIELD(&cell16, 0, 12, 16, 4);
+ui_field_t unit = UI_FIELD(&cell16, 64, 12, 16, 1);
+
 /*
- * initialize adc for polling
+ * sample the LM35 on PD4 continuously, filtered in the DMA IRQ
  */
 void adc_init( void )
 {
-	// ADCCLK = 24 MHz => RCC_ADCPRE = 0: divide by 2
-	RCC->CFGR0 &= ~(0x1F<<11);
-	
-	// Enable GPIOD and ADC
-	RCC->APB2PCENR |= RCC_APB2Periph_GPIOD | RCC_APB2Periph_ADC1;
+	// Enable GPIOD
+	RCC->APB2PCENR |= RCC_APB2Periph_GPIOD;
 	
 	// PD4 is analog input chl 7
 	GPIOD->CFGLR &= ~(0xf<<(4*4));	// CNF = 00: Analog, MODE = 00: Input
 	
-	// Reset the ADC to init all regs
-	RCC->APB2PRSTR |= RCC_APB2Periph_ADC1;
-	RCC->APB2PRSTR &= ~RCC_APB2Periph_ADC1;
-	
-	// Set up single conversion on chl 7
-	ADC1->RSQR1 = 0;
-	ADC1->RSQR2 = 0;
-	ADC1->RSQR3 = 7;	// 0-9 for 8 ext inputs and two internals
-	
-	// set sampling time for chl 7
-	ADC1->SAMPTR2 &= ~(ADC_SMP0<<(3*7));
-	ADC1->SAMPTR2 |= 7<<(3*7);	// 0:7 => 3/9/15/30/43/57/73/241 cycles
-		
-	// turn on ADC and set rule group to sw trig
-	ADC1->CTLR2 |= ADC_ADON | ADC_EXTSEL;
-	
-	// Reset calibration
-	ADC1->CTLR2 |= ADC_RSTCAL;
-	while(ADC1->CTLR2 & ADC_RSTCAL);
-	
-	// Calibrate
-	ADC1->CTLR2 |= ADC_CAL;
-	while(ADC1->CTLR2 & ADC_CAL);
-	
-	// should be ready for SW conversion now
+	adc_dma_init(7);
 }
 
 /*
- * start conversion, wait and return result
+ * tasks
  */
-uint16_t adc_get( void )
+
+// a frame of the animation; the frame number comes from the time, so
+// the animation keeps its speed when a frame is late
+void task_leds(void)
 {
-	// start sw conversion (auto clears)
-	ADC1->CTLR2 |= ADC_SWSTART;
-	
-	// wait for conversion complete
-	while(!(ADC1->STATR & ADC_EOC));
-	
-	// get result
-	return ADC1->RDATAR;
+	anim_render(ring_layers, RING_LAYERS, sched_now() / FRAME_MS);
+	ws2812_fb_show();
+}
+
+void oled_dma_done(void)
+{
+	sched_post_isr(EV_OLED_DONE);
+}
+
+// show the temperature, the refresh goes on in the background
+void task_temp(void)
+{
+	// last filtered value, the CPU doesn't wait for the ADC
+	uint32_t x = adc_dma_get();
+	uint16_t temp = (x*3300l) >> ADC_DMA_BITS;
+
+	if(ssd1306_refresh_busy())
+		return;
+	ssd1306_frame_begin();
+	// only the cells whose character changed are drawn
+	ui_text(&label, "Temperatura:");
+	ui_number(&value, temp, 1, 1);
+	ui_text(&unit, "C");
+	ssd1306_refresh_dma(oled_dma_done);
+}
+
+// after the refresh, the statistics and the time the core slept
+void task_oled_done(void)
+{
+	static uint32_t t0, slept0;
+
+	if(ssd1306_stats.frames == STATS_FRAMES)
+	{
+		uint32_t ms = sched_now() - t0;
+		ssd1306_stats_print();
+		printf("CPU busy %lu%% of %lu ms\n",
+			(unsigned long)(100 - (sched_slept - slept0) / DELAY_MS_TIME * 100 / ms),
+			(unsigned long)ms);
+		t0 = sched_now();
+		slept0 = sched_slept;
+	}
 }
 
 int main()
 {
 	SystemInit();
-	WS2812BDMAInit( );
+	ws2812_fb_init();
 	ssd1306_i2c_init();
         ssd1306_init();
 	adc_init();
+	sched_init();
 
-	int n = 20;
-	while(1)
-	{
-		if (--n == 0){
-			uint32_t x = adc_get();
-			uint16_t temp = (x*3300l)/1024l;
-			char buf[6];
-			buf[0] = (temp/100) + '0';
-			buf[1] = ((temp/10)%10) + '0';
-			buf[2] = ',';
-			buf[3] = (temp % 10)+ '0';
-			buf[4] = 'C';
-			buf[5] = 0;
-			ssd1306_setbuf(0);
-			ssd1306_drawstr(0,0,"Temperatura:", 1);
-			ssd1306_drawstr_sz(0,12,buf, 1, fontsize_16x16);
-			ssd1306_refresh();
-			n = 20;
-		}
-
-		while( WS2812BLEDInUse );
-		Delay_Ms(50);
-		led_on += led_dir;
-		if (led_on == NR_LEDS) {
-			led_on--;
-			led_dir = -1;
-			led_color = led_color >> 8;
-		}
- 		if  (led_on < 0){
-			led_on = 0;
-			led_dir = 1;
-			led_color = led_color >>8;
-		}
-		if (led_color == 0) {
-			led_color = 0xFF0000;
-		}
-		WS2812BDMAStart( NR_LEDS );
-	}
+	sched_every(sched_task(task_leds, 0), FRAME_MS);
+	sched_every(sched_task(task_temp, 0), TEMP_MS);
+	sched_task(task_oled_done, EV_OLED_DONE);
+	sched_run();
 }
-
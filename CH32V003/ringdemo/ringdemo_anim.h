@@ -0,0 +1,55 @@
+/*
+ * The animation of ringdemo, also rendered by animsim.c
+ * Must be included after ws2812_anim.h, 50 frames per second
+ */
+
+#ifndef _RINGDEMO_ANIM_H
+#define _RINGDEMO_ANIM_H
+
+// a spot that goes from the first to the last LED and back in 1.2 s,
+// slowing down at the ends, and turns from blue to green to red
+const anim_key_t bounce_pos[] =
+{
+	{   0, ANIM_Q8(0), ANIM_INOUT },
+	{  30, ANIM_Q8(WS2812_FB_LEDS-1), ANIM_INOUT },
+	{  60, ANIM_Q8(0), ANIM_LINEAR },
+};
+const anim_key_t bounce_width[] = { { 0, ANIM_Q8(1.5), ANIM_LINEAR } };
+const anim_key_t bounce_color[] =
+{
+	{   0, ANIM_Q8(0), ANIM_LINEAR },
+	{  90, ANIM_Q8(3), ANIM_LINEAR },
+};
+const anim_key_t bounce_level[] = { { 0, ANIM_ONE, ANIM_LINEAR } };
+const uint32_t bounce_pal[] = { 0x0000FF, 0x00FF00, 0xFF0000 };
+
+// a wide, dim glow that turns around the ring the other way and breathes
+const anim_key_t glow_pos[] =
+{
+	{   0, ANIM_Q8(WS2812_FB_LEDS), ANIM_LINEAR },
+	{ 240, ANIM_Q8(0), ANIM_LINEAR },
+};
+const anim_key_t glow_width[] = { { 0, ANIM_Q8(4), ANIM_LINEAR } };
+const anim_key_t glow_color[] =
+{
+	{   0, ANIM_Q8(0), ANIM_LINEAR },
+	{ 240, ANIM_Q8(2), ANIM_LINEAR },
+};
+const anim_key_t glow_level[] =
+{
+	{   0, ANIM_Q8(0.05), ANIM_INOUT },
+	{  50, ANIM_Q8(0.3), ANIM_OUT },
+	{ 100, ANIM_Q8(0.05), ANIM_LINEAR },
+};
+const uint32_t glow_pal[] = { 0xFF4000, 0xC00080 };
+
+const anim_layer_t ring_layers[] =
+{
+	{ ANIM_TRACK(glow_pos), ANIM_TRACK(glow_width), ANIM_TRACK(glow_color),
+	  ANIM_TRACK(glow_level), glow_pal, 2 },
+	{ ANIM_TRACK(bounce_pos), ANIM_TRACK(bounce_width), ANIM_TRACK(bounce_color),
+	  ANIM_TRACK(bounce_level), bounce_pal, 3 },
+};
+#define RING_LAYERS (sizeof(ring_layers)/sizeof(ring_layers[0]))
+
+#endif
@@ -0,0 +1,146 @@
+/*
+ * Scheduler test - runs sched.h on a PC with simulated time
+ *
+ * Tasks like those of ringdemo (LED frames, temperature, end of the OLED
+ * refresh) run for 10 simulated seconds; the simulated IRQs post events
+ * and a task that takes too long makes the timers late. Checks when each
+ * task runs and how long the core would sleep.
+ *
+ * Build:   gcc -O2 -Wall -I../common -o schedsim schedsim.c
+ * Use:     ./schedsim
+ */
+
+#define SCHED_HOST
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "sched.h"
+
+#define EV_OLED_DONE 0x01
+#define EV_CHAIN 0x02
+
+#define RUN_MS 10000
+#define SLOW_AT 5501		// a task is busy for SLOW_MS
+#define SLOW_MS 50
+#define XFER_MS 12			// simulated OLED transfer
+
+int errors;
+
+// what ran and when
+uint32_t leds_runs, leds_last, temp_runs, done_runs, once_runs, chain_runs;
+uint32_t xfer_end;			// tick of the simulated DMA IRQ, 0 if none
+uint8_t t_once;
+
+void fail(const char *what, uint32_t a, uint32_t b)
+{
+	printf("%s: %u %u\n", what, a, b);
+	errors++;
+}
+
+/*
+ * the time goes on until something happens; IRQs post their events
+ */
+void sched_host_idle(void)
+{
+	sched_ticks++;
+	if(xfer_end && (sched_ticks == xfer_end))
+	{
+		xfer_end = 0;
+		sched_post_isr(EV_OLED_DONE);
+	}
+	if(sched_ticks >= RUN_MS)
+		sched_exit = 1;
+}
+
+void task_leds(void)
+{
+	uint32_t now = sched_now();
+
+	// on time, except just after the slow task
+	if((now % 20) && (now != SLOW_AT + SLOW_MS))
+		fail("leds: late at, last", now, leds_last);
+	if(sched_fired)
+		fail("leds: run by an event", sched_fired, 0);
+	leds_last = now;
+	leds_runs++;
+}
+
+void task_temp(void)
+{
+	if(sched_now() % 1000)
+		fail("temp: late at", sched_now(), 0);
+	temp_runs++;
+	// the refresh starts, the DMA IRQ comes later
+	xfer_end = sched_now() + XFER_MS;
+}
+
+void task_done(void)
+{
+	if(sched_fired != EV_OLED_DONE)
+		fail("done: events", sched_fired, 0);
+	if(sched_now() % 1000 != XFER_MS)
+		fail("done: at", sched_now(), 0);
+	done_runs++;
+	// an event posted by a task runs its task before sleeping
+	sched_post(EV_CHAIN);
+}
+
+void task_chain(void)
+{
+	if(sched_now() % 1000 != XFER_MS)
+		fail("chain: at", sched_now(), 0);
+	chain_runs++;
+}
+
+void task_once(void)
+{
+	if(sched_now() != 2500)
+		fail("once: at", sched_now(), 0);
+	once_runs++;
+}
+
+void task_slow(void)
+{
+	// busy for SLOW_MS, the other timers expire meanwhile
+	sched_ticks += SLOW_MS;
+}
+
+int main(void)
+{
+	uint8_t t_slow;
+
+	sched_every(sched_task(task_leds, 0), 20);
+	sched_every(sched_task(task_temp, 0), 1000);
+	sched_task(task_done, EV_OLED_DONE);
+	sched_task(task_chain, EV_CHAIN);
+	t_once = sched_task(task_once, 0);
+	sched_after(t_once, 2500);
+	t_slow = sched_task(task_slow, 0);
+	sched_after(t_slow, SLOW_AT);
+
+	sched_run();
+
+	// a frame every 20 ms before the end, one is late and the next skipped
+	if(leds_runs != RUN_MS/20 - 2)
+		fail("leds: runs, expected", leds_runs, RUN_MS/20 - 2);
+	if(temp_runs != RUN_MS/1000 - 1)
+		fail("temp: runs, expected", temp_runs, RUN_MS/1000 - 1);
+	if((done_runs != temp_runs) || (chain_runs != done_runs))
+		fail("done: runs, chain", done_runs, chain_runs);
+	if(once_runs != 1)
+		fail("once: runs", once_runs, 0);
+
+	// no task is added past the end of the table
+	while(sched_ntasks < SCHED_TASKS)
+		sched_task(task_once, 0);
+	if((sched_task(task_once, 0) != SCHED_NONE) || (sched_ntasks != SCHED_TASKS))
+		fail("full table: tasks, expected", sched_ntasks, SCHED_TASKS);
+	sched_every(SCHED_NONE, 20);
+
+	printf("%u ms: %u LED frames, %u readings, %u refreshes, slept %u ms (%u%%)\n",
+		sched_now(), leds_runs, temp_runs, done_runs, sched_slept,
+		sched_slept * 100 / sched_now());
+	printf(errors ? "%d errors\n" : "ok\n", errors);
+	return errors ? 1 : 0;
+}
@@ -0,0 +1,80 @@
+# Converts PBM images to sprites for ssd1306_sprite.h
+#
+# Each image becomes pages of 8 rows, a byte per column with the top
+# row in the LSB, like the SSD1306 buffer. A second image with the same
+# size can be given as the mask (black = pixel is drawn).
+#
+# Use: python3 sprconv.py name image.pbm [mask.pbm] >> sprites.h
+
+import sys
+
+def read_pbm(fname):
+    with open(fname, 'rb') as f:
+        data = f.read()
+    # header: magic, width, height (comments start with #)
+    fields = []
+    pos = 0
+    while len(fields) < 3:
+        while data[pos:pos+1].isspace():
+            pos += 1
+        if data[pos:pos+1] == b'#':
+            while data[pos:pos+1] not in (b'\n', b''):
+                pos += 1
+            continue
+        start = pos
+        while not data[pos:pos+1].isspace():
+            pos += 1
+        fields.append(data[start:pos].decode())
+    magic, w, h = fields[0], int(fields[1]), int(fields[2])
+    if magic == 'P1':
+        bits = [int(c) for c in data[pos:].decode() if c in '01']
+    elif magic == 'P4':
+        pos += 1
+        stride = (w + 7) // 8
+        bits = []
+        for y in range(h):
+            row = data[pos + y*stride:pos + (y+1)*stride]
+            bits += [(row[x // 8] >> (7 - x % 8)) & 1 for x in range(w)]
+    else:
+        sys.exit(f'{fname}: not a PBM file')
+    if len(bits) < w*h:
+        sys.exit(f'{fname}: image is incomplete')
+    return w, h, [bits[y*w:(y+1)*w] for y in range(h)]
+
+def pages(w, h, pix):
+    out = []
+    for p in range((h + 7) // 8):
+        for x in range(w):
+            b = 0
+            for i in range(8):
+                y = p*8 + i
+                if y < h and pix[y][x]:
+                    b |= 1 << i
+            out.append(b)
+    return out
+
+def c_array(name, w, data):
+    lines = [f'const uint8_t {name}[] =', '{']
+    for i in range(0, len(data), w):
+        row = data[i:i+w]
+        lines.append('\t' + ', '.join(f'0x{b:02X}' for b in row) + ',')
+    lines.append('};')
+    return lines
+
+if len(sys.argv) not in (3, 4):
+    sys.exit('use: sprconv.py name image.pbm [mask.pbm]')
+
+name = sys.argv[1]
+w, h, pix = read_pbm(sys.argv[2])
+out = [f'// {name}: {w}x{h} from {sys.argv[2]}']
+out += c_array(f'{name}_data', w, pages(w, h, pix))
+mask = 'NULL'
+if len(sys.argv) == 4:
+    mw, mh, mpix = read_pbm(sys.argv[3])
+    if (mw, mh) != (w, h):
+        sys.exit(f'{sys.argv[3]}: size is not {w}x{h}')
+    out += c_array(f'{name}_mask', w, pages(w, h, mpix))
+    mask = f'{name}_mask'
+out.append(f'const ssd1306_sprite_t {name} = {{ {w}, {h}, {name}_data, {mask} }};')
+out.append('')
+print('\n'.join(out))
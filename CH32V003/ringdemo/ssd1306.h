@@ -8,7 +8,16 @@
 
 #include <stdint.h>
 #include <string.h>
-#include "font_8x8.h"
+#ifdef SSD1306_STATS
+#include <stdio.h>
+#endif
+#include "../fonts/font_8x8.h"
+
+// column-major copy of the font for fast text (made by fonts/make_fonts.py)
+// define SSD1306_NO_COLFONT to save 2K of flash and draw text by pixels
+#ifndef SSD1306_NO_COLFONT
+#include "font_8x8_col.h"
+#endif
 
 // comfortable packet size for this OLED
 #define SSD1306_PSZ 32
@@ -38,11 +47,101 @@
 #define SSD1306_OFFSET 0
 #endif
 
+// interface functions (ssd1306_i2c.h or ssd1306_host.h)
+uint8_t ssd1306_pkt_send(uint8_t *data, uint8_t sz, uint8_t cmd);
+void ssd1306_rst(void);
+#ifdef SSD1306_I2C_DMA
+uint8_t ssd1306_i2c_dma_start(void);
+uint8_t ssd1306_i2c_dma_busy(void);
+#endif
+
+// bytes sent to the OLED, including I2C address and control byte
+uint32_t ssd1306_bytes_sent;
+
+#ifdef SSD1306_STATS
+/*
+ * frame statistics: call ssd1306_frame_begin() before drawing a frame,
+ * the refresh measures the rest; times are sums since the last
+ * ssd1306_stats_print(), in ticks of the interface clock (SysTick)
+ */
+uint32_t ssd1306_ticks(void);
+uint32_t ssd1306_ticks_us(uint32_t ticks);
+
+// I2C errors, counted by the interface
+extern uint16_t ssd1306_i2c_timeouts;		// a wait on the bus timed out
+extern uint16_t ssd1306_i2c_recoveries;		// a packet went through after an error
+
+typedef struct {
+	uint32_t frames;			// refreshes
+	uint32_t bytes;				// bytes sent by the refreshes
+	uint32_t draw;				// from ssd1306_frame_begin() to the refresh
+	uint32_t expand;			// expanding nybbles for 128x32 and 64x32 panels
+	uint32_t xfer;				// refresh, until the last byte is on the bus
+	uint32_t xfer_max;			// slowest refresh
+	uint32_t t_begin, t_refresh;	// start of the frame being measured
+} ssd1306_stats_t;
+
+ssd1306_stats_t ssd1306_stats;
+
+/*
+ * start of the drawing of a frame
+ */
+void ssd1306_frame_begin(void)
+{
+	ssd1306_stats.t_begin = ssd1306_ticks();
+}
+
+/*
+ * start of a refresh
+ */
+void ssd1306_stats_refresh(void)
+{
+	ssd1306_stats.t_refresh = ssd1306_ticks();
+	if(ssd1306_stats.t_begin)
+		ssd1306_stats.draw += ssd1306_stats.t_refresh - ssd1306_stats.t_begin;
+	ssd1306_stats.t_begin = 0;
+	ssd1306_stats.frames++;
+}
+
+/*
+ * end of a refresh
+ */
+void ssd1306_stats_done(void)
+{
+	uint32_t t = ssd1306_ticks() - ssd1306_stats.t_refresh;
+
+	ssd1306_stats.xfer += t;
+	if(t > ssd1306_stats.xfer_max)
+		ssd1306_stats.xfer_max = t;
+}
+
+/*
+ * print the averages per frame and start again
+ */
+void ssd1306_stats_print(void)
+{
+	uint32_t n = ssd1306_stats.frames ? ssd1306_stats.frames : 1;
+
+	printf("ssd1306: %lu frames, %lu bytes, draw %lu us, expand %lu us, transfer %lu us (max %lu), "
+		"%u timeouts, %u recoveries\n",
+		(unsigned long)ssd1306_stats.frames, (unsigned long)(ssd1306_stats.bytes / n),
+		(unsigned long)ssd1306_ticks_us(ssd1306_stats.draw / n),
+		(unsigned long)ssd1306_ticks_us(ssd1306_stats.expand / n),
+		(unsigned long)ssd1306_ticks_us(ssd1306_stats.xfer / n),
+		(unsigned long)ssd1306_ticks_us(ssd1306_stats.xfer_max),
+		ssd1306_i2c_timeouts, ssd1306_i2c_recoveries);
+	memset(&ssd1306_stats, 0, sizeof(ssd1306_stats));
+}
+#else
+#define ssd1306_frame_begin()
+#endif
+
 /*
  * send OLED command byte
  */
 uint8_t ssd1306_cmd(uint8_t cmd)
 {
+	ssd1306_bytes_sent += 3;
 	ssd1306_pkt_send(&cmd, 1, 1);
 	return 0;
 }
@@ -52,6 +151,7 @@ uint8_t ssd1306_cmd(uint8_t cmd)
  */
 uint8_t ssd1306_data(uint8_t *data, uint8_t sz)
 {
+	ssd1306_bytes_sent += sz + 2;
 	ssd1306_pkt_send(data, sz, 0);
 	return 0;
 }
@@ -125,14 +225,54 @@ const uint8_t ssd1306_init_array[] =
 };
 
 // the display buffer
+#define SSD1306_PAGES (SSD1306_H/8)
 uint8_t ssd1306_buffer[SSD1306_W*SSD1306_H/8];
 
+// range of changed columns in each page, clean if x0 > x1
+uint8_t ssd1306_dirty_x0[SSD1306_PAGES] = { [0 ... SSD1306_PAGES-1] = 0xFF };
+uint8_t ssd1306_dirty_x1[SSD1306_PAGES];
+
+/*
+ * mark a range of columns in a page as changed
+ */
+void ssd1306_mark_dirty(uint8_t x0, uint8_t x1, uint8_t page)
+{
+	if(x0 < ssd1306_dirty_x0[page])
+		ssd1306_dirty_x0[page] = x0;
+	if(x1 > ssd1306_dirty_x1[page])
+		ssd1306_dirty_x1[page] = x1;
+}
+
+/*
+ * mark the whole buffer as changed, next refresh will send everything
+ */
+void ssd1306_invalidate(void)
+{
+	memset(ssd1306_dirty_x0, 0, sizeof(ssd1306_dirty_x0));
+	memset(ssd1306_dirty_x1, SSD1306_W-1, sizeof(ssd1306_dirty_x1));
+}
+
 /*
  * set the buffer to a color
  */
 void ssd1306_setbuf(uint8_t color)
 {
-	memset(ssd1306_buffer, color ? 0xFF : 0x00, sizeof(ssd1306_buffer));
+	uint8_t fill = color ? 0xFF : 0x00;
+	uint8_t *p = ssd1306_buffer;
+	uint8_t x0, x1;
+
+	for(uint8_t page=0;page<SSD1306_PAGES;page++)
+	{
+		/* find the changed range before filling */
+		for(x0=0;(x0<SSD1306_W) && (p[x0]==fill);x0++);
+		if(x0 < SSD1306_W)
+		{
+			for(x1=SSD1306_W-1;p[x1]==fill;x1--);
+			ssd1306_mark_dirty(x0, x1, page);
+			memset(p+x0, fill, x1-x0+1);
+		}
+		p += SSD1306_W;
+	}
 }
 
 #ifndef SSD1306_FULLUSE
@@ -149,55 +289,341 @@ const uint8_t expand[16] =
 #endif
 
 /*
- * Send the frame buffer
+ * Set the OLED address window to buffer pages p0 to p1, columns x0 to x1
  */
-void ssd1306_refresh(void)
+void ssd1306_set_window(uint8_t x0, uint8_t x1, uint8_t p0, uint8_t p1)
 {
-	uint16_t i;
-	
 	ssd1306_cmd(SSD1306_COLUMNADDR);
-	ssd1306_cmd(SSD1306_OFFSET);   // Column start address (0 = reset)
-	ssd1306_cmd(SSD1306_OFFSET+SSD1306_W-1); // Column end address (127 = reset)
-	
+	ssd1306_cmd(SSD1306_OFFSET+x0);   // Column start address
+	ssd1306_cmd(SSD1306_OFFSET+x1);   // Column end address
+
 	ssd1306_cmd(SSD1306_PAGEADDR);
-	ssd1306_cmd(0); // Page start address (0 = reset)
-	ssd1306_cmd(7); // Page end address
+#ifdef SSD1306_FULLUSE
+	ssd1306_cmd(p0); // Page start address
+	ssd1306_cmd(p1); // Page end address
+#else
+	/* for displays with odd rows unused each page becomes two */
+	ssd1306_cmd(2*p0); // Page start address
+	ssd1306_cmd(2*p1+1); // Page end address
+#endif
+}
+
+/*
+ * Send buffer pages p0 to p1, columns x0 to x1, to the OLED address window
+ */
+void ssd1306_send_data(uint8_t x0, uint8_t x1, uint8_t p0, uint8_t p1)
+{
+	uint8_t n, sz;
+	uint8_t *src;
 
 #ifdef SSD1306_FULLUSE
 	/* for fully used rows just plow thru everything */
-    for(i=0;i<sizeof(ssd1306_buffer);i+=SSD1306_PSZ)
+	for(;p0<=p1;p0++)
 	{
-		/* send PSZ block of data */
-		ssd1306_data(&ssd1306_buffer[i], SSD1306_PSZ);
+		src = &ssd1306_buffer[p0*SSD1306_W + x0];
+		for(n=x1-x0+1;n;n-=sz)
+		{
+			/* send up to PSZ block of data */
+			sz = n > SSD1306_PSZ ? SSD1306_PSZ : n;
+			ssd1306_data(src, sz);
+			src += sz;
+		}
 	}
 #else
-	/* for displays with odd rows unused expand bytes */
-	uint8_t tbuf[SSD1306_PSZ], j, k;
-    for(i=0;i<sizeof(ssd1306_buffer);i+=128)
+	/* for displays with odd rows unused each page becomes two */
+	uint8_t tbuf[SSD1306_PSZ], i;
+#ifdef SSD1306_STATS
+	uint32_t t;
+#endif
+	for(;p0<=p1;p0++)
 	{
 		/* low nybble */
-		for(j=0;j<128;j+=SSD1306_PSZ)
+		src = &ssd1306_buffer[p0*SSD1306_W + x0];
+		for(n=x1-x0+1;n;n-=sz)
 		{
-			for(k=0;k<SSD1306_PSZ;k++)
-				tbuf[k] = expand[ssd1306_buffer[i+j+k]&0xf];
-			
-			/* send PSZ block of data */
-			ssd1306_data(tbuf, SSD1306_PSZ);
+			sz = n > SSD1306_PSZ ? SSD1306_PSZ : n;
+#ifdef SSD1306_STATS
+			t = ssd1306_ticks();
+#endif
+			for(i=0;i<sz;i++)
+				tbuf[i] = expand[src[i]&0xf];
+			src += sz;
+#ifdef SSD1306_STATS
+			ssd1306_stats.expand += ssd1306_ticks() - t;
+#endif
+
+			/* send up to PSZ block of data */
+			ssd1306_data(tbuf, sz);
 		}
-		
+
 		/* high nybble */
-		for(j=0;j<128;j+=SSD1306_PSZ)
+		src = &ssd1306_buffer[p0*SSD1306_W + x0];
+		for(n=x1-x0+1;n;n-=sz)
 		{
-			for(k=0;k<SSD1306_PSZ;k++)
-				tbuf[k] = expand[(ssd1306_buffer[i+j+k]>>4)&0xf];
-			
-			/* send PSZ block of data */
-			ssd1306_data(tbuf, SSD1306_PSZ);
+			sz = n > SSD1306_PSZ ? SSD1306_PSZ : n;
+#ifdef SSD1306_STATS
+			t = ssd1306_ticks();
+#endif
+			for(i=0;i<sz;i++)
+				tbuf[i] = expand[(src[i]>>4)&0xf];
+			src += sz;
+#ifdef SSD1306_STATS
+			ssd1306_stats.expand += ssd1306_ticks() - t;
+#endif
+
+			/* send up to PSZ block of data */
+			ssd1306_data(tbuf, sz);
 		}
 	}
 #endif
 }
 
+/*
+ * Send a window of pages p0 to p1, columns x0 to x1
+ */
+void ssd1306_send_window(uint8_t x0, uint8_t x1, uint8_t p0, uint8_t p1)
+{
+	ssd1306_set_window(x0, x1, p0, p1);
+	ssd1306_send_data(x0, x1, p0, p1);
+}
+
+/*
+ * Send the changed parts of the frame buffer
+ * Consecutive changed pages are sent in a single window
+ */
+void ssd1306_refresh(void)
+{
+	uint8_t p0, p1, x0, x1;
+#ifdef SSD1306_STATS
+	uint32_t bytes = ssd1306_bytes_sent;
+
+	ssd1306_stats_refresh();
+#endif
+
+	for(p0=0;p0<SSD1306_PAGES;p0++)
+	{
+		if(ssd1306_dirty_x0[p0] > ssd1306_dirty_x1[p0])
+			continue;
+
+		/* join following changed pages */
+		x0 = ssd1306_dirty_x0[p0];
+		x1 = ssd1306_dirty_x1[p0];
+		for(p1=p0;(p1+1<SSD1306_PAGES) && (ssd1306_dirty_x0[p1+1] <= ssd1306_dirty_x1[p1+1]);p1++)
+		{
+			if(ssd1306_dirty_x0[p1+1] < x0)
+				x0 = ssd1306_dirty_x0[p1+1];
+			if(ssd1306_dirty_x1[p1+1] > x1)
+				x1 = ssd1306_dirty_x1[p1+1];
+		}
+
+		ssd1306_send_window(x0, x1, p0, p1);
+
+		/* pages are now clean */
+		for(;p0<=p1;p0++)
+		{
+			ssd1306_dirty_x0[p0] = 0xFF;
+			ssd1306_dirty_x1[p0] = 0;
+		}
+	}
+#ifdef SSD1306_STATS
+	ssd1306_stats.bytes += ssd1306_bytes_sent - bytes;
+	ssd1306_stats_done();
+#endif
+}
+
+/*
+ * Send the whole frame buffer
+ */
+void ssd1306_refresh_all(void)
+{
+	ssd1306_invalidate();
+	ssd1306_refresh();
+}
+
+#ifdef SSD1306_I2C_DMA
+/*
+ * DMA refresh: the rectangle around the changed pages is sent as a single
+ * I2C transfer by DMA, the CPU is only needed to start it and, on 128x32
+ * displays, to expand each chunk of SSD1306_PSZ bytes.
+ * The transfer is sent from the frame buffer: don't draw until
+ * ssd1306_refresh_busy() returns 0. Define SSD1306_DMA_DOUBLEBUF to copy
+ * the changed pages to a back buffer and draw during the transfer, at the
+ * cost of a second buffer in RAM (up to 512 bytes, not for 128x64)
+ */
+#ifdef SSD1306_DMA_DOUBLEBUF
+#if (SSD1306_W*SSD1306_H/8) > 512
+#error "SSD1306_DMA_DOUBLEBUF: a second 128x64 buffer doesn't fit in RAM"
+#endif
+uint8_t ssd1306_backbuf[SSD1306_W*SSD1306_H/8];
+#define SSD1306_DMA_SRC ssd1306_backbuf
+#else
+#define SSD1306_DMA_SRC ssd1306_buffer
+#endif
+
+// window being sent and next position in it
+uint8_t ssd1306_dma_x0, ssd1306_dma_x1, ssd1306_dma_p0, ssd1306_dma_p1, ssd1306_dma_page, ssd1306_dma_x;
+#ifndef SSD1306_FULLUSE
+uint8_t ssd1306_dma_half, ssd1306_dma_tbuf[SSD1306_PSZ];
+#endif
+
+// called when the transfer is complete (from the I2C IRQ)
+void (*ssd1306_dma_callback)(void);
+
+/*
+ * next chunk of data for the DMA, returns the size (0 at the end)
+ * the previous chunk has been read when this is called
+ */
+uint16_t ssd1306_dma_next(uint8_t **data)
+{
+	uint16_t n;
+
+	if(ssd1306_dma_page > ssd1306_dma_p1)
+		return 0;
+
+#ifdef SSD1306_FULLUSE
+	*data = &SSD1306_DMA_SRC[ssd1306_dma_page*SSD1306_W + ssd1306_dma_x0];
+	if((ssd1306_dma_x0 == 0) && (ssd1306_dma_x1 == SSD1306_W-1))
+	{
+		/* full width pages are contiguous in the buffer */
+		n = (ssd1306_dma_p1 - ssd1306_dma_page + 1)*SSD1306_W;
+		ssd1306_dma_page = ssd1306_dma_p1 + 1;
+	}
+	else
+	{
+		n = ssd1306_dma_x1 - ssd1306_dma_x0 + 1;
+		ssd1306_dma_page++;
+	}
+#else
+	/* each page is sent twice, low nybbles then high nybbles */
+	uint8_t *src = &SSD1306_DMA_SRC[ssd1306_dma_page*SSD1306_W + ssd1306_dma_x];
+	uint8_t i, sh = ssd1306_dma_half ? 4 : 0;
+#ifdef SSD1306_STATS
+	uint32_t t = ssd1306_ticks();
+#endif
+
+	n = ssd1306_dma_x1 - ssd1306_dma_x + 1;
+	if(n > SSD1306_PSZ)
+		n = SSD1306_PSZ;
+	for(i=0;i<n;i++)
+		ssd1306_dma_tbuf[i] = expand[(src[i]>>sh)&0xf];
+	*data = ssd1306_dma_tbuf;
+#ifdef SSD1306_STATS
+	ssd1306_stats.expand += ssd1306_ticks() - t;
+#endif
+
+	ssd1306_dma_x += n;
+	if(ssd1306_dma_x > ssd1306_dma_x1)
+	{
+		ssd1306_dma_x = ssd1306_dma_x0;
+		if(ssd1306_dma_half)
+			ssd1306_dma_page++;
+		ssd1306_dma_half ^= 1;
+	}
+#endif
+	return n;
+}
+
+/*
+ * end of the DMA transfer, if it failed the window is sent again by the
+ * next refresh
+ */
+void ssd1306_dma_done(uint8_t err)
+{
+	uint8_t p;
+
+	if(err)
+		for(p=ssd1306_dma_p0;p<=ssd1306_dma_p1;p++)
+			ssd1306_mark_dirty(ssd1306_dma_x0, ssd1306_dma_x1, p);
+#ifdef SSD1306_STATS
+	ssd1306_stats_done();
+#endif
+	if(ssd1306_dma_callback)
+		ssd1306_dma_callback();
+}
+
+/*
+ * true while a DMA refresh is in progress
+ */
+uint8_t ssd1306_refresh_busy(void)
+{
+	return ssd1306_i2c_dma_busy();
+}
+
+/*
+ * start sending the changed parts of the frame buffer by DMA
+ * done (if not NULL) is called from the IRQ at the end, or from
+ * ssd1306_refresh_busy() if the transfer failed
+ * returns 1 if the previous refresh is still in progress, 2 if the
+ * transfer can't start: done is called and the changes stay dirty
+ */
+uint8_t ssd1306_refresh_dma(void (*done)(void))
+{
+	uint8_t p, p0 = 0xFF, p1 = 0, x0 = 0xFF, x1 = 0;
+
+	if(ssd1306_i2c_dma_busy())
+		return 1;
+#ifdef SSD1306_STATS
+	uint32_t bytes = ssd1306_bytes_sent;
+
+	ssd1306_stats_refresh();
+#endif
+
+	/* rectangle around the changed pages */
+	for(p=0;p<SSD1306_PAGES;p++)
+	{
+		if(ssd1306_dirty_x0[p] > ssd1306_dirty_x1[p])
+			continue;
+		if(p0 == 0xFF)
+			p0 = p;
+		p1 = p;
+		if(ssd1306_dirty_x0[p] < x0)
+			x0 = ssd1306_dirty_x0[p];
+		if(ssd1306_dirty_x1[p] > x1)
+			x1 = ssd1306_dirty_x1[p];
+		ssd1306_dirty_x0[p] = 0xFF;
+		ssd1306_dirty_x1[p] = 0;
+	}
+	if(p0 == 0xFF)
+	{
+		/* nothing to send */
+#ifdef SSD1306_STATS
+		ssd1306_stats_done();
+#endif
+		if(done)
+			done();
+		return 0;
+	}
+
+#ifdef SSD1306_DMA_DOUBLEBUF
+	memcpy(&ssd1306_backbuf[p0*SSD1306_W], &ssd1306_buffer[p0*SSD1306_W], (p1-p0+1)*SSD1306_W);
+#endif
+
+	ssd1306_set_window(x0, x1, p0, p1);
+
+	ssd1306_dma_x0 = ssd1306_dma_x = x0;
+	ssd1306_dma_x1 = x1;
+	ssd1306_dma_page = ssd1306_dma_p0 = p0;
+	ssd1306_dma_p1 = p1;
+#ifdef SSD1306_FULLUSE
+	ssd1306_bytes_sent += 2 + (x1-x0+1)*(p1-p0+1);
+#else
+	ssd1306_dma_half = 0;
+	ssd1306_bytes_sent += 2 + 2*(x1-x0+1)*(p1-p0+1);
+#endif
+	ssd1306_dma_callback = done;
+#ifdef SSD1306_STATS
+	ssd1306_stats.bytes += ssd1306_bytes_sent - bytes;
+#endif
+
+	if(ssd1306_i2c_dma_start())
+	{
+		ssd1306_dma_done(1);
+		return 2;
+	}
+	return 0;
+}
+#endif
+
 /*
  * plot a pixel in the buffer
  */
@@ -215,10 +641,13 @@ void ssd1306_drawPixel(uint8_t x, uint8_t y, uint8_t color)
 	addr = x + SSD1306_W*(y/8);
 	
 	/* set/clear bit in buffer */
+	uint8_t old = ssd1306_buffer[addr];
 	if(color)
 		ssd1306_buffer[addr] |= (1<<(y&7));
 	else
 		ssd1306_buffer[addr] &= ~(1<<(y&7));
+	if(ssd1306_buffer[addr] != old)
+		ssd1306_mark_dirty(x, x, y/8);
 }
 
 /*
@@ -238,6 +667,7 @@ void ssd1306_xorPixel(uint8_t x, uint8_t y)
 	addr = x + SSD1306_W*(y/8);
 	
 	ssd1306_buffer[addr] ^= (1<<(y&7));
+	ssd1306_mark_dirty(x, x, y/8);
 }
 
 /*
@@ -273,6 +703,7 @@ void ssd1306_drawImage(uint8_t x, uint8_t y, const unsigned char* input, uint8_t
 				buffer_addr = x_absolute + SSD1306_W * (y_absolute / 8);
 				// state of current pixel
 				uint8_t input_pixel = input_byte & (1 << pixel);
+				uint8_t old = ssd1306_buffer[buffer_addr];
 
 				switch (color_mode) {
 					case 0:
@@ -300,6 +731,8 @@ void ssd1306_drawImage(uint8_t x, uint8_t y, const unsigned char* input, uint8_t
 						ssd1306_buffer[buffer_addr] &= input_pixel ? ~v_mask : 0xFF;
 						break;
 				}
+				if(ssd1306_buffer[buffer_addr] != old)
+					ssd1306_mark_dirty(x_absolute, x_absolute, y_absolute / 8);
 			}
 			#if SSD1306_LOG_IMAGE == 1
 			printf("%02x ", input_byte);
@@ -311,6 +744,115 @@ void ssd1306_drawImage(uint8_t x, uint8_t y, const unsigned char* input, uint8_t
 	}
 }
 
+// operations for span fills
+#define SSD1306_OP_CLEAR 0
+#define SSD1306_OP_SET 1
+#define SSD1306_OP_XOR 2
+
+/*
+ * apply a bit mask to columns x0 to x1 of a page
+ * only the columns really changed are marked dirty
+ */
+void ssd1306_maskspan(uint8_t x0, uint8_t x1, uint8_t page, uint8_t mask, uint8_t op)
+{
+	uint8_t *p = &ssd1306_buffer[page*SSD1306_W];
+	uint8_t x, v, andm, xorm, first = 0xFF, last = 0;
+
+	if((mask == 0xFF) && (op != SSD1306_OP_XOR))
+	{
+		/* whole bytes: find the changed range and fill it */
+		v = op ? 0xFF : 0x00;
+		while((x0 <= x1) && (p[x0] == v))
+			x0++;
+		if(x0 > x1)
+			return;
+		while(p[x1] == v)
+			x1--;
+		memset(p+x0, v, x1-x0+1);
+		ssd1306_mark_dirty(x0, x1, page);
+		return;
+	}
+
+	/* all three operations as (byte & andm) ^ xorm */
+	andm = (op == SSD1306_OP_XOR) ? 0xFF : ~mask;
+	xorm = (op == SSD1306_OP_CLEAR) ? 0x00 : mask;
+	for(x=x0;x<=x1;x++)
+	{
+		v = (p[x] & andm) ^ xorm;
+		if(v != p[x])
+		{
+			p[x] = v;
+			if(first == 0xFF)
+				first = x;
+			last = x;
+		}
+	}
+	if(first != 0xFF)
+		ssd1306_mark_dirty(first, last, page);
+}
+
+/*
+ * fill a clipped rectangle (x0 <= x1 < W, y0 <= y1 < H) a page at a time
+ */
+void ssd1306_spanrect(uint8_t x0, uint8_t x1, uint8_t y0, uint8_t y1, uint8_t op)
+{
+	uint8_t page = y0/8, last = y1/8;
+	uint8_t mask = 0xFF << (y0&7);
+
+	for(;page<=last;page++)
+	{
+		if(page == last)
+			mask &= 0xFF >> (7-(y1&7));
+		ssd1306_maskspan(x0, x1, page, mask, op);
+		mask = 0xFF;
+	}
+}
+
+/*
+ * fill a rectangle where coordinates past 255 wrap around to 0,
+ * the same pixels the per-pixel loops with uint8_t counters draw
+ */
+void ssd1306_wraprect(uint8_t x, uint8_t y, uint8_t w, uint8_t h, uint8_t op)
+{
+	uint8_t xs[2], xe[2], ys[2], ye[2], nx = 0, ny = 0, i, j;
+	uint16_t end;
+
+	if(!w || !h)
+		return;
+
+	/* columns before and after wrapping */
+	end = x + w;
+	if(x < SSD1306_W)
+	{
+		xs[nx] = x;
+		xe[nx++] = (end > SSD1306_W ? SSD1306_W : end) - 1;
+	}
+	if(end > 256)
+	{
+		end -= 256;
+		xs[nx] = 0;
+		xe[nx++] = (end > SSD1306_W ? SSD1306_W : end) - 1;
+	}
+
+	/* rows before and after wrapping */
+	end = y + h;
+	if(y < SSD1306_H)
+	{
+		ys[ny] = y;
+		ye[ny++] = (end > SSD1306_H ? SSD1306_H : end) - 1;
+	}
+	if(end > 256)
+	{
+		end -= 256;
+		ys[ny] = 0;
+		ye[ny++] = (end > SSD1306_H ? SSD1306_H : end) - 1;
+	}
+
+	for(i=0;i<nx;i++)
+		for(j=0;j<ny;j++)
+			ssd1306_spanrect(xs[i], xe[i], ys[j], ye[j], op);
+}
+
 /*
  *  fast vert line
  */
@@ -319,10 +861,9 @@ void ssd1306_drawFastVLine(uint8_t x, uint8_t y, uint8_t h, uint8_t color)
 	// clipping
 	if((x >= SSD1306_W) || (y >= SSD1306_H)) return;
 	if((y+h-1) >= SSD1306_H) h = SSD1306_H-y;
-	while(h--)
-	{
-        ssd1306_drawPixel(x, y++, color);
-	}
+	if(!h) return;
+
+	ssd1306_spanrect(x, x, y, y+h-1, color ? SSD1306_OP_SET : SSD1306_OP_CLEAR);
 }
 
 /*
@@ -333,11 +874,9 @@ void ssd1306_drawFastHLine(uint8_t x, uint8_t y, uint8_t w, uint8_t color)
 	// clipping
 	if((x >= SSD1306_W) || (y >= SSD1306_H)) return;
 	if((x+w-1) >= SSD1306_W)  w = SSD1306_W-x;
+	if(!w) return;
 
-	while (w--)
-	{
-        ssd1306_drawPixel(x++, y, color);
-	}
+	ssd1306_maskspan(x, x+w-1, y/8, 1<<(y&7), color ? SSD1306_OP_SET : SSD1306_OP_CLEAR);
 }
 
 /*
@@ -491,21 +1030,7 @@ void ssd1306_drawRect(uint8_t x, uint8_t y, uint8_t w, uint8_t h, uint8_t color)
  */
 void ssd1306_fillRect(uint8_t x, uint8_t y, uint8_t w, uint8_t h, uint8_t color)
 {
-	uint8_t m, n=y, iw = w;
-	
-	/* scan vertical */
-	while(h--)
-	{
-		m=x;
-		w=iw;
-		/* scan horizontal */
-		while(w--)
-		{
-			/* invert pixels */
-			ssd1306_drawPixel(m++, n, color);
-		}
-		n++;
-	}
+	ssd1306_wraprect(x, y, w, h, color ? SSD1306_OP_SET : SSD1306_OP_CLEAR);
 }
 
 /*
@@ -513,20 +1038,21 @@ void ssd1306_fillRect(uint8_t x, uint8_t y, uint8_t w, uint8_t h, uint8_t color)
  */
 void ssd1306_xorrect(uint8_t x, uint8_t y, uint8_t w, uint8_t h)
 {
-	uint8_t m, n=y, iw = w;
-	
-	/* scan vertical */
-	while(h--)
+	ssd1306_wraprect(x, y, w, h, SSD1306_OP_XOR);
+}
+
+/*
+ * replace the bits in mask of a buffer byte
+ */
+void ssd1306_putbits(uint8_t x, uint8_t page, uint8_t bits, uint8_t mask)
+{
+	uint8_t *p = &ssd1306_buffer[page*SSD1306_W + x];
+	uint8_t v = (*p & ~mask) | (bits & mask);
+
+	if(v != *p)
 	{
-		m=x;
-		w=iw;
-		/* scan horizontal */
-		while(w--)
-		{
-			/* invert pixels */
-			ssd1306_xorPixel(m++, n);
-		}
-		n++;
+		*p = v;
+		ssd1306_mark_dirty(x, x, page);
 	}
 }
 
@@ -538,6 +1064,29 @@ void ssd1306_drawchar(uint8_t x, uint8_t y, uint8_t chr, uint8_t color)
 	uint16_t i, j, col;
 	uint8_t d;
 	
+#ifndef SSD1306_NO_COLFONT
+	if(y <= SSD1306_H-8)
+	{
+		/* whole glyph on screen vertically: a byte per column, */
+		/* split between two pages when y is not a multiple of 8 */
+		const unsigned char *g = &fontdata_col[chr<<3];
+		uint8_t page = y>>3, s = y&7, inv = color ? 0x00 : 0xFF;
+		uint8_t cx;
+		
+		for(j=0;j<8;j++)
+		{
+			cx = x+j;
+			if(cx >= SSD1306_W)
+				continue;
+			d = g[j] ^ inv;
+			ssd1306_putbits(cx, page, d<<s, 0xFF<<s);
+			if(s)
+				ssd1306_putbits(cx, page+1, d>>(8-s), 0xFF>>(8-s));
+		}
+		return;
+	}
+#endif
+
 	for(i=0;i<8;i++)
 	{
 		d = fontdata[(chr<<3)+i];
@@ -582,6 +1131,102 @@ typedef enum {
 	fontsize_64x64 = 8,
 } font_size_t;
 
+#ifndef SSD1306_NO_COLFONT
+/*
+ * each nybble with every bit doubled
+ */
+const uint8_t ssd1306_dbl[16] =
+{
+	0x00,0x03,0x0c,0x0f,
+	0x30,0x33,0x3c,0x3f,
+	0xc0,0xc3,0xcc,0xcf,
+	0xf0,0xf3,0xfc,0xff,
+};
+
+/*
+ * byte k of a glyph column scaled vertically by 2, 4 or 8
+ */
+uint8_t ssd1306_scalebyte(uint8_t c, uint8_t scale, uint8_t k)
+{
+	switch(scale)
+	{
+		case 2:
+			return ssd1306_dbl[(c >> (k*4)) & 0x0f];
+		case 4:
+			return ssd1306_dbl[ssd1306_dbl[(c >> (k*2)) & 0x03]];
+		case 8:
+			return ((c >> k) & 1) ? 0xff : 0x00;
+	}
+	return c;
+}
+
+/*
+ * scale the columns of a glyph vertically, scale bytes per column
+ */
+void ssd1306_scaleglyph(uint8_t *dst, uint8_t chr, uint8_t scale)
+{
+	const unsigned char *g = &fontdata_col[chr<<3];
+	uint8_t j, k;
+
+	for(j=0;j<8;j++)
+		for(k=0;k<scale;k++)
+			*dst++ = ssd1306_scalebyte(g[j], scale, k);
+}
+
+#ifdef SSD1306_GLYPH_CACHE
+/*
+ * small LRU cache of scaled glyphs (scales 2 and 4),
+ * define SSD1306_GLYPH_CACHE as the number of glyphs, each uses 36 bytes of RAM
+ */
+typedef struct {
+	uint8_t chr, scale;
+	uint16_t used;
+	uint8_t data[32];
+} ssd1306_glyph_t;
+
+ssd1306_glyph_t ssd1306_glyph_cache[SSD1306_GLYPH_CACHE];
+uint16_t ssd1306_glyph_tick;
+uint32_t ssd1306_glyph_hits, ssd1306_glyph_misses;
+
+/*
+ * find a scaled glyph in the cache, scale it in the least recently used entry if not there
+ */
+const uint8_t *ssd1306_cachedglyph(uint8_t chr, uint8_t scale)
+{
+	ssd1306_glyph_t *e, *lru = ssd1306_glyph_cache;
+	uint8_t i;
+
+	if(++ssd1306_glyph_tick == 0)
+	{
+		/* counter wrapped, restart the ages */
+		for(i=0;i<SSD1306_GLYPH_CACHE;i++)
+			ssd1306_glyph_cache[i].used = 0;
+		ssd1306_glyph_tick = 1;
+	}
+
+	for(i=0;i<SSD1306_GLYPH_CACHE;i++)
+	{
+		e = &ssd1306_glyph_cache[i];
+		if((e->scale == scale) && (e->chr == chr))
+		{
+			e->used = ssd1306_glyph_tick;
+			ssd1306_glyph_hits++;
+			return e->data;
+		}
+		if(e->used < lru->used)
+			lru = e;
+	}
+
+	ssd1306_glyph_misses++;
+	lru->chr = chr;
+	lru->scale = scale;
+	lru->used = ssd1306_glyph_tick;
+	ssd1306_scaleglyph(lru->data, chr, scale);
+	return lru->data;
+}
+#endif
+#endif
+
 /*
  * Draw character to the display buffer, scaled to size
  */
@@ -593,6 +1238,84 @@ void ssd1306_drawchar_sz(uint8_t x, uint8_t y, uint8_t chr, uint8_t color, font_
     // Determine the font scale factor based on the font_size parameter
     uint8_t font_scale = (uint8_t)font_size;
 
+#ifndef SSD1306_NO_COLFONT
+    // Character from the top of the screen down (clipped at the bottom and
+    // right edges, not wrapping past 255): build each column as page bytes
+    // and store it font_scale times
+    if(((font_scale == 2) || (font_scale == 4) || (font_scale == 8)) &&
+       (y < SSD1306_H) && (y + 8*font_scale <= 256) && (x + 8*font_scale <= 256))
+    {
+        const uint8_t *cols;
+        uint8_t page = y>>3, s = y&7, inv = color ? 0x00 : 0xff;
+        uint8_t n = font_scale + (s ? 1 : 0), np;
+        uint8_t out[9], mask[9], lo[9], hi[9], carry, cx, k, l, v, m;
+        uint8_t *p;
+
+        uint8_t scaled[64];
+
+#ifdef SSD1306_GLYPH_CACHE
+        if(font_scale <= 4)
+            cols = ssd1306_cachedglyph(chr, font_scale);
+        else
+#endif
+        {
+            ssd1306_scaleglyph(scaled, chr, font_scale);
+            cols = scaled;
+        }
+
+        // masks of the first and last pages when y is not page-aligned,
+        // the pages in between are stored whole; changed columns per page
+        for(k=0;k<n;k++)
+        {
+            mask[k] = 0xff;
+            lo[k] = 0xff;
+            hi[k] = 0;
+        }
+        mask[0] = 0xff << s;
+        if(s)
+            mask[n-1] = 0xff >> (8-s);
+
+        // pages on the screen
+        np = (page + n > SSD1306_PAGES) ? SSD1306_PAGES - page : n;
+
+        for(j=0;j<8;j++)
+        {
+            cx = x + j*font_scale;
+            if(cx >= SSD1306_W)
+                break;
+            carry = 0;
+            for(k=0;k<n;k++)
+            {
+                d = (k < font_scale) ? cols[j*font_scale+k] ^ inv : 0;
+                out[k] = (d << s) | carry;
+                carry = s ? d >> (8-s) : 0;
+            }
+            for(k=0;k<np;k++)
+            {
+                p = &ssd1306_buffer[(page+k)*SSD1306_W + cx];
+                m = mask[k];
+                for(l=0;(l<font_scale) && (cx+l < SSD1306_W);l++,p++)
+                {
+                    v = (m == 0xff) ? out[k] : (*p & ~m) | (out[k] & m);
+                    if(v != *p)
+                    {
+                        *p = v;
+                        if(lo[k] == 0xff)
+                            lo[k] = cx+l;
+                        hi[k] = cx+l;
+                    }
+                }
+            }
+        }
+
+        // one dirty range per page
+        for(k=0;k<np;k++)
+            if(lo[k] != 0xff)
+                ssd1306_mark_dirty(lo[k], hi[k], page+k);
+        return;
+    }
+#endif
+
     // Loop through each row of the font data
     for (i = 0; i < 8; i++)
     {
@@ -655,7 +1378,7 @@ uint8_t ssd1306_init(void)
 	
 	// clear display
 	ssd1306_setbuf(0);
-	ssd1306_refresh();
+	ssd1306_refresh_all();
 	
 	return 0;
 }
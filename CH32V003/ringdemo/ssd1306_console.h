@@ -0,0 +1,136 @@
+/*
+ * Single-File-Header for a scrolling text console on the SSD1306
+ * Must be included after ssd1306.h
+ *
+ * The 64 rows of the controller memory (GDDRAM) are used as a ring of
+ * text lines of 8 pixels, and the start line register (SETSTARTLINE)
+ * selects the line shown at the top. A new line is written over the
+ * line that leaves the screen (on 64x32 panels, in the hidden half of
+ * the ring) and the display scrolls by changing the start line, so only
+ * that line is sent instead of the whole buffer.
+ *
+ * The console owns the display: buffer page b holds the text of the ring
+ * lines r with r % SSD1306_PAGES == b, and ssd1306_console_refresh() sends
+ * them to the right place; don't use ssd1306_refresh() while it is on.
+ * The continuous scroll commands (0x26/0x27, 0x29/0x2A) move the picture
+ * by themselves at a frame rate, they are not used here.
+ */
+
+#ifndef _SSD1306_CONSOLE_H
+#define _SSD1306_CONSOLE_H
+
+#include <stdint.h>
+
+// GDDRAM rows of a buffer page and lines in the ring
+#ifdef SSD1306_FULLUSE
+#define SSD1306_CON_ROWS 8
+#else
+#define SSD1306_CON_ROWS 16
+#endif
+#define SSD1306_CON_RING (64/SSD1306_CON_ROWS)
+
+// characters in a line
+#define SSD1306_CON_COLS (SSD1306_W/8)
+
+// ring line at the top of the screen and cursor
+uint8_t ssd1306_con_top, ssd1306_con_col;
+
+// the start line must be sent
+uint8_t ssd1306_con_scrolled;
+
+/*
+ * ring line where the text is written (bottom of the screen)
+ */
+uint8_t ssd1306_console_line(void)
+{
+	return (ssd1306_con_top + SSD1306_PAGES - 1) % SSD1306_CON_RING;
+}
+
+/*
+ * clear the screen and start the console at the top
+ */
+void ssd1306_console_init(void)
+{
+	ssd1306_con_top = SSD1306_CON_RING - SSD1306_PAGES + 1;
+	ssd1306_con_col = 0;
+	ssd1306_setbuf(0);
+	ssd1306_cmd(SSD1306_SETSTARTLINE | ((ssd1306_con_top*SSD1306_CON_ROWS) & 0x3F));
+	ssd1306_con_scrolled = 0;
+	ssd1306_invalidate();
+}
+
+/*
+ * scroll up a line, the new bottom line is empty
+ */
+void ssd1306_console_newline(void)
+{
+	ssd1306_con_top = (ssd1306_con_top + 1) % SSD1306_CON_RING;
+	ssd1306_con_col = 0;
+	ssd1306_con_scrolled = 1;
+
+	uint8_t b = ssd1306_console_line() % SSD1306_PAGES;
+	memset(&ssd1306_buffer[b*SSD1306_W], 0, SSD1306_W);
+	ssd1306_mark_dirty(0, SSD1306_W-1, b);
+}
+
+/*
+ * write a character, '\n' starts a new line, long lines wrap
+ */
+void ssd1306_console_putc(char c)
+{
+	if(c == '\n')
+	{
+		ssd1306_console_newline();
+		return;
+	}
+	if(ssd1306_con_col == SSD1306_CON_COLS)
+		ssd1306_console_newline();
+	ssd1306_drawchar(ssd1306_con_col*8, (ssd1306_console_line() % SSD1306_PAGES)*8, c, 1);
+	ssd1306_con_col++;
+}
+
+/*
+ * write a string
+ */
+void ssd1306_console_puts(const char *str)
+{
+	while(*str)
+		ssd1306_console_putc(*str++);
+}
+
+/*
+ * send the changed lines, then the new start line
+ * each buffer page goes to the ring line on the screen that uses it
+ */
+void ssd1306_console_refresh(void)
+{
+	uint8_t i, r, b;
+
+	for(i=0;i<SSD1306_PAGES;i++)
+	{
+		r = (ssd1306_con_top + i) % SSD1306_CON_RING;
+		b = r % SSD1306_PAGES;
+		if(ssd1306_dirty_x0[b] > ssd1306_dirty_x1[b])
+			continue;
+		ssd1306_set_window(ssd1306_dirty_x0[b], ssd1306_dirty_x1[b], r, r);
+		ssd1306_send_data(ssd1306_dirty_x0[b], ssd1306_dirty_x1[b], b, b);
+		ssd1306_dirty_x0[b] = 0xFF;
+		ssd1306_dirty_x1[b] = 0;
+	}
+	if(ssd1306_con_scrolled)
+	{
+		ssd1306_cmd(SSD1306_SETSTARTLINE | ((ssd1306_con_top*SSD1306_CON_ROWS) & 0x3F));
+		ssd1306_con_scrolled = 0;
+	}
+}
+
+/*
+ * back to the normal use of the buffer, the next refresh sends everything
+ */
+void ssd1306_console_exit(void)
+{
+	ssd1306_cmd(SSD1306_SETSTARTLINE);
+	ssd1306_invalidate();
+}
+
+#endif
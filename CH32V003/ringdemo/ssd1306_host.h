@@ -0,0 +1,511 @@
+/*
+ * Single-File-Header for running ssd1306.h on a PC
+ * Replaces ssd1306_i2c.h: the packets sent by the library are
+ * interpreted as SSD1306 commands and data into a virtual GDDRAM,
+ * that can be saved as PGM or PNG images.
+ * The time on the I2C bus is simulated (9 clocks per byte), with
+ * SSD1306_I2C_DMA the DMA transfers advance with ssd1306_host_run().
+ * With SSD1306_STATS the clock of the statistics is the simulated bus
+ * time plus the time the PC spends drawing; ssd1306_host.fail makes the
+ * next packets time out, to see the error counters, and
+ * ssd1306_host.fail_dma the next DMA transfers.
+ * Must be included after ssd1306.h
+ */
+
+#ifndef _SSD1306_HOST_H
+#define _SSD1306_HOST_H
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+// size of the controller memory
+#define SSD1306_HOST_COLS 128
+#define SSD1306_HOST_PAGES 8
+
+// I2C bus clock rate, as SSD1306_I2C_CLKRATE in ssd1306_i2c.h
+#ifndef SSD1306_HOST_CLKRATE
+#define SSD1306_HOST_CLKRATE 1000000
+#endif
+
+// nanoseconds to send a byte (8 bits + ACK)
+#define SSD1306_HOST_BYTE_NS (9000000000ull/SSD1306_HOST_CLKRATE)
+
+// controller state
+typedef struct {
+	uint8_t gddram[SSD1306_HOST_PAGES][SSD1306_HOST_COLS];
+	uint8_t mem_mode;			// 0 = horizontal, 1 = vertical, 2 = page
+	uint8_t col_start, col_end, col;
+	uint8_t page_start, page_end, page;
+	uint8_t start_line;
+	uint8_t display_on;
+	uint8_t all_on;
+	uint8_t inverted;
+	uint8_t contrast;
+	uint8_t cmd[8];				// command being received
+	uint8_t cmd_len, cmd_need;
+	uint32_t bytes;				// bytes on the bus, including address and control
+	uint32_t packets;
+	uint64_t time_ns;			// simulated time
+	uint64_t cpu_ns;			// time the CPU waited for the bus
+	uint8_t dma_active;			// DMA transfer in progress
+	uint8_t *dma_ptr;
+	uint16_t dma_left;
+	uint8_t fail;				// packets that will time out
+	uint8_t fail_dma;			// DMA transfers that won't start
+} ssd1306_host_t;
+
+ssd1306_host_t ssd1306_host;
+
+#ifdef SSD1306_STATS
+// I2C errors and the packets that went through after them
+uint16_t ssd1306_i2c_timeouts, ssd1306_i2c_recoveries;
+uint8_t ssd1306_i2c_failed;
+
+/*
+ * clock for the frame statistics, in ns
+ */
+uint32_t ssd1306_ticks(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ssd1306_host.time_ns + ts.tv_sec*1000000000ull + ts.tv_nsec;
+}
+
+uint32_t ssd1306_ticks_us(uint32_t ticks)
+{
+	return ticks / 1000;
+}
+#endif
+
+/*
+ * number of argument bytes for each command
+ */
+uint8_t ssd1306_host_nargs(uint8_t cmd)
+{
+	switch(cmd)
+	{
+		case 0x81: case 0x20: case 0xA8: case 0xD3: case 0xD5:
+		case 0xD6: case 0xD9: case 0xDA: case 0xDB: case 0x8D:
+			return 1;
+		case 0x21: case 0x22: case 0xA3:
+			return 2;
+		case 0x29: case 0x2A:
+			return 5;
+		case 0x26: case 0x27:
+			return 6;
+	}
+	return 0;
+}
+
+/*
+ * execute a complete command
+ */
+void ssd1306_host_exec(uint8_t *c)
+{
+	if(c[0] < 0x10)
+	{
+		// page mode lower column
+		ssd1306_host.col = (ssd1306_host.col & 0xF0) | (c[0] & 0x0F);
+		ssd1306_host.col_start = ssd1306_host.col;
+	}
+	else if(c[0] < 0x20)
+	{
+		// page mode upper column
+		ssd1306_host.col = (ssd1306_host.col & 0x0F) | ((c[0] & 0x07) << 4);
+		ssd1306_host.col_start = ssd1306_host.col;
+	}
+	else if((c[0] >= 0x40) && (c[0] < 0x80))
+		ssd1306_host.start_line = c[0] & 0x3F;
+	else if((c[0] >= 0xB0) && (c[0] < 0xB8))
+		ssd1306_host.page = c[0] & 0x07;
+	else switch(c[0])
+	{
+		case 0x20:
+			ssd1306_host.mem_mode = c[1] & 0x03;
+			break;
+		case 0x21:
+			ssd1306_host.col_start = ssd1306_host.col = c[1] & 0x7F;
+			ssd1306_host.col_end = c[2] & 0x7F;
+			break;
+		case 0x22:
+			ssd1306_host.page_start = ssd1306_host.page = c[1] & 0x07;
+			ssd1306_host.page_end = c[2] & 0x07;
+			break;
+		case 0x81:
+			ssd1306_host.contrast = c[1];
+			break;
+		case 0xA4:
+		case 0xA5:
+			ssd1306_host.all_on = c[0] & 1;
+			break;
+		case 0xA6:
+		case 0xA7:
+			ssd1306_host.inverted = c[0] & 1;
+			break;
+		case 0xAE:
+		case 0xAF:
+			ssd1306_host.display_on = c[0] & 1;
+			break;
+	}
+}
+
+/*
+ * write a data byte at the current address and advance
+ */
+void ssd1306_host_write(uint8_t d)
+{
+	ssd1306_host.gddram[ssd1306_host.page][ssd1306_host.col] = d;
+
+	switch(ssd1306_host.mem_mode)
+	{
+		case 0:
+			// horizontal
+			if(ssd1306_host.col++ >= ssd1306_host.col_end)
+			{
+				ssd1306_host.col = ssd1306_host.col_start;
+				if(ssd1306_host.page++ >= ssd1306_host.page_end)
+					ssd1306_host.page = ssd1306_host.page_start;
+			}
+			break;
+		case 1:
+			// vertical
+			if(ssd1306_host.page++ >= ssd1306_host.page_end)
+			{
+				ssd1306_host.page = ssd1306_host.page_start;
+				if(ssd1306_host.col++ >= ssd1306_host.col_end)
+					ssd1306_host.col = ssd1306_host.col_start;
+			}
+			break;
+		default:
+			// page
+			if(ssd1306_host.col++ >= SSD1306_HOST_COLS-1)
+				ssd1306_host.col = ssd1306_host.col_start;
+			break;
+	}
+}
+
+/*
+ * the CPU waits for n bytes to go on the bus
+ */
+void ssd1306_host_wait(uint32_t n)
+{
+	ssd1306_host.time_ns += n*SSD1306_HOST_BYTE_NS;
+	ssd1306_host.cpu_ns += n*SSD1306_HOST_BYTE_NS;
+}
+
+#ifdef SSD1306_I2C_DMA
+/*
+ * let time go by, the DMA sends the bytes that fit
+ */
+void ssd1306_host_run(uint32_t us)
+{
+	uint64_t end = ssd1306_host.time_ns + us*1000ull;
+
+	while(ssd1306_host.dma_active && (ssd1306_host.time_ns + SSD1306_HOST_BYTE_NS <= end))
+	{
+		if(!ssd1306_host.dma_left)
+		{
+			/* transfer complete IRQ */
+			ssd1306_host.dma_left = ssd1306_dma_next(&ssd1306_host.dma_ptr);
+			if(!ssd1306_host.dma_left)
+			{
+				ssd1306_host.dma_active = 0;
+				ssd1306_dma_done(0);
+				break;
+			}
+		}
+		ssd1306_host_write(*ssd1306_host.dma_ptr++);
+		ssd1306_host.dma_left--;
+		ssd1306_host.bytes++;
+		ssd1306_host.time_ns += SSD1306_HOST_BYTE_NS;
+	}
+	if(ssd1306_host.time_ns < end)
+		ssd1306_host.time_ns = end;
+}
+
+/*
+ * start a data transfer, address and control byte are sent by the CPU
+ */
+uint8_t ssd1306_i2c_dma_start(void)
+{
+	if(ssd1306_host.fail_dma)
+	{
+		/* no ACK for the address */
+		ssd1306_host.fail_dma--;
+		ssd1306_host_wait(1);
+#ifdef SSD1306_STATS
+		ssd1306_i2c_timeouts++;
+		ssd1306_i2c_failed = 1;
+#endif
+		return 1;
+	}
+	ssd1306_host.bytes += 2;
+	ssd1306_host.packets++;
+	ssd1306_host_wait(2);
+	ssd1306_host.dma_left = 0;
+	ssd1306_host.dma_active = 1;
+	return 0;
+}
+
+uint8_t ssd1306_i2c_dma_busy(void)
+{
+	return ssd1306_host.dma_active;
+}
+#endif
+
+/*
+ * high-level packet send, same interface as the I2C version
+ */
+uint8_t ssd1306_pkt_send(uint8_t *data, uint8_t sz, uint8_t cmd)
+{
+#ifdef SSD1306_I2C_DMA
+	/* the bus is used by the DMA refresh */
+	while(ssd1306_host.dma_active)
+	{
+		uint64_t t = ssd1306_host.time_ns;
+		ssd1306_host_run(10);
+		ssd1306_host.cpu_ns += ssd1306_host.time_ns - t;
+	}
+#endif
+	if(ssd1306_host.fail)
+	{
+		/* the address is sent, then nothing happens until the timeout */
+		ssd1306_host.fail--;
+		ssd1306_host_wait(1);
+#ifdef SSD1306_STATS
+		ssd1306_i2c_timeouts++;
+		ssd1306_i2c_failed = 1;
+#endif
+		return 1;
+	}
+#ifdef SSD1306_STATS
+	if(ssd1306_i2c_failed)
+	{
+		ssd1306_i2c_recoveries++;
+		ssd1306_i2c_failed = 0;
+	}
+#endif
+	ssd1306_host.bytes += sz + 2;
+	ssd1306_host.packets++;
+	ssd1306_host_wait(sz + 2);
+
+	while(sz--)
+	{
+		if(cmd)
+		{
+			ssd1306_host.cmd[ssd1306_host.cmd_len++] = *data++;
+			if(ssd1306_host.cmd_len == 1)
+				ssd1306_host.cmd_need = 1 + ssd1306_host_nargs(ssd1306_host.cmd[0]);
+			if(ssd1306_host.cmd_len == ssd1306_host.cmd_need)
+			{
+				ssd1306_host_exec(ssd1306_host.cmd);
+				ssd1306_host.cmd_len = 0;
+			}
+		}
+		else
+			ssd1306_host_write(*data++);
+	}
+	return 0;
+}
+
+/*
+ * reset puts the controller in its power-on state
+ * GDDRAM content is random at power on, it is filled with a pattern
+ */
+void ssd1306_rst(void)
+{
+	for(int p=0;p<SSD1306_HOST_PAGES;p++)
+		memset(ssd1306_host.gddram[p], 0x55 << (p&1), SSD1306_HOST_COLS);
+	ssd1306_host.mem_mode = 2;
+	ssd1306_host.col_start = ssd1306_host.col = 0;
+	ssd1306_host.col_end = SSD1306_HOST_COLS-1;
+	ssd1306_host.page_start = ssd1306_host.page = 0;
+	ssd1306_host.page_end = SSD1306_HOST_PAGES-1;
+	ssd1306_host.start_line = 0;
+	ssd1306_host.display_on = 0;
+	ssd1306_host.all_on = 0;
+	ssd1306_host.inverted = 0;
+	ssd1306_host.contrast = 0x7F;
+	ssd1306_host.cmd_len = 0;
+	ssd1306_host.bytes = 0;
+	ssd1306_host.packets = 0;
+	ssd1306_host.time_ns = 0;
+	ssd1306_host.cpu_ns = 0;
+	ssd1306_host.dma_active = 0;
+	ssd1306_host.fail = 0;
+	ssd1306_host.fail_dma = 0;
+}
+
+/*
+ * state of a pixel as seen on the panel
+ * 128x32 panels are connected to every other COM line
+ */
+uint8_t ssd1306_host_pixel(uint8_t x, uint8_t y)
+{
+	uint8_t row, on;
+
+	if(!ssd1306_host.display_on)
+		return 0;
+	if(ssd1306_host.all_on)
+		return 1;
+#ifdef SSD1306_FULLUSE
+	row = y;
+#else
+	row = 2*y + 1;
+#endif
+	row = (row + ssd1306_host.start_line) & 0x3F;
+	on = (ssd1306_host.gddram[row>>3][(x+SSD1306_OFFSET)&0x7F] >> (row&7)) & 1;
+	return on ^ ssd1306_host.inverted;
+}
+
+/*
+ * save the panel as a binary PGM, each pixel becomes scale x scale
+ */
+int ssd1306_host_save_pgm(const char *fname, uint8_t scale)
+{
+	FILE *f = fopen(fname, "wb");
+	if(!f)
+		return 1;
+	fprintf(f, "P5\n%d %d\n255\n", SSD1306_W*scale, SSD1306_H*scale);
+	for(int y=0;y<SSD1306_H*scale;y++)
+		for(int x=0;x<SSD1306_W*scale;x++)
+			fputc(ssd1306_host_pixel(x/scale, y/scale) ? 255 : 0, f);
+	fclose(f);
+	return 0;
+}
+
+/*
+ * compare the panel with a PGM saved with scale 1
+ * returns the number of different pixels, -1 if the file can't be used
+ */
+int ssd1306_host_compare_pgm(const char *fname)
+{
+	int w, h, max, diff = 0;
+	FILE *f = fopen(fname, "rb");
+	if(!f)
+		return -1;
+	if((fscanf(f, "P5 %d %d %d", &w, &h, &max) != 3) ||
+	   (w != SSD1306_W) || (h != SSD1306_H) || (fgetc(f) == EOF))
+	{
+		fclose(f);
+		return -1;
+	}
+	for(int y=0;y<SSD1306_H;y++)
+		for(int x=0;x<SSD1306_W;x++)
+		{
+			int c = fgetc(f);
+			if(c == EOF)
+			{
+				fclose(f);
+				return -1;
+			}
+			if((c != 0) != ssd1306_host_pixel(x, y))
+				diff++;
+		}
+	fclose(f);
+	return diff;
+}
+
+/*
+ * PNG helpers: CRC-32 and big-endian output
+ */
+uint32_t ssd1306_host_crc(uint32_t crc, const uint8_t *p, uint32_t n)
+{
+	crc = ~crc;
+	while(n--)
+	{
+		crc ^= *p++;
+		for(int k=0;k<8;k++)
+			crc = (crc >> 1) ^ (0xEDB88320 & -(crc & 1));
+	}
+	return ~crc;
+}
+
+void ssd1306_host_be32(uint8_t *p, uint32_t v)
+{
+	p[0] = v >> 24;
+	p[1] = v >> 16;
+	p[2] = v >> 8;
+	p[3] = v;
+}
+
+void ssd1306_host_chunk(FILE *f, const char *type, const uint8_t *data, uint32_t n)
+{
+	uint8_t b[4];
+	uint32_t crc;
+
+	ssd1306_host_be32(b, n);
+	fwrite(b, 1, 4, f);
+	fwrite(type, 1, 4, f);
+	fwrite(data, 1, n, f);
+	crc = ssd1306_host_crc(0, (const uint8_t *)type, 4);
+	crc = ssd1306_host_crc(crc, data, n);
+	ssd1306_host_be32(b, crc);
+	fwrite(b, 1, 4, f);
+}
+
+/*
+ * save the panel as a grayscale PNG, each pixel becomes scale x scale
+ * the image is stored uncompressed, one zlib block per scanline
+ */
+int ssd1306_host_save_png(const char *fname, uint8_t scale)
+{
+	static const uint8_t sig[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+	uint32_t w = SSD1306_W*scale, h = SSD1306_H*scale;
+	uint32_t line = w + 1;				// filter byte + pixels
+	uint32_t size = 2 + h*(5 + line) + 4;
+	uint8_t *z = malloc(size), *p;
+	uint8_t ihdr[13];
+	uint32_t a = 1, b = 0;
+	FILE *f;
+
+	if(!z)
+		return 1;
+	f = fopen(fname, "wb");
+	if(!f)
+	{
+		free(z);
+		return 1;
+	}
+
+	// zlib header, then a stored block per scanline
+	p = z;
+	*p++ = 0x78;
+	*p++ = 0x01;
+	for(uint32_t y=0;y<h;y++)
+	{
+		*p++ = (y == h-1);
+		*p++ = line & 0xFF;
+		*p++ = line >> 8;
+		*p++ = ~line & 0xFF;
+		*p++ = (~line >> 8) & 0xFF;
+		for(uint32_t x=0;x<line;x++)
+		{
+			*p = x ? (ssd1306_host_pixel((x-1)/scale, y/scale) ? 255 : 0) : 0;
+			a = (a + *p) % 65521;
+			b = (b + a) % 65521;
+			p++;
+		}
+	}
+	ssd1306_host_be32(p, (b << 16) | a);
+
+	ssd1306_host_be32(ihdr, w);
+	ssd1306_host_be32(ihdr+4, h);
+	ihdr[8] = 8;		// bit depth
+	ihdr[9] = 0;		// grayscale
+	ihdr[10] = ihdr[11] = ihdr[12] = 0;
+
+	fwrite(sig, 1, 8, f);
+	ssd1306_host_chunk(f, "IHDR", ihdr, 13);
+	ssd1306_host_chunk(f, "IDAT", z, size);
+	ssd1306_host_chunk(f, "IEND", NULL, 0);
+	fclose(f);
+	free(z);
+	return 0;
+}
+
+#endif
@@ -26,6 +26,30 @@
 // uncomment this to enable IRQ-driven operation
 //#define SSD1306_I2C_IRQ
 
+// uncomment this to enable DMA refresh (ssd1306_refresh_dma)
+//#define SSD1306_I2C_DMA
+
+// define SSD1306_STATS (before including) to measure frames, see ssd1306.h
+
+#ifdef SSD1306_STATS
+// I2C errors and the packets that went through after them
+uint16_t ssd1306_i2c_timeouts, ssd1306_i2c_recoveries;
+uint8_t ssd1306_i2c_failed;
+
+/*
+ * clock for the frame statistics
+ */
+uint32_t ssd1306_ticks(void)
+{
+	return SysTick->CNT;
+}
+
+uint32_t ssd1306_ticks_us(uint32_t ticks)
+{
+	return ticks / DELAY_US_TIME;
+}
+#endif
+
 #ifdef SSD1306_I2C_IRQ
 // some stuff that IRQ mode needs
 volatile uint8_t ssd1306_i2c_send_buffer[64], *ssd1306_i2c_send_ptr, ssd1306_i2c_send_sz, ssd1306_i2c_irq_state;
@@ -34,6 +58,23 @@ volatile uint8_t ssd1306_i2c_send_buffer[64], *ssd1306_i2c_send_ptr, ssd1306_i2c
 //#define IRQ_DIAG
 #endif
 
+#ifdef SSD1306_I2C_DMA
+#ifdef SSD1306_I2C_IRQ
+#error "SSD1306_I2C_DMA ends the transfer in I2C1_EV_IRQHandler, it can't be used with SSD1306_I2C_IRQ"
+#endif
+
+// a DMA transfer that takes longer than this (ms) has failed
+#define SSD1306_I2C_DMA_TIMEOUT 100
+
+// DMA transfer state and SysTick count at the start
+volatile uint8_t ssd1306_i2c_dma_state;
+uint32_t ssd1306_i2c_dma_start_time;
+
+// data source and end of transfer, in ssd1306.h
+uint16_t ssd1306_dma_next(uint8_t **data);
+void ssd1306_dma_done(uint8_t err);
+#endif
+
 /*
  * init just I2C
  */
@@ -77,6 +118,29 @@ void ssd1306_i2c_setup(void)
 	// initialize the state
 	ssd1306_i2c_irq_state = 0;
 #endif
+
+#ifdef SSD1306_I2C_DMA
+	// DMA1 channel 6 is I2C1 TX, memory to I2C data register a byte at a time
+	RCC->AHBPCENR |= RCC_AHBPeriph_DMA1;
+	DMA1_Channel6->CFGR = 0;
+	DMA1_Channel6->PADDR = (uint32_t)&I2C1->DATAR;
+	DMA1_Channel6->CFGR =
+		DMA_M2M_Disable |
+		DMA_Priority_High |
+		DMA_MemoryDataSize_Byte |
+		DMA_PeripheralDataSize_Byte |
+		DMA_MemoryInc_Enable |
+		DMA_PeripheralInc_Disable |
+		DMA_Mode_Normal |
+		DMA_DIR_PeripheralDST |
+		DMA_IT_TC;
+	NVIC_EnableIRQ(DMA1_Channel6_IRQn);
+	// the end of the transfer (BTF), when I2C_CTLR2_ITEVTEN is set
+	NVIC_EnableIRQ(I2C1_EV_IRQn);
+
+	// initialize the state
+	ssd1306_i2c_dma_state = 0;
+#endif
 	
 	// Enable I2C
 	I2C1->CTLR1 |= I2C_CTLR1_PE;
@@ -104,6 +168,10 @@ uint8_t ssd1306_i2c_error(uint8_t err)
 {
 	// report error
 	printf("ssd1306_i2c_error - timeout waiting for %s\n\r", errstr[err]);
+#ifdef SSD1306_STATS
+	ssd1306_i2c_timeouts++;
+	ssd1306_i2c_failed = 1;
+#endif
 	
 	// reset & initialize I2C
 	ssd1306_i2c_setup();
@@ -126,35 +194,13 @@ uint8_t ssd1306_i2c_chk_evt(uint32_t event_mask)
 	return (status & event_mask) == event_mask;
 }
 
-#ifdef SSD1306_I2C_IRQ
 /*
- * packet send for IRQ-driven operation
+ * START condition and address, ready for transmitting data
  */
-uint8_t ssd1306_i2c_send(uint8_t addr, uint8_t *data, uint8_t sz)
+uint8_t ssd1306_i2c_begin(uint8_t addr)
 {
 	int32_t timeout;
 	
-#ifdef IRQ_DIAG
-	GPIOC->BSHR = (1<<(3));
-#endif
-	
-	// error out if buffer under/overflow
-	if((sz > sizeof(ssd1306_i2c_send_buffer)) || !sz)
-		return 2;
-	
-	// wait for previous packet to finish
-	while(ssd1306_i2c_irq_state);
-	
-#ifdef IRQ_DIAG
-	GPIOC->BSHR = (1<<(16+3));
-	GPIOC->BSHR = (1<<(4));
-#endif
-	
-	// init buffer for sending
-	ssd1306_i2c_send_sz = sz;
-	ssd1306_i2c_send_ptr = ssd1306_i2c_send_buffer;
-	memcpy((uint8_t *)ssd1306_i2c_send_buffer, data, sz);
-	
 	// wait for not busy
 	timeout = TIMEOUT_MAX;
 	while((I2C1->STAR2 & I2C_STAR2_BUSY) && (timeout--));
@@ -179,6 +225,40 @@ uint8_t ssd1306_i2c_send(uint8_t addr, uint8_t *data, uint8_t sz)
 	if(timeout==-1)
 		return ssd1306_i2c_error(2);
 
+	return 0;
+}
+
+#ifdef SSD1306_I2C_IRQ
+/*
+ * packet send for IRQ-driven operation
+ */
+uint8_t ssd1306_i2c_send(uint8_t addr, uint8_t *data, uint8_t sz)
+{
+#ifdef IRQ_DIAG
+	GPIOC->BSHR = (1<<(3));
+#endif
+	
+	// error out if buffer under/overflow
+	if((sz > sizeof(ssd1306_i2c_send_buffer)) || !sz)
+		return 2;
+	
+	// wait for previous packet to finish
+	while(ssd1306_i2c_irq_state);
+	
+#ifdef IRQ_DIAG
+	GPIOC->BSHR = (1<<(16+3));
+	GPIOC->BSHR = (1<<(4));
+#endif
+	
+	// init buffer for sending
+	ssd1306_i2c_send_sz = sz;
+	ssd1306_i2c_send_ptr = ssd1306_i2c_send_buffer;
+	memcpy((uint8_t *)ssd1306_i2c_send_buffer, data, sz);
+	
+	// START and address
+	if(ssd1306_i2c_begin(addr))
+		return 1;
+
 	// Enable TXE interrupt
 	I2C1->CTLR2 |= I2C_CTLR2_ITBUFEN | I2C_CTLR2_ITEVTEN;
 	ssd1306_i2c_irq_state = 1;
@@ -243,29 +323,9 @@ uint8_t ssd1306_i2c_send(uint8_t addr, uint8_t *data, uint8_t sz)
 {
 	int32_t timeout;
 	
-	// wait for not busy
-	timeout = TIMEOUT_MAX;
-	while((I2C1->STAR2 & I2C_STAR2_BUSY) && (timeout--));
-	if(timeout==-1)
-		return ssd1306_i2c_error(0);
-
-	// Set START condition
-	I2C1->CTLR1 |= I2C_CTLR1_START;
-	
-	// wait for master mode select
-	timeout = TIMEOUT_MAX;
-	while((!ssd1306_i2c_chk_evt(SSD1306_I2C_EVENT_MASTER_MODE_SELECT)) && (timeout--));
-	if(timeout==-1)
-		return ssd1306_i2c_error(1);
-	
-	// send 7-bit address + write flag
-	I2C1->DATAR = addr<<1;
-
-	// wait for transmit condition
-	timeout = TIMEOUT_MAX;
-	while((!ssd1306_i2c_chk_evt(SSD1306_I2C_EVENT_MASTER_TRANSMITTER_MODE_SELECTED)) && (timeout--));
-	if(timeout==-1)
-		return ssd1306_i2c_error(2);
+	// START and address
+	if(ssd1306_i2c_begin(addr))
+		return 1;
 
 	// send data one byte at a time
 	while(sz--)
@@ -294,13 +354,130 @@ uint8_t ssd1306_i2c_send(uint8_t addr, uint8_t *data, uint8_t sz)
 }
 #endif
 
+#ifdef SSD1306_I2C_DMA
+/*
+ * load the next chunk in the DMA, after the last one wait for the
+ * last byte to go out (BTF) with the I2C event IRQ
+ */
+void ssd1306_i2c_dma_chunk(void)
+{
+	uint8_t *data;
+	uint16_t sz = ssd1306_dma_next(&data);
+	
+	DMA1_Channel6->CFGR &= ~DMA_CFGR1_EN;
+	if(sz)
+	{
+		DMA1_Channel6->MADDR = (uint32_t)data;
+		DMA1_Channel6->CNTR = sz;
+		DMA1_Channel6->CFGR |= DMA_CFGR1_EN;
+		return;
+	}
+	
+	// no more data
+	I2C1->CTLR2 &= ~I2C_CTLR2_DMAEN;
+	I2C1->CTLR2 |= I2C_CTLR2_ITEVTEN;
+}
+
+/*
+ * start a data transfer, the data comes from ssd1306_dma_next()
+ */
+uint8_t ssd1306_i2c_dma_start(void)
+{
+	int32_t timeout;
+	
+	// START and address
+	if(ssd1306_i2c_begin(SSD1306_I2C_ADDR))
+		return 1;
+	
+	// control byte: all the rest is data
+	timeout = TIMEOUT_MAX;
+	while(!(I2C1->STAR1 & I2C_STAR1_TXE) && (timeout--));
+	if(timeout==-1)
+		return ssd1306_i2c_error(3);
+	I2C1->DATAR = 0x40;
+	
+	// the DMA takes over, a chunk at a time
+	ssd1306_i2c_dma_start_time = SysTick->CNT;
+	ssd1306_i2c_dma_state = 1;
+	I2C1->CTLR2 |= I2C_CTLR2_DMAEN;
+	ssd1306_i2c_dma_chunk();
+	
+	return 0;
+}
+
+/*
+ * true while a DMA transfer is in progress
+ * a transfer that doesn't end (no ACK, bus stuck) is stopped here, out
+ * of the IRQs: the error is reported and the I2C reset
+ */
+uint8_t ssd1306_i2c_dma_busy(void)
+{
+	if(ssd1306_i2c_dma_state &&
+		(SysTick->CNT - ssd1306_i2c_dma_start_time > SSD1306_I2C_DMA_TIMEOUT*DELAY_MS_TIME))
+	{
+		// no IRQ until the reset, it enables them again
+		NVIC_DisableIRQ(DMA1_Channel6_IRQn);
+		NVIC_DisableIRQ(I2C1_EV_IRQn);
+		DMA1->INTFCR = DMA_CGIF6;
+		ssd1306_i2c_dma_state = 0;
+		ssd1306_i2c_error(4);
+		// done runs as it does from the IRQ
+		__disable_irq();
+		ssd1306_dma_done(1);
+		__enable_irq();
+	}
+	return ssd1306_i2c_dma_state;
+}
+
+/*
+ * IRQ handler for DMA transfer complete
+ */
+void DMA1_Channel6_IRQHandler(void) __attribute__((interrupt));
+void DMA1_Channel6_IRQHandler(void)
+{
+	if(DMA1->INTFR & DMA_TCIF6)
+	{
+		DMA1->INTFCR = DMA_CGIF6;
+		ssd1306_i2c_dma_chunk();
+	}
+}
+
+/*
+ * IRQ handler for I2C events, only enabled after the last chunk:
+ * the last byte is out, STOP and end of the transfer
+ */
+void I2C1_EV_IRQHandler(void) __attribute__((interrupt));
+void I2C1_EV_IRQHandler(void)
+{
+	if(I2C1->STAR1 & I2C_STAR1_BTF)
+	{
+		I2C1->CTLR2 &= ~I2C_CTLR2_ITEVTEN;
+		I2C1->CTLR1 |= I2C_CTLR1_STOP;
+#ifdef SSD1306_STATS
+		if(ssd1306_i2c_failed)
+		{
+			ssd1306_i2c_recoveries++;
+			ssd1306_i2c_failed = 0;
+		}
+#endif
+		ssd1306_i2c_dma_state = 0;
+		ssd1306_dma_done(0);
+	}
+}
+#endif
+
 /*
  * high-level packet send for I2C
  */
 uint8_t ssd1306_pkt_send(uint8_t *data, uint8_t sz, uint8_t cmd)
 {
-	uint8_t pkt[33];
+	uint8_t pkt[33], err;
 	
+#ifdef SSD1306_I2C_DMA
+	// the bus is used by the DMA refresh
+	while(ssd1306_i2c_dma_busy());
+#endif
+
 	/* build command or data packets */
 	if(cmd)
 	{
@@ -312,7 +489,15 @@ uint8_t ssd1306_pkt_send(uint8_t *data, uint8_t sz, uint8_t cmd)
 		pkt[0] = 0x40;
 		memcpy(&pkt[1], data, sz);
 	}
-	return ssd1306_i2c_send(SSD1306_I2C_ADDR, pkt, sz+1);
+	err = ssd1306_i2c_send(SSD1306_I2C_ADDR, pkt, sz+1);
+#ifdef SSD1306_STATS
+	if(!err && ssd1306_i2c_failed)
+	{
+		ssd1306_i2c_recoveries++;
+		ssd1306_i2c_failed = 0;
+	}
+#endif
+	return err;
 }
 
 /*
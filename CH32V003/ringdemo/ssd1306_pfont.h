@@ -0,0 +1,75 @@
+/*
+ * Single-File-Header for proportional text on the SSD1306 buffer
+ * Must be included after ssd1306.h, with fonts made by
+ * ../fonts/pfontc.py --bpp 1
+ *
+ * Glyphs are stored like the display buffer (pages of 8 rows, a byte per
+ * column, top row in the LSB) with only the columns that have ink, so a
+ * column is drawn with one or two byte writes. Text is transparent: only
+ * the pixels of the glyphs are changed.
+ */
+
+#ifndef _SSD1306_PFONT_H
+#define _SSD1306_PFONT_H
+
+#include <stdint.h>
+
+/*
+ * draw glyph g with its top left corner at x,y
+ */
+void ssd1306_pfont_glyph(const pfont_t *font, int16_t x, int16_t y, uint8_t g, uint8_t color)
+{
+	const pfont_glyph_t *pg = &font->glyphs[g];
+	const uint8_t *src = &font->data[pg->offset];
+	uint8_t pages = (font->height + 7) >> 3;
+	uint8_t bits = color ? 0xFF : 0x00;
+	int16_t c0 = x < 0 ? -x : 0;
+	int16_t c1 = pg->width;
+
+	if(x + c1 > SSD1306_W)
+		c1 = SSD1306_W - x;
+	for(uint8_t p=0;p<pages;p++, src += pg->width)
+	{
+		int16_t y0 = y + p*8;
+		int16_t page = y0 >> 3;		// rounds down, also for negative y
+		uint8_t s = y0 & 7;
+
+		if((page >= SSD1306_PAGES) || (page < -1))
+			continue;
+		for(int16_t c=c0;c<c1;c++)
+		{
+			uint8_t d = src[c];
+			if(!d)
+				continue;
+			if(page >= 0)
+				ssd1306_putbits(x+c, page, bits, d<<s);
+			if(s && (page+1 < SSD1306_PAGES))
+				ssd1306_putbits(x+c, page+1, bits, d>>(8-s));
+		}
+	}
+}
+
+/*
+ * draw a string with the top left corner at x,y
+ * returns the x where the next character would go
+ */
+int16_t ssd1306_drawpstr(const pfont_t *font, int16_t x, int16_t y, const char *str, uint8_t color)
+{
+	uint8_t g, prev = 0xFF;
+
+	while(*str)
+	{
+		g = pfont_glyph(font, *str++);
+		if(prev != 0xFF)
+			x += font->glyphs[prev].advance + pfont_kern(font, prev, g);
+		if(x >= SSD1306_W)
+			return x;
+		ssd1306_pfont_glyph(font, x, y, g, color);
+		prev = g;
+	}
+	if(prev != 0xFF)
+		x += font->glyphs[prev].advance;
+	return x;
+}
+
+#endif
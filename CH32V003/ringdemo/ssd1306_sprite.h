@@ -0,0 +1,345 @@
+/*
+ * Single-File-Header for sprites and layers on the SSD1306 buffer
+ * Must be included after ssd1306.h
+ *
+ * Sprites are stored like the display buffer: pages of 8 rows, a byte
+ * per column with the top row in the LSB (sprconv.py converts PBM
+ * images). Any width and height can be used and drawing works a byte
+ * at a time, shifting the sprite bytes when y is not a multiple of 8.
+ *
+ * Layers put sprites on top of a background, in z order. Moving or
+ * changing a layer marks rectangles that are redrawn by
+ * ssd1306_layers_compose(); the bytes that change are then sent by
+ * ssd1306_refresh().
+ */
+
+#ifndef _SSD1306_SPRITE_H
+#define _SSD1306_SPRITE_H
+
+#include <stdint.h>
+
+// number of layers and of rectangles to redraw
+#ifndef SSD1306_MAX_LAYERS
+#define SSD1306_MAX_LAYERS 8
+#endif
+#ifndef SSD1306_MAX_RECTS
+#define SSD1306_MAX_RECTS 6
+#endif
+
+// color modes, 0 to 5 are the same as in ssd1306_drawImage
+#define SSD1306_SPR_WRITE		0	// write pixels as they are
+#define SSD1306_SPR_INVERT		1	// write pixels after inversion
+#define SSD1306_SPR_CLEAR0		2	// 0 clears pixel
+#define SSD1306_SPR_SET1		3	// 1 sets pixel
+#define SSD1306_SPR_SET0		4	// 0 sets pixel
+#define SSD1306_SPR_CLEAR1		5	// 1 clears pixel
+#define SSD1306_SPR_XOR			6	// 1 inverts pixel
+
+typedef struct {
+	uint8_t w, h;				// size in pixels
+	const uint8_t *data;		// (h+7)/8 pages of w bytes
+	const uint8_t *mask;		// same layout, only 1s are drawn (NULL = all)
+} ssd1306_sprite_t;
+
+/*
+ * each mode as masks for: input inversion, write, clear, set and invert
+ * with m the pixels to draw and e = (data ^ inv) & m, a byte becomes
+ * ((byte & ~((m & write) | (e & clear))) | (e & set)) ^ (e & invert)
+ */
+const uint8_t ssd1306_spr_ops[7][5] =
+{
+	{ 0x00, 0xFF, 0x00, 0xFF, 0x00 },
+	{ 0xFF, 0xFF, 0x00, 0xFF, 0x00 },
+	{ 0xFF, 0x00, 0xFF, 0x00, 0x00 },
+	{ 0x00, 0x00, 0x00, 0xFF, 0x00 },
+	{ 0xFF, 0x00, 0x00, 0xFF, 0x00 },
+	{ 0x00, 0x00, 0xFF, 0x00, 0x00 },
+	{ 0x00, 0x00, 0x00, 0x00, 0xFF },
+};
+
+// pixels outside this rectangle are not changed
+int16_t ssd1306_clip_x0 = 0, ssd1306_clip_y0 = 0;
+int16_t ssd1306_clip_x1 = SSD1306_W-1, ssd1306_clip_y1 = SSD1306_H-1;
+
+/*
+ * draw a sprite with its top left corner at x, y (may be off screen)
+ */
+void ssd1306_sprite_draw(const ssd1306_sprite_t *spr, int16_t x, int16_t y, uint8_t mode)
+{
+	int16_t x0, x1, y0, y1, c, dp;
+	uint8_t sp, part, pages, s, valid, rows, lo, hi, d, m, e, v;
+	uint8_t inv, wr, clr, st, xr, first, last;
+	uint8_t *p;
+	const uint8_t *src, *msk;
+
+	if(mode > SSD1306_SPR_XOR)
+		return;
+	inv = ssd1306_spr_ops[mode][0];
+	wr = ssd1306_spr_ops[mode][1];
+	clr = ssd1306_spr_ops[mode][2];
+	st = ssd1306_spr_ops[mode][3];
+	xr = ssd1306_spr_ops[mode][4];
+
+	/* visible part */
+	x0 = x > ssd1306_clip_x0 ? x : ssd1306_clip_x0;
+	x1 = x+spr->w-1 < ssd1306_clip_x1 ? x+spr->w-1 : ssd1306_clip_x1;
+	y0 = y > ssd1306_clip_y0 ? y : ssd1306_clip_y0;
+	y1 = y+spr->h-1 < ssd1306_clip_y1 ? y+spr->h-1 : ssd1306_clip_y1;
+	if((x0 > x1) || (y0 > y1))
+		return;
+
+	pages = (spr->h+7)/8;
+	s = y & 7;
+	for(sp=0;sp<pages;sp++)
+	{
+		/* rows of the last page below the sprite are not drawn */
+		valid = ((sp+1)*8 > spr->h) ? 0xFF >> ((sp+1)*8 - spr->h) : 0xFF;
+
+		/* a sprite page covers one or two buffer pages */
+		for(part=0;part<(s ? 2 : 1);part++)
+		{
+			dp = (y >> 3) + sp + part;
+			if((dp < (y0 >> 3)) || (dp > (y1 >> 3)))
+				continue;
+
+			/* rows of this page inside the clip rectangle */
+			lo = (y0 > dp*8) ? y0 - dp*8 : 0;
+			hi = (y1 < dp*8+7) ? y1 - dp*8 : 7;
+			rows = (0xFF << lo) & (0xFF >> (7-hi));
+
+			p = &ssd1306_buffer[dp*SSD1306_W];
+			src = &spr->data[sp*spr->w];
+			msk = spr->mask ? &spr->mask[sp*spr->w] : 0;
+			first = 0xFF;
+			last = 0;
+			for(c=x0;c<=x1;c++)
+			{
+				d = src[c-x];
+				m = valid & (msk ? msk[c-x] : 0xFF);
+				if(part)
+				{
+					d >>= 8-s;
+					m >>= 8-s;
+				}
+				else
+				{
+					d <<= s;
+					m <<= s;
+				}
+				m &= rows;
+				e = (d ^ inv) & m;
+				v = ((p[c] & ~((m & wr) | (e & clr))) | (e & st)) ^ (e & xr);
+				if(v != p[c])
+				{
+					p[c] = v;
+					if(first == 0xFF)
+						first = c;
+					last = c;
+				}
+			}
+			if(first != 0xFF)
+				ssd1306_mark_dirty(first, last, dp);
+		}
+	}
+}
+
+/*
+ * a sprite on the screen
+ */
+typedef struct {
+	const ssd1306_sprite_t *sprite;
+	int16_t x, y;
+	uint8_t mode;
+	uint8_t z;					// higher z is drawn on top
+	uint8_t visible;
+	uint8_t used;
+} ssd1306_layer_t;
+
+typedef struct {
+	uint8_t x0, y0, x1, y1;
+} ssd1306_rect_t;
+
+ssd1306_layer_t ssd1306_layers[SSD1306_MAX_LAYERS];
+uint8_t ssd1306_layer_order[SSD1306_MAX_LAYERS], ssd1306_nlayers;
+ssd1306_rect_t ssd1306_rects[SSD1306_MAX_RECTS];
+uint8_t ssd1306_nrects;
+
+// redraws the background in a rectangle, NULL clears it
+void (*ssd1306_layer_bg)(uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1);
+
+/*
+ * mark a rectangle to be redrawn, rectangles that touch are joined
+ */
+void ssd1306_layers_invalidate(int16_t x0, int16_t y0, int16_t x1, int16_t y1)
+{
+	ssd1306_rect_t *r;
+	uint8_t i;
+
+	/* clip to the screen */
+	if(x0 < 0) x0 = 0;
+	if(y0 < 0) y0 = 0;
+	if(x1 > SSD1306_W-1) x1 = SSD1306_W-1;
+	if(y1 > SSD1306_H-1) y1 = SSD1306_H-1;
+	if((x0 > x1) || (y0 > y1))
+		return;
+
+	for(i=0;i<ssd1306_nrects;i++)
+	{
+		r = &ssd1306_rects[i];
+		if((x0 <= r->x1+1) && (x1+1 >= r->x0) && (y0 <= r->y1+1) && (y1+1 >= r->y0))
+			break;
+	}
+	if(i == ssd1306_nrects)
+	{
+		if(ssd1306_nrects < SSD1306_MAX_RECTS)
+		{
+			/* new rectangle */
+			r = &ssd1306_rects[ssd1306_nrects++];
+			r->x0 = x0;
+			r->y0 = y0;
+			r->x1 = x1;
+			r->y1 = y1;
+			return;
+		}
+		/* no room, join with the last one */
+		r = &ssd1306_rects[ssd1306_nrects-1];
+	}
+	if(x0 < r->x0) r->x0 = x0;
+	if(y0 < r->y0) r->y0 = y0;
+	if(x1 > r->x1) r->x1 = x1;
+	if(y1 > r->y1) r->y1 = y1;
+}
+
+/*
+ * mark the area of a layer to be redrawn
+ */
+void ssd1306_layer_dirty(ssd1306_layer_t *l)
+{
+	if(l->visible)
+		ssd1306_layers_invalidate(l->x, l->y, l->x + l->sprite->w - 1, l->y + l->sprite->h - 1);
+}
+
+/*
+ * add a layer, returns NULL if there is no room
+ */
+ssd1306_layer_t *ssd1306_layer_add(const ssd1306_sprite_t *spr, int16_t x, int16_t y, uint8_t mode, uint8_t z)
+{
+	ssd1306_layer_t *l = 0;
+	uint8_t i, n;
+
+	for(i=0;i<SSD1306_MAX_LAYERS;i++)
+		if(!ssd1306_layers[i].used)
+		{
+			l = &ssd1306_layers[i];
+			break;
+		}
+	if(!l)
+		return 0;
+
+	l->sprite = spr;
+	l->x = x;
+	l->y = y;
+	l->mode = mode;
+	l->z = z;
+	l->visible = 1;
+	l->used = 1;
+
+	/* insert in z order, after the layers with the same z */
+	for(n=ssd1306_nlayers;n && (ssd1306_layers[ssd1306_layer_order[n-1]].z > z);n--)
+		ssd1306_layer_order[n] = ssd1306_layer_order[n-1];
+	ssd1306_layer_order[n] = i;
+	ssd1306_nlayers++;
+
+	ssd1306_layer_dirty(l);
+	return l;
+}
+
+/*
+ * remove a layer
+ */
+void ssd1306_layer_remove(ssd1306_layer_t *l)
+{
+	uint8_t i, n = l - ssd1306_layers;
+
+	ssd1306_layer_dirty(l);
+	l->used = 0;
+	for(i=0;ssd1306_layer_order[i]!=n;i++);
+	for(;i+1<ssd1306_nlayers;i++)
+		ssd1306_layer_order[i] = ssd1306_layer_order[i+1];
+	ssd1306_nlayers--;
+}
+
+/*
+ * move a layer
+ */
+void ssd1306_layer_move(ssd1306_layer_t *l, int16_t x, int16_t y)
+{
+	if((x == l->x) && (y == l->y))
+		return;
+	ssd1306_layer_dirty(l);
+	l->x = x;
+	l->y = y;
+	ssd1306_layer_dirty(l);
+}
+
+/*
+ * change the sprite of a layer (next animation frame)
+ */
+void ssd1306_layer_sprite(ssd1306_layer_t *l, const ssd1306_sprite_t *spr)
+{
+	if(spr == l->sprite)
+		return;
+	ssd1306_layer_dirty(l);
+	l->sprite = spr;
+	ssd1306_layer_dirty(l);
+}
+
+/*
+ * show or hide a layer
+ */
+void ssd1306_layer_show(ssd1306_layer_t *l, uint8_t visible)
+{
+	if(visible == l->visible)
+		return;
+	l->visible = 1;
+	ssd1306_layer_dirty(l);
+	l->visible = visible;
+}
+
+/*
+ * redraw the marked rectangles: background, then the layers in z order
+ */
+void ssd1306_layers_compose(void)
+{
+	ssd1306_rect_t *r;
+	ssd1306_layer_t *l;
+	uint8_t i, j;
+
+	for(i=0;i<ssd1306_nrects;i++)
+	{
+		r = &ssd1306_rects[i];
+		if(ssd1306_layer_bg)
+			ssd1306_layer_bg(r->x0, r->y0, r->x1, r->y1);
+		else
+			ssd1306_spanrect(r->x0, r->x1, r->y0, r->y1, SSD1306_OP_CLEAR);
+
+		ssd1306_clip_x0 = r->x0;
+		ssd1306_clip_y0 = r->y0;
+		ssd1306_clip_x1 = r->x1;
+		ssd1306_clip_y1 = r->y1;
+		for(j=0;j<ssd1306_nlayers;j++)
+		{
+			l = &ssd1306_layers[ssd1306_layer_order[j]];
+			if(l->visible)
+				ssd1306_sprite_draw(l->sprite, l->x, l->y, l->mode);
+		}
+	}
+
+	ssd1306_clip_x0 = 0;
+	ssd1306_clip_y0 = 0;
+	ssd1306_clip_x1 = SSD1306_W-1;
+	ssd1306_clip_y1 = SSD1306_H-1;
+	ssd1306_nrects = 0;
+}
+
+#endif
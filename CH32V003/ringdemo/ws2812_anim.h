@@ -0,0 +1,191 @@
+/*
+ * Single-File-Header for LED animations in fixed point
+ * Must be included after ws2812_fb.h
+ *
+ * An animation is a list of layers. Each layer is a spot of light on the
+ * ring: its center, width, color and level follow tracks of keyframes.
+ * Values are Q8.8 fixed point (ANIM_ONE = 1.0 = 256): positions and widths
+ * in LEDs, so a spot moves smoothly between two LEDs, colors as an index in
+ * the palette of the layer, blended between its entries, and levels from 0
+ * to ANIM_ONE. Between two keys the value follows the easing curve of the
+ * first one. Tracks loop over the time of their last key.
+ *
+ * anim_render(layers, n, frame) clears ws2812_fb and adds the layers, each
+ * channel saturating at 255. Time is counted in frames: the application
+ * calls it at a fixed rate (ringdemo counts the frames in the SysTick IRQ)
+ * and sends the framebuffer with ws2812_fb_show(). Positions in Q8.8 limit
+ * the ring to 127 LEDs.
+ *
+ * Layers, tracks and palettes are const and stay in flash, the only RAM
+ * used is the stack of anim_render. The CH32V003 multiplies and divides in
+ * software, so everything stays in 32 bits: a division per track and layer,
+ * then three multiplications for each LED that a layer lights.
+ */
+
+#ifndef _WS2812_ANIM_H
+#define _WS2812_ANIM_H
+
+#include <stdint.h>
+#include <string.h>
+
+// Q8.8 fixed point
+typedef int16_t anim_q8_t;
+#define ANIM_ONE 256
+#define ANIM_Q8(x) ((anim_q8_t)((x)*ANIM_ONE))
+
+// easing from a key to the next
+#define ANIM_LINEAR 0
+#define ANIM_IN 1			// starts slow
+#define ANIM_OUT 2			// ends slow
+#define ANIM_INOUT 3		// starts and ends slow
+#define ANIM_STEP 4			// keeps the value until the next key
+
+typedef struct {
+	uint16_t t;				// frame, the first key is at 0
+	anim_q8_t v;
+	uint8_t ease;
+} anim_key_t;
+
+typedef struct {
+	const anim_key_t *key;
+	uint8_t n;
+} anim_track_t;
+
+// a track from an array of keys
+#define ANIM_TRACK(k) { (k), sizeof(k)/sizeof((k)[0]) }
+
+typedef struct {
+	anim_track_t pos;		// center, in LEDs from LED 0
+	anim_track_t width;		// LEDs from the center to where it is dark
+	anim_track_t color;		// index in the palette
+	anim_track_t level;		// 0 to ANIM_ONE
+	const uint32_t *pal;	// colors, 0xRRGGBB, the last blends into the first
+	uint8_t pal_n;
+} anim_layer_t;
+
+/*
+ * easing curve, u and result from 0 to ANIM_EASE_ONE
+ * (finer than Q8.8, a track can go over many LEDs between two keys)
+ */
+#define ANIM_EASE_ONE 4096
+
+uint16_t anim_ease(uint8_t ease, uint16_t u)
+{
+	uint32_t v;
+
+	switch(ease)
+	{
+	case ANIM_IN:
+		return ((uint32_t)u*u + ANIM_EASE_ONE/2) >> 12;
+	case ANIM_OUT:
+		v = ANIM_EASE_ONE - u;
+		return ANIM_EASE_ONE - ((v*v + ANIM_EASE_ONE/2) >> 12);
+	case ANIM_INOUT:
+		// smoothstep, 3u^2 - 2u^3, u^2 in 1/65536 to keep the precision
+		v = ((uint32_t)u*u + 128) >> 8;
+		return (v*(3*ANIM_EASE_ONE - 2*u) + 32768) >> 16;
+	case ANIM_STEP:
+		return 0;
+	}
+	return u;
+}
+
+/*
+ * value of a track at a frame
+ */
+anim_q8_t anim_track(const anim_track_t *tr, uint32_t frame)
+{
+	const anim_key_t *k = tr->key;
+	uint16_t end = k[tr->n-1].t;
+	uint16_t t, u, span;
+
+	if(end == 0)
+		return k[0].v;
+	t = frame % end;
+	while(k[1].t <= t)
+		k++;
+	span = k[1].t - k[0].t;
+	u = (((uint32_t)(t - k[0].t) << 12) + span/2) / span;
+	return k[0].v + (((int32_t)(k[1].v - k[0].v) * anim_ease(k[0].ease, u) + ANIM_EASE_ONE/2) >> 12);
+}
+
+/*
+ * color at an index of a palette, blended between two entries
+ */
+uint32_t anim_palette(const uint32_t *pal, uint8_t n, anim_q8_t idx)
+{
+	int32_t x = idx % (n*ANIM_ONE);
+	uint32_t c0, c1, rgb = 0;
+	uint8_t f;
+
+	if(x < 0)
+		x += n*ANIM_ONE;
+	c0 = pal[x >> 8];
+	c1 = pal[((x >> 8) + 1) % n];
+	f = x;
+	for(uint8_t s=0;s<24;s+=8)
+	{
+		int16_t a = (c0 >> s) & 0xFF, b = (c1 >> s) & 0xFF;
+		rgb |= (uint32_t)(a + (((b - a)*f + 128) >> 8)) << s;
+	}
+	return rgb;
+}
+
+/*
+ * add a layer to the framebuffer
+ * the light falls linearly from the center to the width,
+ * levels over ANIM_ONE are taken as ANIM_ONE
+ */
+void anim_add_layer(const anim_layer_t *l, uint32_t frame)
+{
+	int32_t ring = WS2812_FB_LEDS*ANIM_ONE;
+	int32_t pos = anim_track(&l->pos, frame) % ring;
+	int32_t w = anim_track(&l->width, frame);
+	int32_t level = anim_track(&l->level, frame);
+	uint32_t rgb;
+	uint8_t grb[3], *p;
+	int32_t d, a, inv;
+
+	if((level <= 0) || (w <= 0))
+		return;
+	if(level > ANIM_ONE)
+		level = ANIM_ONE;
+	if(pos < 0)
+		pos += ring;
+	rgb = anim_palette(l->pal, l->pal_n, anim_track(&l->color, frame));
+	grb[0] = rgb >> 8;
+	grb[1] = rgb >> 16;
+	grb[2] = rgb;
+	// level / width in 1/65536, a LED gets (w - d) * inv / 65536,
+	// at most level * 65536 as d >= 0
+	inv = (level << 16) / w;
+
+	p = ws2812_fb;
+	for(d=-pos;d<ring-pos;d+=ANIM_ONE,p+=3)
+	{
+		// distance around the ring
+		a = d < 0 ? -d : d;
+		if(a > ring/2)
+			a = ring - a;
+		if(a >= w)
+			continue;
+		a = ((w - a) * inv) >> 16;
+		for(uint8_t c=0;c<3;c++)
+		{
+			uint16_t v = p[c] + ((grb[c] * a + 128) >> 8);
+			p[c] = v > 255 ? 255 : v;
+		}
+	}
+}
+
+/*
+ * draw a frame of the layers in ws2812_fb
+ */
+void anim_render(const anim_layer_t *layers, uint8_t n, uint32_t frame)
+{
+	memset(ws2812_fb, 0, sizeof(ws2812_fb));
+	while(n--)
+		anim_add_layer(layers++, frame);
+}
+
+#endif
@@ -0,0 +1,248 @@
+/*
+ * Single-File-Header for WS2812 LEDs driven from a framebuffer
+ *
+ * The application writes the colors in ws2812_fb (3 bytes per LED, in
+ * the order they are sent: GRB) and calls ws2812_fb_show(). SPI1 sends
+ * the bits on PC6 (MOSI), 4 SPI bits per LED bit at 3 MHz: 1000 for a 0
+ * and 1110 for a 1. DMA1 channel 3 loops over a small buffer of two
+ * halves; when a half has been sent (half transfer and transfer complete
+ * IRQs) it is refilled with the next WS2812_FB_CHUNK LEDs, encoded a
+ * nybble at a time from a table. After the last LED the buffer is filled
+ * with zeros until the line has been low for WS2812_FB_RESET_US.
+ *
+ * With WS2812_FB_LUT each byte goes through a table when it is encoded:
+ * ws2812_fb_brightness(b) scales it, after a 2.2 gamma curve if
+ * WS2812_FB_GAMMA is also defined (256 bytes of RAM, 256 of flash).
+ *
+ * Define WS2812_FB_HOST to leave out the hardware and drive the encoder
+ * with ws2812_fb_begin() and ws2812_fb_fill() (see ws2812sim.c).
+ */
+
+#ifndef _WS2812_FB_H
+#define _WS2812_FB_H
+
+#include <stdint.h>
+#include <string.h>
+
+// number of LEDs
+#ifndef WS2812_FB_LEDS
+#define WS2812_FB_LEDS 12
+#endif
+
+// LEDs encoded in each half of the DMA buffer
+#ifndef WS2812_FB_CHUNK
+#define WS2812_FB_CHUNK 4
+#endif
+
+// low time that ends a frame (WS2812B need 280 us, older WS2812 50 us)
+#ifndef WS2812_FB_RESET_US
+#define WS2812_FB_RESET_US 300
+#endif
+
+// 16-bit SPI words in a half of the DMA buffer, 2 per byte
+#define WS2812_FB_HALF (WS2812_FB_CHUNK*6)
+
+// halves of zeros for the reset, 16 bits at 3 MHz per word
+#define WS2812_FB_RESET_HALVES ((WS2812_FB_RESET_US*3 + WS2812_FB_HALF*16 - 1)/(WS2812_FB_HALF*16))
+
+// the colors, GRB
+uint8_t ws2812_fb[WS2812_FB_LEDS*3];
+
+// SPI words for a nybble, MSB first
+const uint16_t ws2812_fb_bits[16] =
+{
+	0x8888, 0x888E, 0x88E8, 0x88EE, 0x8E88, 0x8E8E, 0x8EE8, 0x8EEE,
+	0xE888, 0xE88E, 0xE8E8, 0xE8EE, 0xEE88, 0xEE8E, 0xEEE8, 0xEEEE,
+};
+
+// DMA buffer and encoder state
+uint16_t ws2812_fb_dma[2*WS2812_FB_HALF];
+uint8_t ws2812_fb_pos;				// next LED to encode
+uint8_t ws2812_fb_zero[2];			// the half has only zeros
+uint8_t ws2812_fb_zeros;			// halves of zeros sent
+volatile uint8_t ws2812_fb_active;
+
+#ifdef WS2812_FB_LUT
+uint8_t ws2812_fb_lut[256];
+#define WS2812_FB_MAP(v) ws2812_fb_lut[v]
+
+#ifdef WS2812_FB_GAMMA
+// 255*(i/255)^2.2
+const uint8_t ws2812_fb_gamma[256] =
+{
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,
+	  1,   1,   1,   1,   1,   1,   1,   1,   1,   2,   2,   2,   2,   2,   2,   2,
+	  3,   3,   3,   3,   3,   4,   4,   4,   4,   5,   5,   5,   5,   6,   6,   6,
+	  6,   7,   7,   7,   8,   8,   8,   9,   9,   9,  10,  10,  11,  11,  11,  12,
+	 12,  13,  13,  13,  14,  14,  15,  15,  16,  16,  17,  17,  18,  18,  19,  19,
+	 20,  20,  21,  22,  22,  23,  23,  24,  25,  25,  26,  26,  27,  28,  28,  29,
+	 30,  30,  31,  32,  33,  33,  34,  35,  35,  36,  37,  38,  39,  39,  40,  41,
+	 42,  43,  43,  44,  45,  46,  47,  48,  49,  49,  50,  51,  52,  53,  54,  55,
+	 56,  57,  58,  59,  60,  61,  62,  63,  64,  65,  66,  67,  68,  69,  70,  71,
+	 73,  74,  75,  76,  77,  78,  79,  81,  82,  83,  84,  85,  87,  88,  89,  90,
+	 91,  93,  94,  95,  97,  98,  99, 100, 102, 103, 105, 106, 107, 109, 110, 111,
+	113, 114, 116, 117, 119, 120, 121, 123, 124, 126, 127, 129, 130, 132, 133, 135,
+	137, 138, 140, 141, 143, 145, 146, 148, 149, 151, 153, 154, 156, 158, 159, 161,
+	163, 165, 166, 168, 170, 172, 173, 175, 177, 179, 181, 182, 184, 186, 188, 190,
+	192, 194, 196, 197, 199, 201, 203, 205, 207, 209, 211, 213, 215, 217, 219, 221,
+	223, 225, 227, 229, 231, 234, 236, 238, 240, 242, 244, 246, 248, 251, 253, 255,
+};
+#endif
+
+/*
+ * set the brightness (0 to 255) applied when encoding
+ * don't call while a frame is being sent
+ */
+void ws2812_fb_brightness(uint8_t b)
+{
+	for(uint16_t i=0;i<256;i++)
+	{
+#ifdef WS2812_FB_GAMMA
+		uint16_t v = ws2812_fb_gamma[i];
+#else
+		uint16_t v = i;
+#endif
+		ws2812_fb_lut[i] = (v*b + 127) / 255;
+	}
+}
+#else
+#define WS2812_FB_MAP(v) (v)
+#endif
+
+/*
+ * set LED n, colors in the usual 0xRRGGBB
+ */
+void ws2812_fb_set(uint8_t n, uint32_t rgb)
+{
+	uint8_t *p = &ws2812_fb[n*3];
+
+	p[0] = rgb >> 8;
+	p[1] = rgb >> 16;
+	p[2] = rgb;
+}
+
+/*
+ * encode the next LEDs in half h of the DMA buffer
+ * called when the half has been sent, returns 0 at the end of the reset
+ */
+uint8_t ws2812_fb_fill(uint8_t h)
+{
+	uint16_t *dst = &ws2812_fb_dma[h*WS2812_FB_HALF];
+	uint16_t *end = dst + WS2812_FB_HALF;
+	const uint8_t *src;
+	uint8_t n, v;
+
+	if(ws2812_fb_zero[h] && (++ws2812_fb_zeros >= WS2812_FB_RESET_HALVES))
+		return 0;
+	ws2812_fb_zero[h] = (ws2812_fb_pos == WS2812_FB_LEDS);
+
+	n = WS2812_FB_LEDS - ws2812_fb_pos;
+	if(n > WS2812_FB_CHUNK)
+		n = WS2812_FB_CHUNK;
+	src = &ws2812_fb[ws2812_fb_pos*3];
+	ws2812_fb_pos += n;
+	for(n*=3;n;n--)
+	{
+		v = WS2812_FB_MAP(*src++);
+		*dst++ = ws2812_fb_bits[v >> 4];
+		*dst++ = ws2812_fb_bits[v & 0x0F];
+	}
+	while(dst < end)
+		*dst++ = 0;
+	return 1;
+}
+
+/*
+ * encode the start of a frame in both halves
+ */
+void ws2812_fb_begin(void)
+{
+	ws2812_fb_pos = 0;
+	ws2812_fb_zeros = 0;
+	ws2812_fb_zero[0] = ws2812_fb_zero[1] = 0;
+	ws2812_fb_fill(0);
+	ws2812_fb_fill(1);
+}
+
+/*
+ * true while a frame is being sent
+ */
+uint8_t ws2812_fb_busy(void)
+{
+	return ws2812_fb_active;
+}
+
+#ifndef WS2812_FB_HOST
+/*
+ * SPI1 on PC6 and DMA1 channel 3
+ */
+void ws2812_fb_init(void)
+{
+	RCC->AHBPCENR |= RCC_AHBPeriph_DMA1;
+	RCC->APB2PCENR |= RCC_APB2Periph_GPIOC | RCC_APB2Periph_SPI1;
+
+	// PC6 is MOSI, 10MHz Output, alt func, push-pull
+	GPIOC->CFGLR &= ~(0xf<<(4*6));
+	GPIOC->CFGLR |= (GPIO_Speed_10MHz | GPIO_CNF_OUT_PP_AF)<<(4*6);
+
+	// 16 bit words, 48 MHz / 16 = 3 MHz, transmit only
+	SPI1->CTLR1 = SPI_NSS_Soft | SPI_CPHA_1Edge | SPI_CPOL_Low | SPI_DataSize_16b |
+		SPI_Mode_Master | SPI_Direction_1Line_Tx | (3<<3);
+	SPI1->CTLR2 = SPI_CTLR2_TXDMAEN;
+	SPI1->HSCR = 1;
+	SPI1->CTLR1 |= CTLR1_SPE_Set;
+	SPI1->DATAR = 0;
+
+	// DMA1 channel 3 is SPI1 TX, loops over the two halves
+	DMA1_Channel3->PADDR = (uint32_t)&SPI1->DATAR;
+	DMA1_Channel3->MADDR = (uint32_t)ws2812_fb_dma;
+	DMA1_Channel3->CFGR =
+		DMA_M2M_Disable |
+		DMA_Priority_VeryHigh |
+		DMA_MemoryDataSize_HalfWord |
+		DMA_PeripheralDataSize_HalfWord |
+		DMA_MemoryInc_Enable |
+		DMA_Mode_Circular |
+		DMA_DIR_PeripheralDST |
+		DMA_IT_TC | DMA_IT_HT;
+	NVIC_EnableIRQ(DMA1_Channel3_IRQn);
+
+#ifdef WS2812_FB_LUT
+	ws2812_fb_brightness(255);
+#endif
+}
+
+/*
+ * send the framebuffer, returns at once
+ * LEDs are encoded while they are sent: changes made before
+ * ws2812_fb_busy() returns 0 may show in this frame
+ */
+void ws2812_fb_show(void)
+{
+	while(ws2812_fb_active);
+	ws2812_fb_begin();
+	ws2812_fb_active = 1;
+	DMA1_Channel3->CNTR = 2*WS2812_FB_HALF;
+	DMA1_Channel3->CFGR |= DMA_CFGR1_EN;
+}
+
+/*
+ * IRQ handler for DMA half transfer and transfer complete
+ */
+void DMA1_Channel3_IRQHandler(void) __attribute__((interrupt));
+void DMA1_Channel3_IRQHandler(void)
+{
+	uint32_t intfr = DMA1->INTFR;
+
+	DMA1->INTFCR = DMA1_IT_GL3;
+	if(((intfr & DMA1_IT_HT3) && !ws2812_fb_fill(0)) ||
+	   ((intfr & DMA1_IT_TC3) && !ws2812_fb_fill(1)))
+	{
+		// the line has been low long enough
+		DMA1_Channel3->CFGR &= ~DMA_CFGR1_EN;
+		ws2812_fb_active = 0;
+	}
+}
+#endif
+
+#endif
@@ -0,0 +1,174 @@
+/*
+ * WS2812 encoder test - runs ws2812_fb.h on a PC
+ *
+ * Sends frames through the two-halves buffer as the circular DMA does,
+ * decodes the SPI bitstream back into LED bits and checks it against the
+ * framebuffer, the lookup table and the reset time.
+ *
+ * Build:   gcc -O2 -o ws2812sim ws2812sim.c -lm
+ *          (add -DWS2812_FB_LEDS=n, -DWS2812_FB_CHUNK=n, -DWS2812_FB_LUT
+ *          and -DWS2812_FB_GAMMA to test other settings)
+ * Use:     ./ws2812sim
+ */
+
+#define WS2812_FB_HOST
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "ws2812_fb.h"
+
+// SPI bits of a frame, one per byte
+#define MAXBITS (WS2812_FB_LEDS*24*4 + (WS2812_FB_RESET_HALVES+2)*WS2812_FB_HALF*16)
+uint8_t bits[MAXBITS];
+uint32_t nbits;
+uint32_t refills;
+
+/*
+ * the DMA sends half h
+ */
+void send_half(uint8_t h)
+{
+	for(int i=0;i<WS2812_FB_HALF;i++)
+	{
+		uint16_t w = ws2812_fb_dma[h*WS2812_FB_HALF + i];
+		for(int b=15;b>=0;b--)
+			bits[nbits++] = (w >> b) & 1;
+	}
+}
+
+/*
+ * a whole frame: the halves go out in turn and are refilled after
+ * being sent, until the encoder stops the DMA
+ */
+int send_frame(void)
+{
+	uint8_t h = 0;
+
+	nbits = 0;
+	refills = 0;
+	ws2812_fb_begin();
+	for(;;)
+	{
+		send_half(h);
+		refills++;
+		if(!ws2812_fb_fill(h))
+			break;
+		if(nbits + WS2812_FB_HALF*16 > MAXBITS)
+		{
+			printf("the frame doesn't end\n");
+			return 1;
+		}
+		h ^= 1;
+	}
+	// the DMA is stopped while sending the other half, it must be low
+	for(int i=0;i<WS2812_FB_HALF;i++)
+		if(ws2812_fb_dma[(h^1)*WS2812_FB_HALF + i])
+		{
+			printf("stopped while sending data\n");
+			return 1;
+		}
+	return 0;
+}
+
+/*
+ * expected value of a byte, computed without the tables
+ */
+uint8_t expected(uint8_t v, uint8_t bright)
+{
+#ifdef WS2812_FB_LUT
+	double g = v;
+#ifdef WS2812_FB_GAMMA
+	g = round(255.0 * pow(v / 255.0, 2.2));
+#endif
+	return (uint8_t)(((int)g * bright + 127) / 255);
+#else
+	(void)bright;
+	return v;
+#endif
+}
+
+/*
+ * decode the bitstream and compare with the framebuffer
+ */
+int check_frame(uint8_t bright)
+{
+	uint32_t p = 0, low;
+	int errors = 0;
+
+	for(int n=0;n<WS2812_FB_LEDS*3;n++)
+	{
+		uint8_t v = 0;
+		for(int b=0;b<8;b++,p+=4)
+		{
+			uint8_t q = (bits[p]<<3) | (bits[p+1]<<2) | (bits[p+2]<<1) | bits[p+3];
+			if((q != 0x8) && (q != 0xE))
+			{
+				printf("LED %d byte %d bit %d: bad pattern %X\n", n/3, n%3, b, q);
+				return 1;
+			}
+			v = (v << 1) | (q == 0xE);
+		}
+		if(v != expected(ws2812_fb[n], bright))
+		{
+			printf("LED %d byte %d: sent %02X, expected %02X\n", n/3, n%3, v,
+				expected(ws2812_fb[n], bright));
+			errors++;
+		}
+	}
+
+	// then only zeros, long enough for the reset
+	for(low=0;p<nbits;p++,low++)
+		if(bits[p])
+		{
+			printf("data after the last LED\n");
+			return errors + 1;
+		}
+	if(low < WS2812_FB_RESET_US*3)
+	{
+		printf("reset too short: %u us\n", low/3);
+		errors++;
+	}
+	return errors;
+}
+
+int main(void)
+{
+	int errors = 0;
+	uint8_t bright[] = { 255, 128, 7 };
+
+	srand(1);
+	for(unsigned k=0;k<sizeof(bright);k++)
+	{
+#ifdef WS2812_FB_LUT
+		ws2812_fb_brightness(bright[k]);
+#else
+		if(bright[k] != 255)
+			continue;
+#endif
+		for(int f=0;f<20;f++)
+		{
+			// all zeros, all ones, then random colors
+			for(int i=0;i<WS2812_FB_LEDS*3;i++)
+				ws2812_fb[i] = f == 0 ? 0 : f == 1 ? 0xFF : rand();
+			if(send_frame())
+				return 1;
+			errors += check_frame(bright[k]);
+		}
+		printf("brightness %3u: %d LEDs, %u SPI bits (%u us), %u refills of %d LEDs, reset %u us\n",
+			bright[k], WS2812_FB_LEDS, nbits, nbits/3, refills, WS2812_FB_CHUNK,
+			(nbits - WS2812_FB_LEDS*96)/3);
+	}
+
+	// ws2812_fb_set packs 0xRRGGBB as GRB
+	ws2812_fb_set(0, 0x123456);
+	if((ws2812_fb[0] != 0x34) || (ws2812_fb[1] != 0x12) || (ws2812_fb[2] != 0x56))
+	{
+		printf("ws2812_fb_set: wrong order\n");
+		errors++;
+	}
+
+	printf(errors ? "%d errors\n" : "ok\n", errors);
+	return errors ? 1 : 0;
+}
@@ -7,6 +7,8 @@
 #include <Adafruit_ST7789.h> // Hardware-specific library for ST7789
 #include <SPI.h>
 #include <FastLED.h>
+#include "font_title.h"
+#include "pfont_aa.h"
 
 #define TFT_CS        14
 #define TFT_RST       21
@@ -23,6 +25,17 @@ uint16_t bordas[] = { cor565(2,48,2), cor565(2,4,24), cor565(24,0,0) };
 
 Adafruit_ST7789 tft = Adafruit_ST7789(TFT_CS, TFT_DC, TFT_RST);
 
+// Texto com anti-aliasing
+void tft_window(int16_t x, int16_t y, int16_t w, int16_t h) {
+  tft.setAddrWindow(x, y, w, h);
+}
+
+void tft_run(uint16_t cor, uint16_t n) {
+  tft.writeColor(cor, n);
+}
+
+const pfont_aa_sink_t tela = { 320, 172, tft_window, tft_run };
+
 // RGB LED
 #define NUM_LEDS 1
 #define RGB_PIN 8
@@ -54,13 +67,11 @@ void setup() {
   }
 
   tft.fillRect(75, 60, 164, 48, FUNDO);
-  tft.setTextSize(4);
-  tft.setTextColor(ST77XX_BLACK);
-  tft.setCursor (84, 72);
-  tft.print("DQSoft");
-  tft.setTextColor(TEXTO);
-  tft.setCursor (86, 70);
-  tft.print("DQSoft");
+  const char *titulo = "DQSoft";
+  tft.startWrite();
+  pfont_aa_drawstr(&tela, &font_title, 75 + (164 - pfont_width(&font_title, titulo))/2,
+                   68, titulo, TEXTO, FUNDO);
+  tft.endWrite();
 }
 
 void loop() {
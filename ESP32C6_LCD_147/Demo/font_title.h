@@ -0,0 +1,179 @@
+/*
+ * font_title: 7 proportional glyphs 32 pixels high, 4 bpp
+ * from ../fonts/font_12x16.h (scale 2)
+ * generated by CH32V003/fonts/pfontc.py, do not edit
+ */
+
+#ifndef _FONT_TITLE_H
+#define _FONT_TITLE_H
+
+#ifndef _PFONT_TYPES
+#define _PFONT_TYPES
+
+#include <stdint.h>
+#include <stddef.h>
+
+typedef struct {
+	uint16_t offset;		// first byte in the data
+	uint8_t width;			// columns in the data
+	uint8_t advance;		// where the next glyph starts
+} pfont_glyph_t;
+
+typedef struct {
+	uint8_t left, right;	// glyphs, sorted by left and then right
+	int8_t dx;				// added to the advance of left
+} pfont_kern_t;
+
+typedef struct {
+	uint8_t height;			// rows in each glyph
+	uint8_t bpp;			// 1: pages of column bytes, 4: runs of level<<4 | (n-1)
+	uint8_t first, last;	// character codes
+	const uint8_t *map;		// glyph of each code from first, NULL if in order
+	const pfont_glyph_t *glyphs;
+	const pfont_kern_t *kern;
+	uint16_t nkern;
+	const uint8_t *data;
+} pfont_t;
+
+/*
+ * glyph for a character, characters not in the font use the space (0)
+ */
+static inline uint8_t pfont_glyph(const pfont_t *font, uint8_t c)
+{
+	if((c < font->first) || (c > font->last))
+		return 0;
+	return font->map ? font->map[c - font->first] : c - font->first;
+}
+
+/*
+ * kerning between two glyphs (binary search)
+ */
+static inline int8_t pfont_kern(const pfont_t *font, uint8_t left, uint8_t right)
+{
+	uint16_t lo = 0, hi = font->nkern;
+	uint16_t key = (left << 8) | right;
+
+	while(lo < hi)
+	{
+		uint16_t mid = (lo + hi) >> 1;
+		const pfont_kern_t *k = &font->kern[mid];
+		uint16_t v = (k->left << 8) | k->right;
+		if(v == key)
+			return k->dx;
+		if(v < key)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+	return 0;
+}
+
+/*
+ * width in pixels of a string, from the first to the last column drawn
+ */
+static inline int16_t pfont_width(const pfont_t *font, const char *str)
+{
+	int16_t w = 0;
+	uint8_t g, prev = 0xFF;
+
+	while(*str)
+	{
+		g = pfont_glyph(font, *str++);
+		if(prev != 0xFF)
+			w += font->glyphs[prev].advance + pfont_kern(font, prev, g);
+		prev = g;
+	}
+	if(prev != 0xFF)
+		w += font->glyphs[prev].width;
+	return w;
+}
+
+#endif
+
+// glyph for each character code
+const uint8_t font_title_map[] = {
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x02, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
+	0x00, 0x00, 0x00, 0x00, 0x06,
+};
+
+const uint8_t font_title_data[] = {
+	/* 0 ' ' */
+	/* 1 'D' */
+	0x30, 0xB0, 0xF9, 0xB0, 0x40, 0x05, 0xB0, 0xFC, 0xA0, 0x04, 0xFE, 0x50, 0x03, 0xFF, 0xA0, 0x02,
+	0xF3, 0xC0, 0x40, 0x03, 0x40, 0xB0, 0xF4, 0x40, 0x01, 0xF3, 0x40, 0x06, 0x50, 0xF3, 0xB0, 0x01,
+	0xF3, 0x08, 0xA0, 0xF3, 0x40, 0x00, 0xF3, 0x09, 0x50, 0xF2, 0xB0, 0x00, 0xF3, 0x0A, 0xB0, 0xF2,
+	0x40, 0xF3, 0x0A, 0x40, 0xF2, 0xB0, 0xF3, 0x0B, 0xF7, 0x0B, 0xF7, 0x0B, 0xF7, 0x0B, 0xF7, 0x0B,
+	0xF7, 0x0B, 0xF7, 0x0B, 0xF7, 0x0B, 0xF7, 0x0A, 0x40, 0xF2, 0xB0, 0xF3, 0x0A, 0xB0, 0xF2, 0x40,
+	0xF3, 0x09, 0x50, 0xF2, 0xB0, 0x00, 0xF3, 0x08, 0xA0, 0xF3, 0x40, 0x00, 0xF3, 0x40, 0x06, 0x50,
+	0xF3, 0xB0, 0x01, 0xF3, 0xC0, 0x40, 0x03, 0x40, 0xB0, 0xF4, 0x40, 0x01, 0xFF, 0xA0, 0x02, 0xFE,
+	0x50, 0x03, 0xB0, 0xFC, 0xA0, 0x04, 0x30, 0xB0, 0xF9, 0xB0, 0x40, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+	0x05,
+	/* 2 'Q' */
+	0x05, 0x40, 0xB0, 0xF3, 0xB0, 0x40, 0x0A, 0xA0, 0xF7, 0xA0, 0x08, 0x50, 0xF9, 0x50, 0x06, 0xA0,
+	0xFB, 0xA0, 0x04, 0x40, 0xF4, 0xB0, 0x41, 0xB0, 0xF4, 0x40, 0x03, 0xB0, 0xF3, 0x50, 0x03, 0x50,
+	0xF3, 0xB0, 0x02, 0x40, 0xF3, 0xA0, 0x05, 0xA0, 0xF3, 0x40, 0x01, 0xB0, 0xF2, 0x50, 0x07, 0x50,
+	0xF2, 0xB0, 0x00, 0x40, 0xF2, 0xB0, 0x09, 0xB0, 0xF2, 0x40, 0xB0, 0xF2, 0x40, 0x09, 0x40, 0xF2,
+	0xB0, 0xF3, 0x0B, 0xF7, 0x0B, 0xF7, 0x0B, 0xF7, 0x0B, 0xF7, 0x0B, 0xF7, 0x0B, 0xF7, 0x0B, 0xF7,
+	0x0B, 0xF3, 0xB0, 0xF2, 0x40, 0x04, 0x30, 0xB1, 0x30, 0x01, 0xF2, 0xB0, 0x40, 0xF2, 0xB0, 0x04,
+	0xB0, 0xF1, 0xC0, 0x40, 0x50, 0xF2, 0x40, 0x00, 0xB0, 0xF2, 0x50, 0x03, 0xB0, 0xF6, 0xB0, 0x01,
+	0x40, 0xF3, 0xA0, 0x02, 0x30, 0xC0, 0xF5, 0x40, 0x02, 0xB0, 0xF3, 0x50, 0x02, 0x40, 0xF5, 0x40,
+	0x02, 0x40, 0xF4, 0xB0, 0x40, 0x00, 0x50, 0xF5, 0xB0, 0x03, 0xA0, 0xFE, 0x40, 0x03, 0x50, 0xFD,
+	0xB0, 0x04, 0xA0, 0xF6, 0xC0, 0x41, 0xC0, 0xF1, 0xB0, 0x05, 0x40, 0xB0, 0xF3, 0xB0, 0x30, 0x01,
+	0x30, 0xB1, 0x30, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+	/* 3 'S' */
+	0x03, 0x40, 0xB0, 0xF7, 0xB0, 0x40, 0x06, 0xA0, 0xFB, 0xA0, 0x04, 0x50, 0xFD, 0x50, 0x02, 0xA0,
+	0xFF, 0xA0, 0x00, 0x40, 0xF4, 0xB0, 0x40, 0x03, 0x40, 0xB0, 0xF4, 0x40, 0xB0, 0xF3, 0x50, 0x07,
+	0x50, 0xF3, 0xB0, 0xF3, 0xB0, 0x09, 0xA0, 0xF2, 0xB0, 0xF3, 0x40, 0x0A, 0x40, 0xB1, 0x30, 0xF3,
+	0x40, 0x0E, 0xF3, 0xB0, 0x0E, 0xB0, 0xF3, 0x50, 0x0D, 0x40, 0xF4, 0xB0, 0x40, 0x0C, 0xA0, 0xFB,
+	0xB0, 0x40, 0x05, 0x50, 0xFC, 0xA0, 0x05, 0xA0, 0xFC, 0x50, 0x05, 0x40, 0xB0, 0xFB, 0xA0, 0x0C,
+	0x40, 0xB0, 0xF4, 0x40, 0x0D, 0x50, 0xF3, 0xB0, 0x0E, 0xB0, 0xF3, 0x0E, 0x40, 0xF3, 0x30, 0xB1,
+	0x40, 0x0A, 0x40, 0xF3, 0xB0, 0xF2, 0xA0, 0x09, 0xB0, 0xF3, 0xB0, 0xF3, 0x50, 0x07, 0x50, 0xF3,
+	0xB0, 0x40, 0xF4, 0xB0, 0x40, 0x03, 0x40, 0xB0, 0xF4, 0x40, 0x00, 0xA0, 0xFF, 0xA0, 0x02, 0x50,
+	0xFD, 0x50, 0x04, 0xA0, 0xFB, 0xA0, 0x06, 0x40, 0xB0, 0xF7, 0xB0, 0x40, 0x0F, 0x0F, 0x0F, 0x0F,
+	0x0F, 0x03,
+	/* 4 'f' */
+	0x07, 0x40, 0xB0, 0xF3, 0xB0, 0x30, 0x06, 0xA0, 0xF6, 0xB0, 0x05, 0x50, 0xF7, 0xB0, 0x04, 0xA0,
+	0xF7, 0xB0, 0x30, 0x03, 0x40, 0xF4, 0xB0, 0x40, 0x07, 0xB0, 0xF3, 0x50, 0x09, 0xF3, 0xB0, 0x0A,
+	0xF3, 0x40, 0x0A, 0xF3, 0x0B, 0xF3, 0x0A, 0x40, 0xF3, 0x40, 0x08, 0x40, 0xC0, 0xF3, 0xC0, 0x40,
+	0x05, 0x30, 0xB0, 0xF9, 0xB0, 0x30, 0x01, 0xB0, 0xFB, 0xB0, 0x01, 0xB0, 0xFB, 0xB0, 0x01, 0x30,
+	0xB0, 0xF9, 0xB0, 0x30, 0x03, 0x40, 0xC0, 0xF3, 0xC0, 0x40, 0x08, 0x40, 0xF3, 0x40, 0x0A, 0xF3,
+	0x0B, 0xF3, 0x0B, 0xF3, 0x0B, 0xF3, 0x0B, 0xF3, 0x0B, 0xF3, 0x0B, 0xF3, 0x0B, 0xF3, 0x0B, 0xB0,
+	0xF1, 0xB0, 0x0B, 0x30, 0xB1, 0x30, 0x0F, 0x0F, 0x0F, 0x0F, 0x07,
+	/* 5 'o' */
+	0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0B, 0x40, 0xB0, 0xF7,
+	0xB0, 0x40, 0x06, 0xA0, 0xFB, 0xA0, 0x04, 0x50, 0xFD, 0x50, 0x02, 0xA0, 0xFF, 0xA0, 0x00, 0x40,
+	0xF4, 0xB0, 0x40, 0x03, 0x40, 0xB0, 0xF4, 0x40, 0xB0, 0xF3, 0x50, 0x07, 0x50, 0xF3, 0xB0, 0xF3,
+	0xB0, 0x09, 0xB0, 0xF7, 0x40, 0x09, 0x40, 0xF7, 0x0B, 0xF7, 0x0B, 0xF7, 0x40, 0x09, 0x40, 0xF7,
+	0xB0, 0x09, 0xB0, 0xF3, 0xB0, 0xF3, 0x50, 0x07, 0x50, 0xF3, 0xB0, 0x40, 0xF4, 0xB0, 0x40, 0x03,
+	0x40, 0xB0, 0xF4, 0x40, 0x00, 0xA0, 0xFF, 0xA0, 0x02, 0x50, 0xFD, 0x50, 0x04, 0xA0, 0xFB, 0xA0,
+	0x06, 0x40, 0xB0, 0xF7, 0xB0, 0x40, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x03,
+	/* 6 't' */
+	0x0F, 0x0F, 0x03, 0x30, 0xB1, 0x30, 0x0B, 0xB0, 0xF1, 0xB0, 0x0B, 0xF3, 0x0B, 0xF3, 0x0B, 0xF3,
+	0x0B, 0xF3, 0x0A, 0x40, 0xF3, 0x40, 0x08, 0x40, 0xC0, 0xF3, 0xC0, 0x40, 0x05, 0x30, 0xB0, 0xF9,
+	0xB0, 0x30, 0x01, 0xB0, 0xFB, 0xB0, 0x01, 0xB0, 0xFB, 0xB0, 0x01, 0x30, 0xB0, 0xF9, 0xB0, 0x30,
+	0x03, 0x40, 0xC0, 0xF3, 0xC0, 0x40, 0x08, 0x40, 0xF3, 0x40, 0x0A, 0xF3, 0x0B, 0xF3, 0x0B, 0xF3,
+	0x0B, 0xF3, 0x0B, 0xF3, 0x0B, 0xF3, 0x0B, 0xF3, 0x40, 0x0A, 0xF3, 0xC0, 0x40, 0x09, 0xB0, 0xF8,
+	0xB0, 0x30, 0x03, 0x40, 0xF9, 0xB0, 0x04, 0xA0, 0xF8, 0xB0, 0x05, 0x40, 0xB0, 0xF5, 0xB0, 0x30,
+	0x0F, 0x0F, 0x0F, 0x0F,
+};
+
+const pfont_glyph_t font_title_glyphs[] = {
+	{ 0, 0, 9 },	/* ' ' */
+	{ 0, 20, 22 },	/* 'D' */
+	{ 129, 20, 22 },	/* 'Q' */
+	{ 297, 20, 22 },	/* 'S' */
+	{ 443, 16, 18 },	/* 'f' */
+	{ 550, 20, 22 },	/* 'o' */
+	{ 658, 16, 18 },	/* 't' */
+};
+
+const pfont_t font_title = {
+	32, 4, 32, 116, font_title_map,
+	font_title_glyphs, NULL, 0, font_title_data
+};
+
+#endif
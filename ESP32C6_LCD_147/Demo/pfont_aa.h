@@ -0,0 +1,158 @@
+/*
+ * Texto proporcional com anti-aliasing para displays RGB565 (ST7789, ST7735)
+ *
+ * As fontes são geradas por CH32V003/fonts/pfontc.py --bpp 4: cada pixel
+ * tem 16 níveis de cobertura, guardados como sequências (nível, quantidade).
+ *
+ * O texto é desenhado sobre uma cor de fundo conhecida. A string inteira
+ * ocupa uma única janela no display; cada linha é montada num buffer de
+ * níveis e enviada como sequências de pixels da mesma cor, em vez de um
+ * pixel (ou um retângulo, com setTextSize) por vez.
+ *
+ * O acesso ao display é feito pelas funções em pfont_aa_sink_t, por
+ * exemplo com a Adafruit_ST7789:
+ *   void janela(int16_t x, int16_t y, int16_t w, int16_t h) { tft.setAddrWindow(x, y, w, h); }
+ *   void pixels(uint16_t cor, uint16_t n) { tft.writeColor(cor, n); }
+ *   const pfont_aa_sink_t tela = { 320, 172, janela, pixels };
+ * e chamando pfont_aa_drawstr entre tft.startWrite() e tft.endWrite().
+ *
+ * Deve ser incluído depois dos arquivos das fontes.
+ *
+ * Mantenha iguais as cópias deste arquivo nos exemplos.
+ */
+
+#ifndef _PFONT_AA_H
+#define _PFONT_AA_H
+
+#include <stdint.h>
+#include <string.h>
+
+// Largura máxima de uma string, em pixels
+#ifndef PFONT_AA_MAX_W
+#define PFONT_AA_MAX_W 320
+#endif
+
+// Número máximo de caracteres numa string
+#ifndef PFONT_AA_MAX_CHARS
+#define PFONT_AA_MAX_CHARS 40
+#endif
+
+typedef struct {
+  int16_t width, height;    // tamanho da tela, o texto é recortado
+  void (*window)(int16_t x, int16_t y, int16_t w, int16_t h);
+  void (*run)(uint16_t color, uint16_t n);
+} pfont_aa_sink_t;
+
+// Mistura um componente de cor, a de 0 (só b) a 15 (só f)
+static inline int16_t pfont_aa_mix(int16_t f, int16_t b, uint8_t a) {
+  int16_t d = (f - b) * a;
+  return b + (d + (d < 0 ? -7 : 7)) / 15;
+}
+
+// Mistura duas cores RGB565
+static inline uint16_t pfont_aa_blend(uint16_t fg, uint16_t bg, uint8_t a) {
+  return (pfont_aa_mix(fg >> 11, bg >> 11, a) << 11) |
+         (pfont_aa_mix((fg >> 5) & 0x3F, (bg >> 5) & 0x3F, a) << 5) |
+         pfont_aa_mix(fg & 0x1F, bg & 0x1F, a);
+}
+
+// Desenha uma string com o canto superior esquerdo em x,y
+// Pinta o fundo até a posição do próximo caractere, que é retornada
+static int16_t pfont_aa_drawstr(const pfont_aa_sink_t *sink, const pfont_t *font,
+                                int16_t x, int16_t y, const char *str,
+                                uint16_t fg, uint16_t bg) {
+  static uint8_t line[PFONT_AA_MAX_W];
+  uint8_t g[PFONT_AA_MAX_CHARS];
+  int16_t gx[PFONT_AA_MAX_CHARS];
+  const uint8_t *src[PFONT_AA_MAX_CHARS];
+  uint8_t level[PFONT_AA_MAX_CHARS], left[PFONT_AA_MAX_CHARS];
+  uint16_t pal[16];
+  int16_t w = 0, wmax = 0;
+  uint8_t n = 0;
+
+  // Posição de cada glyph, com kerning
+  while (*str && (n < PFONT_AA_MAX_CHARS)) {
+    g[n] = pfont_glyph(font, *str++);
+    int16_t gw = w;
+    if (n) {
+      gw += pfont_kern(font, g[n-1], g[n]);
+      if (gw < 0) {
+        gw = 0;
+      }
+    }
+    if (gw + font->glyphs[g[n]].advance > PFONT_AA_MAX_W) {
+      break;
+    }
+    gx[n] = gw;
+    src[n] = &font->data[font->glyphs[g[n]].offset];
+    left[n] = 0;
+    w = gw + font->glyphs[g[n]].advance;
+    // com kerning, um glyph anterior pode terminar depois deste
+    if (gw + font->glyphs[g[n]].width > wmax) {
+      wmax = gw + font->glyphs[g[n]].width;
+    }
+    n++;
+  }
+  if (wmax > w) {
+    w = wmax;
+  }
+
+  // Recorte
+  int16_t x0 = x < 0 ? 0 : x;
+  int16_t x1 = x + w > sink->width ? sink->width : x + w;
+  int16_t y0 = y < 0 ? 0 : y;
+  int16_t y1 = y + font->height > sink->height ? sink->height : y + font->height;
+  if ((x0 >= x1) || (y0 >= y1)) {
+    return x + w;
+  }
+
+  for (uint8_t a = 0; a < 16; a++) {
+    pal[a] = pfont_aa_blend(fg, bg, a);
+  }
+
+  sink->window(x0, y0, x1 - x0, y1 - y0);
+  for (int16_t row = y; row < y1; row++) {
+    // Junta as linhas dos glyphs; onde se sobrepõem fica o maior nível
+    memset(line, 0, w);
+    for (uint8_t i = 0; i < n; i++) {
+      uint8_t *d = line + gx[i];
+      uint8_t cnt = font->glyphs[g[i]].width;
+      while (cnt) {
+        if (left[i] == 0) {
+          uint8_t b = *src[i]++;
+          level[i] = b >> 4;
+          left[i] = (b & 0x0F) + 1;
+        }
+        uint8_t k = left[i] < cnt ? left[i] : cnt;
+        if (level[i]) {
+          for (uint8_t j = 0; j < k; j++) {
+            if (d[j] < level[i]) {
+              d[j] = level[i];
+            }
+          }
+        }
+        d += k;
+        cnt -= k;
+        left[i] -= k;
+      }
+    }
+    if (row < y0) {
+      continue;
+    }
+
+    // Envia as sequências de pixels iguais
+    const uint8_t *p = line + (x0 - x);
+    const uint8_t *end = line + (x1 - x);
+    while (p < end) {
+      const uint8_t *q = p + 1;
+      while ((q < end) && (*q == *p)) {
+        q++;
+      }
+      sink->run(pal[*p], q - p);
+      p = q;
+    }
+  }
+  return x + w;
+}
+
+#endif
@@ -43,6 +43,10 @@
 #include <Adafruit_ST7789.h> // Hardware-specific library for ST7789
 #include <SPI.h>
 #include <FastLED.h>
+#include "font_status.h"
+#include "font_temp.h"
+#include "pfont_aa.h"
+#include "ui_fields.h"
 
 #define TFT_CS        14
 #define TFT_RST       21
@@ -59,6 +63,39 @@
 
 Adafruit_ST7789 tft = Adafruit_ST7789(TFT_CS, TFT_DC, TFT_RST);
 
+// Texto com anti-aliasing
+void tft_window(int16_t x, int16_t y, int16_t w, int16_t h) {
+  tft.setAddrWindow(x, y, w, h);
+}
+
+void tft_run(uint16_t cor, uint16_t n) {
+  tft.writeColor(cor, n);
+}
+
+const pfont_aa_sink_t tela = { 320, 172, tft_window, tft_run };
+
+// Campo da temperatura: cada caractere fica centralizado numa célula de
+// largura fixa e só as células que mudam são redesenhadas
+#define CELULA 24
+
+void tft_celula(int16_t x, int16_t y, char c) {
+  char s[2] = { c, 0 };
+  int16_t x0 = x + (CELULA - pfont_width(&font_temp, s)) / 2;
+  tft.startWrite();
+  int16_t x1 = pfont_aa_drawstr(&tela, &font_temp, x0, y, s, TEXTO, FUNDO);
+  tft.endWrite();
+  if (x0 > x) {
+    tft.fillRect(x, y, x0 - x, font_temp.height, FUNDO);
+  }
+  if (x1 < x + CELULA) {
+    tft.fillRect(x1, y, x + CELULA - x1, font_temp.height, FUNDO);
+  }
+}
+
+const ui_backend_t celulas = { tft_celula };
+ui_field_t campoTemp = UI_FIELD(&celulas, 30, 100, CELULA, 6);
+ui_field_t campoUnid = UI_FIELD(&celulas, 30 + 6*CELULA, 100, CELULA, 1);
+
 // RGB LED
 #define NUM_LEDS 1
 #define RGB_PIN 8
@@ -81,9 +118,7 @@ float sensor_tolerance;
 void recieveSensorTemp(float temperature) {
   Serial.printf("Temperature sensor value: %.2f°C\n", temperature);
   sensor_temp = temperature;
-  char msg[20];
-  sprintf (msg, "%.2fC", sensor_temp)  ;  
-  msg_sensor(msg);
+  msg_sensor(lroundf(sensor_temp * 100));
 }
 
 void recieveSensorConfig(float min_temp, float max_temp, float tolerance) {
@@ -93,25 +128,28 @@ void recieveSensorConfig(float min_temp, float max_temp, float tolerance) {
   sensor_tolerance = tolerance;
 }
 
+// Escreve uma mensagem e limpa o resto da linha (sem piscar)
+void msg_linha(const pfont_t *fonte, int16_t y, char *msg) {
+  tft.startWrite();
+  int16_t x = pfont_aa_drawstr(&tela, fonte, 30, y, msg, TEXTO, FUNDO);
+  tft.endWrite();
+  if (x < 280) {
+    tft.fillRect(x, y, 280 - x, fonte->height, FUNDO);
+  }
+}
+
 void msg_status(char *msg) {
-  tft.fillRect(30, 30, 250, 20, FUNDO);
-  tft.setCursor (30, 30);
-  tft.setTextSize(2);
-  tft.print(msg);
+  msg_linha(&font_status, 30, msg);
 }
 
 void msg_zigbee(char *msg) {
-  tft.fillRect(30, 60, 250, 20, FUNDO);
-  tft.setCursor (30, 60);
-  tft.setTextSize(2);
-  tft.print(msg);
+  msg_linha(&font_status, 60, msg);
 }
 
-void msg_sensor(char *msg) {
-  tft.fillRect(30, 100, 250, 40, FUNDO);
-  tft.setCursor (30, 100);
-  tft.setTextSize(4);
-  tft.print(msg);
+// Temperatura em centésimos de grau, em geral muda um ou dois dígitos
+void msg_sensor(int32_t centesimos) {
+  ui_number(&campoTemp, centesimos, 2, 0);
+  ui_text(&campoUnid, "C");
 }
 
 
@@ -134,7 +172,6 @@ void setup() {
   tft.fillRoundRect(0, 0, 320, 172, 24, FUNDO);
   tft.drawRoundRect(0, 0, 320, 172, 24, BORDA);
   tft.drawRoundRect(4, 4, 312, 164, 20, BORDA);
-  tft.setTextColor(TEXTO);
   msg_status("Starting");
 
   // Init button switch
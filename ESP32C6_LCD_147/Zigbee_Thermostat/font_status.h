@@ -0,0 +1,386 @@
+/*
+ * font_status: 45 proportional glyphs 16 pixels high, 4 bpp
+ * from ../fonts/font_12x16.h (scale 1)
+ * generated by CH32V003/fonts/pfontc.py, do not edit
+ */
+
+#ifndef _FONT_STATUS_H
+#define _FONT_STATUS_H
+
+#ifndef _PFONT_TYPES
+#define _PFONT_TYPES
+
+#include <stdint.h>
+#include <stddef.h>
+
+typedef struct {
+	uint16_t offset;		// first byte in the data
+	uint8_t width;			// columns in the data
+	uint8_t advance;		// where the next glyph starts
+} pfont_glyph_t;
+
+typedef struct {
+	uint8_t left, right;	// glyphs, sorted by left and then right
+	int8_t dx;				// added to the advance of left
+} pfont_kern_t;
+
+typedef struct {
+	uint8_t height;			// rows in each glyph
+	uint8_t bpp;			// 1: pages of column bytes, 4: runs of level<<4 | (n-1)
+	uint8_t first, last;	// character codes
+	const uint8_t *map;		// glyph of each code from first, NULL if in order
+	const pfont_glyph_t *glyphs;
+	const pfont_kern_t *kern;
+	uint16_t nkern;
+	const uint8_t *data;
+} pfont_t;
+
+/*
+ * glyph for a character, characters not in the font use the space (0)
+ */
+static inline uint8_t pfont_glyph(const pfont_t *font, uint8_t c)
+{
+	if((c < font->first) || (c > font->last))
+		return 0;
+	return font->map ? font->map[c - font->first] : c - font->first;
+}
+
+/*
+ * kerning between two glyphs (binary search)
+ */
+static inline int8_t pfont_kern(const pfont_t *font, uint8_t left, uint8_t right)
+{
+	uint16_t lo = 0, hi = font->nkern;
+	uint16_t key = (left << 8) | right;
+
+	while(lo < hi)
+	{
+		uint16_t mid = (lo + hi) >> 1;
+		const pfont_kern_t *k = &font->kern[mid];
+		uint16_t v = (k->left << 8) | k->right;
+		if(v == key)
+			return k->dx;
+		if(v < key)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+	return 0;
+}
+
+/*
+ * width in pixels of a string, from the first to the last column drawn
+ */
+static inline int16_t pfont_width(const pfont_t *font, const char *str)
+{
+	int16_t w = 0;
+	uint8_t g, prev = 0xFF;
+
+	while(*str)
+	{
+		g = pfont_glyph(font, *str++);
+		if(prev != 0xFF)
+			w += font->glyphs[prev].advance + pfont_kern(font, prev, g);
+		prev = g;
+	}
+	if(prev != 0xFF)
+		w += font->glyphs[prev].width;
+	return w;
+}
+
+#endif
+
+// glyph for each character code
+const uint8_t font_status_map[] = {
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x03, 0x04, 0x00, 0x00, 0x05, 0x06, 0x07, 0x00,
+	0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0A, 0x00,
+	0x00, 0x00, 0x00, 0x0B, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x0E, 0x0F,
+	0x00, 0x10, 0x11, 0x12, 0x13, 0x00, 0x00, 0x14, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x00, 0x1F, 0x20, 0x21, 0x22, 0x23,
+	0x24, 0x00, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2A, 0x2B, 0x2C,
+};
+
+const uint8_t font_status_data[] = {
+	/* 0 ' ' */
+	/* 1 '!' */
+	0x00, 0xA1, 0x00, 0x40, 0xF1, 0x40, 0xB0, 0xF1, 0xB0, 0xFB, 0xB0, 0xF1, 0xB0, 0x40, 0xF1, 0x40,
+	0x00, 0xF1, 0x01, 0xA1, 0x09, 0xA1, 0x01, 0xA1, 0x08,
+	/* 2 '%' */
+	0x0F, 0x0E, 0x40, 0xD0, 0x00, 0xA0, 0xF0, 0xA0, 0x03, 0x30, 0xC0, 0xF0, 0x00, 0xF2, 0x02, 0x30,
+	0xC0, 0xF0, 0xB0, 0x00, 0xA0, 0xF0, 0xA0, 0x01, 0x30, 0xC0, 0xF0, 0xC0, 0x30, 0x04, 0x30, 0xC0,
+	0xF0, 0xC0, 0x30, 0x04, 0x30, 0xC0, 0xF0, 0xC0, 0x30, 0x04, 0x30, 0xC0, 0xF0, 0xC0, 0x30, 0x04,
+	0x30, 0xC0, 0xF0, 0xC0, 0x30, 0x04, 0x30, 0xC0, 0xF0, 0xC0, 0x30, 0x04, 0x30, 0xC0, 0xF0, 0xC0,
+	0x30, 0x01, 0xA0, 0xF0, 0xA0, 0x00, 0xB0, 0xF0, 0xC0, 0x30, 0x02, 0xF2, 0x00, 0xA0, 0xB0, 0x30,
+	0x03, 0xA0, 0xF0, 0xA0, 0x0F, 0x06,
+	/* 3 '(' */
+	0x01, 0x30, 0xB0, 0xF0, 0xD0, 0x00, 0x30, 0xC0, 0xF0, 0x50, 0x01, 0xB0, 0xF0, 0xB0, 0x01, 0x40,
+	0xF1, 0x40, 0x01, 0xB0, 0xF1, 0x02, 0xF2, 0x02, 0xF2, 0x02, 0xF2, 0x02, 0xF2, 0x02, 0xB0, 0xF1,
+	0x02, 0x40, 0xF1, 0x40, 0x02, 0xB0, 0xF0, 0xB0, 0x02, 0x30, 0xC0, 0xF0, 0x50, 0x02, 0x30, 0xB0,
+	0xF0, 0xD0, 0x0B,
+	/* 4 ')' */
+	0xD0, 0xF0, 0xB0, 0x30, 0x02, 0x50, 0xF0, 0xC0, 0x30, 0x02, 0xB0, 0xF0, 0xB0, 0x02, 0x40, 0xF1,
+	0x40, 0x02, 0xF1, 0xB0, 0x02, 0xF2, 0x02, 0xF2, 0x02, 0xF2, 0x02, 0xF2, 0x02, 0xF1, 0xB0, 0x01,
+	0x40, 0xF1, 0x40, 0x01, 0xB0, 0xF0, 0xB0, 0x01, 0x50, 0xF0, 0xC0, 0x30, 0x00, 0xD0, 0xF0, 0xB0,
+	0x30, 0x0D,
+	/* 5 ',' */
+	0x0F, 0x0F, 0x00, 0xA0, 0xF0, 0xA0, 0xF2, 0xA0, 0xF1, 0x20, 0xF0, 0xB0, 0xD0, 0xB0, 0x30,
+	/* 6 '-' */
+	0x0F, 0x0F, 0x0F, 0x07, 0xA0, 0xF5, 0xA1, 0xF5, 0xA0, 0x0F, 0x0F, 0x0F, 0x07,
+	/* 7 '.' */
+	0x0F, 0x0F, 0x00, 0xA0, 0xF0, 0xA0, 0xF2, 0xA0, 0xF0, 0xA0, 0x05,
+	/* 8 '2' */
+	0x00, 0x30, 0xB0, 0xF4, 0xB0, 0x30, 0x00, 0x30, 0xC0, 0xF6, 0xC0, 0x30, 0xB0, 0xF0, 0xC0, 0x40,
+	0x02, 0x40, 0xB0, 0xF0, 0xB0, 0xF1, 0x40, 0x04, 0x20, 0xF1, 0xA1, 0x04, 0x30, 0xB0, 0xF0, 0xB0,
+	0x05, 0x30, 0xC0, 0xF0, 0xC0, 0x30, 0x04, 0x30, 0xC0, 0xF0, 0xC0, 0x30, 0x04, 0x30, 0xC0, 0xF0,
+	0xC0, 0x30, 0x04, 0x30, 0xC0, 0xF0, 0xC0, 0x30, 0x04, 0x30, 0xC0, 0xF0, 0xC0, 0x30, 0x04, 0x30,
+	0xC0, 0xF0, 0xB0, 0x30, 0x04, 0x30, 0xC0, 0xF1, 0x20, 0x05, 0xB0, 0xF8, 0xA1, 0xF8, 0xA0, 0x0F,
+	0x05,
+	/* 9 ':' */
+	0x0B, 0xA0, 0xF0, 0xA0, 0xF2, 0xA0, 0xF0, 0xA0, 0x08, 0xA0, 0xF0, 0xA0, 0xF2, 0xA0, 0xF0, 0xA0,
+	0x08,
+	/* 10 '>' */
+	0xA0, 0xB0, 0x30, 0x04, 0xB0, 0xF0, 0xC0, 0x30, 0x03, 0x30, 0xC0, 0xF0, 0xC0, 0x30, 0x03, 0x30,
+	0xC0, 0xF0, 0xC0, 0x30, 0x03, 0x30, 0xC0, 0xF0, 0xC0, 0x30, 0x03, 0x30, 0xC0, 0xF0, 0xC0, 0x30,
+	0x03, 0x40, 0xF1, 0xB0, 0x03, 0x40, 0xF1, 0xB0, 0x02, 0x30, 0xC0, 0xF0, 0xC0, 0x30, 0x01, 0x30,
+	0xC0, 0xF0, 0xC0, 0x30, 0x01, 0x30, 0xC0, 0xF0, 0xC0, 0x30, 0x01, 0x30, 0xC0, 0xF0, 0xC0, 0x30,
+	0x02, 0xB0, 0xF0, 0xC0, 0x30, 0x03, 0xA0, 0xB0, 0x30, 0x0F, 0x04,
+	/* 11 'C' */
+	0x01, 0x30, 0xB0, 0xF2, 0xB0, 0x30, 0x01, 0x30, 0xC0, 0xF4, 0xC0, 0x30, 0x00, 0xB0, 0xF0, 0xC0,
+	0x40, 0x00, 0x40, 0xC0, 0xF0, 0xB0, 0x40, 0xF0, 0xC0, 0x30, 0x02, 0x30, 0xB0, 0xA0, 0xB0, 0xF0,
+	0x40, 0x06, 0xF1, 0x07, 0xF1, 0x07, 0xF1, 0x07, 0xF1, 0x07, 0xB0, 0xF0, 0x40, 0x06, 0x40, 0xF0,
+	0xC0, 0x30, 0x02, 0x30, 0xB0, 0xA0, 0x00, 0xB0, 0xF0, 0xC0, 0x40, 0x00, 0x40, 0xC0, 0xF0, 0xB0,
+	0x00, 0x30, 0xC0, 0xF4, 0xC0, 0x30, 0x01, 0x30, 0xB0, 0xF2, 0xB0, 0x30, 0x0F, 0x04,
+	/* 12 'D' */
+	0xA0, 0xF4, 0xB0, 0x30, 0x01, 0xF6, 0xC0, 0x30, 0x00, 0xF1, 0x50, 0x01, 0x40, 0xC0, 0xF0, 0xB0,
+	0x00, 0xF1, 0x03, 0x30, 0xC0, 0xF0, 0x40, 0xF1, 0x04, 0x40, 0xF0, 0xB0, 0xF1, 0x05, 0xF3, 0x05,
+	0xF3, 0x05, 0xF3, 0x05, 0xF3, 0x04, 0x40, 0xF0, 0xB0, 0xF1, 0x03, 0x30, 0xC0, 0xF0, 0x40, 0xF1,
+	0x50, 0x01, 0x40, 0xC0, 0xF0, 0xB0, 0x00, 0xF6, 0xC0, 0x30, 0x00, 0xA0, 0xF4, 0xB0, 0x30, 0x0F,
+	0x05,
+	/* 13 'L' */
+	0xA1, 0x07, 0xF1, 0x07, 0xF1, 0x07, 0xF1, 0x07, 0xF1, 0x07, 0xF1, 0x07, 0xF1, 0x07, 0xF1, 0x07,
+	0xF1, 0x07, 0xF1, 0x07, 0xF1, 0x07, 0xF1, 0x50, 0x06, 0xF8, 0xA1, 0xF7, 0xA0, 0x0F, 0x03,
+	/* 14 'N' */
+	0xA0, 0xB0, 0x30, 0x04, 0xA1, 0xF1, 0xB0, 0x04, 0xF4, 0x40, 0x03, 0xF4, 0xC0, 0x30, 0x02, 0xF3,
+	0x20, 0xF0, 0xB0, 0x02, 0xF3, 0x00, 0xB0, 0xF0, 0x40, 0x01, 0xF3, 0x00, 0x40, 0xF0, 0xB0, 0x01,
+	0xF3, 0x01, 0xB0, 0xF0, 0x40, 0x00, 0xF3, 0x01, 0x40, 0xF0, 0xB0, 0x00, 0xF3, 0x02, 0xB0, 0xF0,
+	0x20, 0xF3, 0x02, 0x30, 0xC0, 0xF4, 0x03, 0x40, 0xF4, 0x04, 0xB0, 0xF1, 0xA1, 0x04, 0x30, 0xB0,
+	0xA0, 0x0F, 0x03,
+	/* 15 'O' */
+	0x01, 0x30, 0xB0, 0xF1, 0xB0, 0x30, 0x02, 0x30, 0xC0, 0xF3, 0xC0, 0x30, 0x01, 0xB0, 0xF0, 0xC0,
+	0x41, 0xC0, 0xF0, 0xB0, 0x00, 0x40, 0xF0, 0xC0, 0x30, 0x01, 0x30, 0xC0, 0xF0, 0x40, 0xB0, 0xF0,
+	0x40, 0x03, 0x40, 0xF0, 0xB0, 0xF1, 0x05, 0xF3, 0x05, 0xF3, 0x05, 0xF3, 0x05, 0xF1, 0xB0, 0xF0,
+	0x40, 0x03, 0x40, 0xF0, 0xB0, 0x40, 0xF0, 0xC0, 0x30, 0x01, 0x30, 0xC0, 0xF0, 0x40, 0x00, 0xB0,
+	0xF0, 0xC0, 0x41, 0xC0, 0xF0, 0xB0, 0x01, 0x30, 0xC0, 0xF3, 0xC0, 0x30, 0x02, 0x30, 0xB0, 0xF1,
+	0xB0, 0x30, 0x0F, 0x05,
+	/* 16 'Q' */
+	0x01, 0x30, 0xB0, 0xF1, 0xB0, 0x30, 0x02, 0x30, 0xC0, 0xF3, 0xC0, 0x30, 0x01, 0xB0, 0xF0, 0xC0,
+	0x41, 0xC0, 0xF0, 0xB0, 0x00, 0x40, 0xF0, 0xC0, 0x30, 0x01, 0x30, 0xC0, 0xF0, 0x40, 0xB0, 0xF0,
+	0x40, 0x03, 0x40, 0xF0, 0xB0, 0xF1, 0x05, 0xF3, 0x05, 0xF3, 0x05, 0xF3, 0x05, 0xF1, 0xB0, 0xF0,
+	0x40, 0x01, 0xA1, 0x20, 0xF0, 0xB0, 0x40, 0xF0, 0xC0, 0x30, 0x00, 0xA0, 0xF2, 0x40, 0x00, 0xB0,
+	0xF0, 0xC0, 0x40, 0x20, 0xF2, 0x40, 0x00, 0x30, 0xC0, 0xF5, 0xB0, 0x01, 0x30, 0xB0, 0xF1, 0xA0,
+	0x20, 0xA1, 0x0F, 0x03,
+	/* 17 'R' */
+	0xA0, 0xF5, 0xB0, 0x30, 0x00, 0xF7, 0xC0, 0x30, 0xF1, 0x50, 0x02, 0x40, 0xC0, 0xF0, 0xB0, 0xF1,
+	0x04, 0x40, 0xF3, 0x05, 0xF3, 0x04, 0x40, 0xF3, 0x50, 0x02, 0x40, 0xC0, 0xF0, 0xB0, 0xF7, 0xC0,
+	0x30, 0xF6, 0xB0, 0x30, 0x00, 0xF1, 0x50, 0x40, 0xC0, 0xF1, 0x20, 0x01, 0xF1, 0x01, 0x30, 0xC0,
+	0xF0, 0xB0, 0x30, 0x00, 0xF1, 0x02, 0x30, 0xC0, 0xF0, 0xC0, 0x30, 0xF1, 0x03, 0x30, 0xC0, 0xF0,
+	0xB0, 0xA1, 0x04, 0x30, 0xB0, 0xA0, 0x0F, 0x03,
+	/* 18 'S' */
+	0x00, 0x30, 0xB0, 0xF3, 0xB0, 0x30, 0x00, 0x30, 0xC0, 0xF5, 0xC0, 0x30, 0xB0, 0xF0, 0xC0, 0x40,
+	0x01, 0x40, 0xC0, 0xF0, 0xB0, 0xF1, 0x40, 0x03, 0x30, 0xB0, 0xA0, 0xF1, 0x40, 0x06, 0xB0, 0xF0,
+	0xC0, 0x40, 0x05, 0x30, 0xC0, 0xF4, 0xB0, 0x30, 0x01, 0x30, 0xB0, 0xF4, 0xC0, 0x30, 0x05, 0x40,
+	0xC0, 0xF0, 0xB0, 0x06, 0x40, 0xF1, 0xA0, 0xB0, 0x30, 0x03, 0x40, 0xF1, 0xB0, 0xF0, 0xC0, 0x40,
+	0x01, 0x40, 0xC0, 0xF0, 0xB0, 0x30, 0xC0, 0xF5, 0xC0, 0x30, 0x00, 0x30, 0xB0, 0xF3, 0xB0, 0x30,
+	0x0F, 0x04,
+	/* 19 'T' */
+	0xA0, 0xF5, 0xA1, 0xF5, 0xA0, 0x01, 0x50, 0xF1, 0x50, 0x04, 0xF1, 0x05, 0xF1, 0x05, 0xF1, 0x05,
+	0xF1, 0x05, 0xF1, 0x05, 0xF1, 0x05, 0xF1, 0x05, 0xF1, 0x05, 0xF1, 0x05, 0xF1, 0x05, 0xA1, 0x0F,
+	0x02,
+	/* 20 'W' */
+	0xA1, 0x05, 0xA1, 0xF1, 0x05, 0xF3, 0x05, 0xF3, 0x05, 0xF3, 0x05, 0xF3, 0x05, 0xF3, 0x05, 0xF3,
+	0x01, 0xA1, 0x01, 0xF3, 0x00, 0x40, 0xF1, 0x40, 0x00, 0xF3, 0x20, 0xB0, 0xF1, 0xB0, 0x20, 0xF4,
+	0xC0, 0x41, 0xC0, 0xF5, 0x40, 0x01, 0x40, 0xF4, 0xB0, 0x03, 0xB0, 0xF1, 0xA0, 0xB0, 0x30, 0x03,
+	0x30, 0xB0, 0xA0, 0x0F, 0x03,
+	/* 21 'Z' */
+	0xA0, 0xF7, 0xA1, 0xF7, 0xB0, 0x05, 0x50, 0xF1, 0x40, 0x05, 0x40, 0xF0, 0xB0, 0x05, 0x30, 0xC1,
+	0x30, 0x04, 0x30, 0xC1, 0x30, 0x05, 0xB0, 0xF0, 0x40, 0x05, 0x40, 0xF0, 0xB0, 0x05, 0x30, 0xC1,
+	0x30, 0x04, 0x30, 0xC1, 0x30, 0x05, 0xB0, 0xF0, 0x40, 0x05, 0x40, 0xF1, 0x50, 0x05, 0xB0, 0xF7,
+	0xA1, 0xF7, 0xA0, 0x0F, 0x03,
+	/* 22 'a' */
+	0x0F, 0x0F, 0x0F, 0x02, 0x40, 0xB0, 0xF4, 0xB0, 0x30, 0x00, 0xD0, 0xF6, 0xB0, 0x06, 0x20, 0xF1,
+	0x00, 0x30, 0xB0, 0xF6, 0x30, 0xC0, 0xF7, 0xB0, 0xF0, 0x50, 0x03, 0x50, 0xF3, 0x50, 0x03, 0x50,
+	0xF1, 0xB0, 0xF8, 0x30, 0xB0, 0xF6, 0xA0, 0x0F, 0x03,
+	/* 23 'b' */
+	0xA1, 0x07, 0xF1, 0x07, 0xF1, 0x07, 0xF1, 0x07, 0xF1, 0x07, 0xF1, 0x20, 0xA0, 0xF2, 0xB0, 0x30,
+	0x00, 0xF7, 0xC0, 0x30, 0xF1, 0xC0, 0x40, 0x01, 0x40, 0xC0, 0xF0, 0xB0, 0xF1, 0x40, 0x03, 0x40,
+	0xF3, 0x05, 0xF3, 0x04, 0x40, 0xF3, 0x50, 0x02, 0x40, 0xC0, 0xF0, 0xB0, 0xF7, 0xC0, 0x30, 0xA0,
+	0xF5, 0xB0, 0x30, 0x0F, 0x04,
+	/* 24 'c' */
+	0x0F, 0x0F, 0x0F, 0x02, 0x30, 0xB0, 0xF3, 0xB0, 0x30, 0x00, 0x30, 0xC0, 0xF5, 0xC0, 0x40, 0xB0,
+	0xF0, 0xC0, 0x40, 0x02, 0x40, 0xB0, 0xD0, 0xF1, 0x40, 0x06, 0xF1, 0x07, 0xF1, 0x40, 0x06, 0xB0,
+	0xF0, 0xC0, 0x40, 0x02, 0x40, 0xB0, 0xD0, 0x30, 0xC0, 0xF5, 0xC0, 0x40, 0x00, 0x30, 0xB0, 0xF3,
+	0xB0, 0x30, 0x0F, 0x04,
+	/* 25 'd' */
+	0x07, 0xA1, 0x07, 0xF1, 0x07, 0xF1, 0x07, 0xF1, 0x07, 0xF1, 0x00, 0x30, 0xB0, 0xF2, 0xA0, 0x20,
+	0xF1, 0x30, 0xC0, 0xF7, 0xB0, 0xF0, 0xC0, 0x40, 0x00, 0x40, 0xB0, 0xF4, 0x40, 0x03, 0x50, 0xF3,
+	0x05, 0xF3, 0x40, 0x04, 0xF1, 0xB0, 0xF0, 0xC0, 0x40, 0x02, 0x50, 0xF1, 0x30, 0xC0, 0xF7, 0x00,
+	0x30, 0xB0, 0xF5, 0xA0, 0x0F, 0x03,
+	/* 26 'e' */
+	0x0F, 0x0F, 0x0F, 0x02, 0x30, 0xB0, 0xF3, 0xB0, 0x30, 0x00, 0x30, 0xC0, 0xF5, 0xC0, 0x30, 0xB0,
+	0xF1, 0x20, 0x02, 0x20, 0xF0, 0xB0, 0xF8, 0xB0, 0xF7, 0xB0, 0x30, 0xF1, 0x20, 0x06, 0xB0, 0xF0,
+	0xB0, 0x40, 0x05, 0x30, 0xC0, 0xF5, 0xD0, 0x01, 0x30, 0xB0, 0xF3, 0xB0, 0x40, 0x0F, 0x04,
+	/* 27 'f' */
+	0x02, 0x30, 0xB0, 0xF1, 0xA0, 0x01, 0x30, 0xC0, 0xF2, 0xA0, 0x01, 0xB0, 0xF0, 0xC0, 0x40, 0x03,
+	0xF1, 0x40, 0x04, 0xF1, 0x04, 0x50, 0xF1, 0x50, 0x02, 0xA0, 0xF4, 0xA0, 0x00, 0xA0, 0xF4, 0xA0,
+	0x01, 0x50, 0xF1, 0x50, 0x04, 0xF1, 0x05, 0xF1, 0x05, 0xF1, 0x05, 0xF1, 0x05, 0xA1, 0x0F, 0x03,
+	/* 28 'g' */
+	0x0F, 0x0F, 0x0F, 0x02, 0x30, 0xB0, 0xF5, 0xA0, 0x30, 0xC0, 0xF7, 0xB0, 0xF0, 0xB0, 0x40, 0x02,
+	0x50, 0xF3, 0x20, 0x03, 0x40, 0xF1, 0xB0, 0xF0, 0xB0, 0x40, 0x01, 0x40, 0xC0, 0xF1, 0x30, 0xC0,
+	0xF7, 0x00, 0x30, 0xB0, 0xF2, 0xA0, 0x20, 0xF1, 0x06, 0x40, 0xF1, 0x05, 0x40, 0xC0, 0xF0, 0xB0,
+	0x00, 0xA0, 0xF5, 0xC0, 0x30, 0x00, 0xA0, 0xF4, 0xB0, 0x30, 0x00,
+	/* 29 'h' */
+	0xA1, 0x06, 0xF1, 0x06, 0xF1, 0x06, 0xF1, 0x06, 0xF1, 0x06, 0xF1, 0x20, 0xA0, 0xF1, 0xB0, 0x30,
+	0x00, 0xF6, 0xC0, 0x30, 0xF1, 0xC0, 0x40, 0x00, 0x40, 0xC0, 0xF0, 0xB0, 0xF1, 0x40, 0x02, 0x40,
+	0xF3, 0x04, 0xF3, 0x04, 0xF3, 0x04, 0xF3, 0x04, 0xF1, 0xA1, 0x04, 0xA1, 0x0F, 0x01,
+	/* 30 'i' */
+	0x0D, 0xA1, 0x03, 0xA1, 0x08, 0xA0, 0xF0, 0xA0, 0x02, 0xB0, 0xF1, 0x02, 0x40, 0xF1, 0x03, 0xF1,
+	0x03, 0xF1, 0x03, 0xF1, 0x02, 0x50, 0xF1, 0x50, 0x00, 0xA0, 0xF3, 0xA1, 0xF3, 0xA0, 0x0B,
+	/* 31 'k' */
+	0xA1, 0x05, 0xF1, 0x05, 0xF1, 0x05, 0xF1, 0x05, 0xF1, 0x05, 0xF1, 0x01, 0x30, 0xB0, 0xA0, 0x00,
+	0xF1, 0x00, 0x30, 0xC0, 0xF0, 0xB0, 0x00, 0xF1, 0x20, 0xB0, 0xF0, 0xC0, 0x30, 0x00, 0xF4, 0x40,
+	0x01, 0xF4, 0x40, 0x01, 0xF1, 0x20, 0xB0, 0xF0, 0xC0, 0x30, 0x00, 0xF1, 0x00, 0x30, 0xC0, 0xF0,
+	0xC0, 0x30, 0xF1, 0x01, 0x30, 0xC0, 0xF0, 0xB0, 0xA1, 0x02, 0x30, 0xB0, 0xA0, 0x0F,
+	/* 32 'l' */
+	0x00, 0xA0, 0xF0, 0xA0, 0x02, 0xB0, 0xF1, 0x02, 0x40, 0xF1, 0x03, 0xF1, 0x03, 0xF1, 0x03, 0xF1,
+	0x03, 0xF1, 0x03, 0xF1, 0x03, 0xF1, 0x03, 0xF1, 0x03, 0xF1, 0x02, 0x50, 0xF1, 0x50, 0x00, 0xA0,
+	0xF3, 0xA1, 0xF3, 0xA0, 0x0B,
+	/* 33 'm' */
+	0x0F, 0x0F, 0x0F, 0x01, 0xD0, 0x20, 0xA0, 0xB0, 0x41, 0xB1, 0x30, 0x00, 0xF7, 0xC0, 0x30, 0xF8,
+	0xB0, 0xF1, 0x51, 0xF1, 0x51, 0xF3, 0x01, 0xF1, 0x01, 0xF3, 0x01, 0xF1, 0x01, 0xF3, 0x01, 0xF1,
+	0x01, 0xF3, 0x01, 0xF1, 0x01, 0xF1, 0xA1, 0x01, 0xA1, 0x01, 0xA1, 0x0F, 0x03,
+	/* 34 'n' */
+	0x0F, 0x0F, 0x0C, 0xA0, 0xF4, 0xB0, 0x30, 0x00, 0xF6, 0xC0, 0x30, 0xF1, 0x50, 0x01, 0x40, 0xC0,
+	0xF0, 0xB0, 0xF1, 0x03, 0x40, 0xF3, 0x04, 0xF3, 0x04, 0xF3, 0x04, 0xF3, 0x04, 0xF1, 0xA1, 0x04,
+	0xA1, 0x0F, 0x01,
+	/* 35 'o' */
+	0x0F, 0x0F, 0x0F, 0x02, 0x30, 0xB0, 0xF3, 0xB0, 0x30, 0x00, 0x30, 0xC0, 0xF5, 0xC0, 0x30, 0xB0,
+	0xF0, 0xC0, 0x40, 0x01, 0x40, 0xC0, 0xF0, 0xB0, 0xF1, 0x40, 0x03, 0x40, 0xF3, 0x05, 0xF3, 0x40,
+	0x03, 0x40, 0xF1, 0xB0, 0xF0, 0xC0, 0x40, 0x01, 0x40, 0xC0, 0xF0, 0xB0, 0x30, 0xC0, 0xF5, 0xC0,
+	0x30, 0x00, 0x30, 0xB0, 0xF3, 0xB0, 0x30, 0x0F, 0x04,
+	/* 36 'p' */
+	0x0F, 0x0F, 0x0F, 0x01, 0xA0, 0xF5, 0xB0, 0x30, 0x00, 0xF7, 0xC0, 0x30, 0xF1, 0x50, 0x02, 0x40,
+	0xC0, 0xF0, 0xB0, 0xF1, 0x04, 0x40, 0xF3, 0x40, 0x03, 0x40, 0xF3, 0xC0, 0x40, 0x01, 0x40, 0xC0,
+	0xF0, 0xB0, 0xF7, 0xC0, 0x30, 0xF1, 0x20, 0xA0, 0xF2, 0xB0, 0x30, 0x00, 0xF1, 0x07, 0xF1, 0x07,
+	0xA1, 0x07,
+	/* 37 'r' */
+	0x0F, 0x0F, 0x0C, 0xA1, 0x20, 0xA0, 0xF2, 0xB0, 0x30, 0xF7, 0xB0, 0xF1, 0xC0, 0x40, 0x01, 0x40,
+	0xB0, 0xA0, 0xF1, 0x40, 0x05, 0xF1, 0x06, 0xF1, 0x06, 0xF1, 0x06, 0xF1, 0x06, 0xA1, 0x0F, 0x08,
+	/* 38 's' */
+	0x0F, 0x0F, 0x07, 0x30, 0xB0, 0xF3, 0xB0, 0x40, 0xB0, 0xF5, 0xD0, 0xF1, 0x20, 0x04, 0xB0, 0xF4,
+	0xB0, 0x31, 0xB0, 0xF4, 0xB0, 0x04, 0x50, 0xF1, 0x04, 0x50, 0xF1, 0xD0, 0xF5, 0xB0, 0x40, 0xB0,
+	0xF3, 0xB0, 0x30, 0x0F,
+	/* 39 't' */
+	0x09, 0xA1, 0x05, 0xF1, 0x05, 0xF1, 0x04, 0x50, 0xF1, 0x50, 0x02, 0xA0, 0xF4, 0xA0, 0x00, 0xA0,
+	0xF4, 0xA0, 0x01, 0x50, 0xF1, 0x50, 0x04, 0xF1, 0x05, 0xF1, 0x05, 0xF1, 0x05, 0xF1, 0x50, 0x04,
+	0xB0, 0xF3, 0xA0, 0x01, 0x30, 0xB0, 0xF2, 0xA0, 0x0F,
+	/* 40 'u' */
+	0x0F, 0x0F, 0x0F, 0x01, 0xA1, 0x05, 0xA1, 0xF1, 0x05, 0xF3, 0x05, 0xF3, 0x05, 0xF3, 0x05, 0xF3,
+	0x40, 0x03, 0x40, 0xF1, 0xB0, 0xF0, 0xC0, 0x40, 0x01, 0x40, 0xC0, 0xF1, 0x30, 0xC0, 0xF7, 0x00,
+	0x30, 0xB0, 0xF2, 0xA0, 0x20, 0xA1, 0x0F, 0x03,
+	/* 41 'v' */
+	0x0F, 0x0F, 0x0F, 0x01, 0xA1, 0x05, 0xA1, 0xB0, 0xF0, 0x40, 0x03, 0x40, 0xF0, 0xB0, 0x40, 0xF0,
+	0xB0, 0x03, 0xB0, 0xF0, 0x40, 0x00, 0xB0, 0xF0, 0x40, 0x01, 0x40, 0xF0, 0xB0, 0x01, 0x40, 0xF0,
+	0xB0, 0x01, 0xB0, 0xF0, 0x40, 0x02, 0xB0, 0xF0, 0x51, 0xF0, 0xB0, 0x03, 0x40, 0xF3, 0x40, 0x04,
+	0xB0, 0xF1, 0xB0, 0x05, 0x30, 0xB1, 0x30, 0x0F, 0x06,
+	/* 42 'w' */
+	0x0F, 0x0F, 0x0F, 0x01, 0xA1, 0x01, 0xA1, 0x01, 0xA1, 0xF1, 0x01, 0xF1, 0x01, 0xF3, 0x01, 0xF1,
+	0x01, 0xF3, 0x01, 0xF1, 0x01, 0xF3, 0x00, 0x40, 0xF1, 0x40, 0x00, 0xF1, 0xB0, 0xF0, 0x20, 0xB0,
+	0xF1, 0xB0, 0x20, 0xF0, 0xB0, 0x40, 0xF7, 0x40, 0x00, 0xB0, 0xF0, 0xC0, 0x41, 0xC0, 0xF0, 0xB0,
+	0x01, 0x40, 0xD0, 0x40, 0x01, 0x40, 0xD0, 0x40, 0x0F, 0x04,
+	/* 43 'x' */
+	0x0F, 0x0F, 0x0C, 0xA0, 0xB0, 0x30, 0x02, 0x30, 0xB0, 0xA0, 0xB0, 0xF0, 0xC0, 0x30, 0x00, 0x30,
+	0xC0, 0xF0, 0xB0, 0x30, 0xC0, 0xF0, 0xB0, 0x20, 0xB0, 0xF0, 0xC0, 0x30, 0x00, 0x30, 0xB0, 0xF2,
+	0xB0, 0x30, 0x02, 0x20, 0xF2, 0x20, 0x02, 0x30, 0xB0, 0xF2, 0xB0, 0x30, 0x00, 0x30, 0xC0, 0xF0,
+	0xB0, 0x20, 0xB0, 0xF0, 0xC0, 0x30, 0xB0, 0xF0, 0xC0, 0x30, 0x00, 0x30, 0xC0, 0xF0, 0xB0, 0xA0,
+	0xB0, 0x30, 0x02, 0x30, 0xB0, 0xA0, 0x0F, 0x01,
+	/* 44 'y' */
+	0x0F, 0x0F, 0x07, 0xA1, 0x03, 0xA1, 0xB0, 0xF0, 0x40, 0x01, 0x40, 0xF0, 0xB0, 0x40, 0xF0, 0xB0,
+	0x01, 0xB0, 0xF0, 0x40, 0x00, 0xB0, 0xF0, 0x51, 0xF0, 0xB0, 0x01, 0x40, 0xF3, 0x40, 0x02, 0xB0,
+	0xF1, 0xB0, 0x03, 0x40, 0xF1, 0x40, 0x03, 0x40, 0xF0, 0xB0, 0x04, 0xB0, 0xF0, 0x40, 0x03, 0x50,
+	0xF0, 0xB0, 0x04, 0xD0, 0xB0, 0x30, 0x03,
+};
+
+const pfont_glyph_t font_status_glyphs[] = {
+	{ 0, 0, 4 },	/* ' ' */
+	{ 0, 4, 5 },	/* '!' */
+	{ 25, 11, 12 },	/* '%' */
+	{ 111, 6, 7 },	/* '(' */
+	{ 162, 6, 7 },	/* ')' */
+	{ 212, 3, 4 },	/* ',' */
+	{ 227, 8, 9 },	/* '-' */
+	{ 240, 3, 4 },	/* '.' */
+	{ 251, 11, 12 },	/* '2' */
+	{ 332, 3, 4 },	/* ':' */
+	{ 349, 8, 9 },	/* '>' */
+	{ 424, 10, 11 },	/* 'C' */
+	{ 502, 10, 11 },	/* 'D' */
+	{ 567, 10, 11 },	/* 'L' */
+	{ 598, 10, 11 },	/* 'N' */
+	{ 665, 10, 11 },	/* 'O' */
+	{ 749, 10, 11 },	/* 'Q' */
+	{ 833, 10, 11 },	/* 'R' */
+	{ 905, 10, 11 },	/* 'S' */
+	{ 987, 8, 9 },	/* 'T' */
+	{ 1020, 10, 11 },	/* 'W' */
+	{ 1073, 10, 11 },	/* 'Z' */
+	{ 1126, 10, 11 },	/* 'a' */
+	{ 1167, 10, 11 },	/* 'b' */
+	{ 1220, 10, 11 },	/* 'c' */
+	{ 1272, 10, 11 },	/* 'd' */
+	{ 1326, 10, 11 },	/* 'e' */
+	{ 1373, 8, 9 },	/* 'f' */
+	{ 1421, 10, 11 },	/* 'g' */
+	{ 1480, 9, 10 },	/* 'h' */
+	{ 1526, 6, 7 },	/* 'i' */
+	{ 1557, 8, 9 },	/* 'k' */
+	{ 1619, 6, 7 },	/* 'l' */
+	{ 1656, 10, 11 },	/* 'm' */
+	{ 1701, 9, 10 },	/* 'n' */
+	{ 1736, 10, 11 },	/* 'o' */
+	{ 1793, 10, 11 },	/* 'p' */
+	{ 1843, 9, 10 },	/* 'r' */
+	{ 1875, 8, 9 },	/* 's' */
+	{ 1911, 8, 9 },	/* 't' */
+	{ 1952, 10, 11 },	/* 'u' */
+	{ 1992, 10, 11 },	/* 'v' */
+	{ 2049, 10, 11 },	/* 'w' */
+	{ 2107, 9, 10 },	/* 'x' */
+	{ 2179, 8, 9 },	/* 'y' */
+};
+
+const pfont_kern_t font_status_kern[] = {
+	{ 5, 19, -3 }, { 5, 27, -2 }, { 5, 39, -2 }, { 5, 41, -2 }, { 6, 8, -3 }, { 6, 19, -3 },
+	{ 6, 21, -2 }, { 6, 32, -2 }, { 7, 19, -3 }, { 7, 27, -2 }, { 7, 39, -2 }, { 7, 41, -2 },
+	{ 7, 44, -2 }, { 8, 6, -2 }, { 9, 19, -3 }, { 11, 6, -4 }, { 11, 27, -2 }, { 11, 39, -2 },
+	{ 11, 41, -2 }, { 11, 44, -2 }, { 13, 6, -4 }, { 13, 19, -3 }, { 13, 27, -2 }, { 13, 39, -2 },
+	{ 13, 41, -3 }, { 13, 44, -2 }, { 19, 5, -3 }, { 19, 6, -3 }, { 19, 7, -3 }, { 19, 9, -3 },
+	{ 19, 22, -3 }, { 19, 24, -3 }, { 19, 25, -3 }, { 19, 26, -3 }, { 19, 27, -2 }, { 19, 28, -3 },
+	{ 19, 30, -2 }, { 19, 33, -3 }, { 19, 34, -3 }, { 19, 35, -3 }, { 19, 36, -3 }, { 19, 37, -3 },
+	{ 19, 38, -3 }, { 19, 39, -2 }, { 19, 40, -3 }, { 19, 41, -3 }, { 19, 42, -3 }, { 19, 43, -3 },
+	{ 19, 44, -3 }, { 21, 6, -4 }, { 21, 27, -2 }, { 21, 39, -2 }, { 21, 41, -2 }, { 21, 44, -2 },
+	{ 22, 19, -3 }, { 23, 19, -3 }, { 24, 19, -3 }, { 26, 19, -3 }, { 27, 5, -4 }, { 27, 7, -4 },
+	{ 27, 22, -2 }, { 27, 30, -2 }, { 28, 19, -3 }, { 29, 19, -3 }, { 30, 6, -2 }, { 30, 19, -2 },
+	{ 30, 27, -2 }, { 30, 39, -2 }, { 30, 41, -2 }, { 30, 44, -2 }, { 31, 19, -3 }, { 32, 6, -2 },
+	{ 32, 19, -2 }, { 32, 27, -2 }, { 32, 39, -2 }, { 32, 41, -2 }, { 32, 44, -2 }, { 33, 19, -3 },
+	{ 34, 19, -3 }, { 35, 19, -3 }, { 36, 19, -3 }, { 37, 5, -4 }, { 37, 7, -4 }, { 37, 19, -3 },
+	{ 37, 21, -3 }, { 37, 32, -2 }, { 38, 19, -3 }, { 39, 19, -3 }, { 40, 19, -3 }, { 41, 5, -2 },
+	{ 41, 7, -2 }, { 41, 19, -3 }, { 41, 21, -3 }, { 41, 32, -2 }, { 42, 19, -3 }, { 43, 19, -3 },
+	{ 44, 5, -2 }, { 44, 7, -2 }, { 44, 19, -3 }, { 44, 21, -3 }, { 44, 32, -2 },
+};
+
+const pfont_t font_status = {
+	16, 4, 32, 121, font_status_map,
+	font_status_glyphs, font_status_kern, 101, font_status_data
+};
+
+#endif
@@ -0,0 +1,255 @@
+/*
+ * font_temp: 14 proportional glyphs 32 pixels high, 4 bpp
+ * from ../fonts/font_12x16.h (scale 2)
+ * generated by CH32V003/fonts/pfontc.py, do not edit
+ */
+
+#ifndef _FONT_TEMP_H
+#define _FONT_TEMP_H
+
+#ifndef _PFONT_TYPES
+#define _PFONT_TYPES
+
+#include <stdint.h>
+#include <stddef.h>
+
+typedef struct {
+	uint16_t offset;		// first byte in the data
+	uint8_t width;			// columns in the data
+	uint8_t advance;		// where the next glyph starts
+} pfont_glyph_t;
+
+typedef struct {
+	uint8_t left, right;	// glyphs, sorted by left and then right
+	int8_t dx;				// added to the advance of left
+} pfont_kern_t;
+
+typedef struct {
+	uint8_t height;			// rows in each glyph
+	uint8_t bpp;			// 1: pages of column bytes, 4: runs of level<<4 | (n-1)
+	uint8_t first, last;	// character codes
+	const uint8_t *map;		// glyph of each code from first, NULL if in order
+	const pfont_glyph_t *glyphs;
+	const pfont_kern_t *kern;
+	uint16_t nkern;
+	const uint8_t *data;
+} pfont_t;
+
+/*
+ * glyph for a character, characters not in the font use the space (0)
+ */
+static inline uint8_t pfont_glyph(const pfont_t *font, uint8_t c)
+{
+	if((c < font->first) || (c > font->last))
+		return 0;
+	return font->map ? font->map[c - font->first] : c - font->first;
+}
+
+/*
+ * kerning between two glyphs (binary search)
+ */
+static inline int8_t pfont_kern(const pfont_t *font, uint8_t left, uint8_t right)
+{
+	uint16_t lo = 0, hi = font->nkern;
+	uint16_t key = (left << 8) | right;
+
+	while(lo < hi)
+	{
+		uint16_t mid = (lo + hi) >> 1;
+		const pfont_kern_t *k = &font->kern[mid];
+		uint16_t v = (k->left << 8) | k->right;
+		if(v == key)
+			return k->dx;
+		if(v < key)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+	return 0;
+}
+
+/*
+ * width in pixels of a string, from the first to the last column drawn
+ */
+static inline int16_t pfont_width(const pfont_t *font, const char *str)
+{
+	int16_t w = 0;
+	uint8_t g, prev = 0xFF;
+
+	while(*str)
+	{
+		g = pfont_glyph(font, *str++);
+		if(prev != 0xFF)
+			w += font->glyphs[prev].advance + pfont_kern(font, prev, g);
+		prev = g;
+	}
+	if(prev != 0xFF)
+		w += font->glyphs[prev].width;
+	return w;
+}
+
+#endif
+
+// glyph for each character code
+const uint8_t font_temp_map[] = {
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x00,
+	0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x0D,
+};
+
+const uint8_t font_temp_data[] = {
+	/* 0 ' ' */
+	/* 1 '-' */
+	0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x30, 0xB0,
+	0xFB, 0xB0, 0x30, 0xB0, 0xFD, 0xB1, 0xFD, 0xB0, 0x30, 0xB0, 0xFB, 0xB0, 0x30, 0x0F, 0x0F, 0x0F,
+	0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+	/* 2 '.' */
+	0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x03, 0x30, 0xB0, 0xF1, 0xB0, 0x30, 0xB0, 0xF3,
+	0xB0, 0xFB, 0xB0, 0xF3, 0xB0, 0x30, 0xB0, 0xF1, 0xB0, 0x30, 0x0F, 0x07,
+	/* 3 '0' */
+	0x05, 0x40, 0xB0, 0xF5, 0xB0, 0x40, 0x09, 0x40, 0xB0, 0xF9, 0xB0, 0x40, 0x05, 0x30, 0xB0, 0xFD,
+	0xB0, 0x30, 0x03, 0xB0, 0xFF, 0xB0, 0x02, 0x40, 0xF3, 0xB0, 0x40, 0x05, 0x40, 0xC0, 0xF3, 0x40,
+	0x01, 0xB0, 0xF2, 0x50, 0x08, 0x40, 0xF3, 0xB0, 0x00, 0x40, 0xF2, 0xB0, 0x09, 0x40, 0xF4, 0x40,
+	0xB0, 0xF2, 0x40, 0x09, 0xB0, 0xF4, 0xB0, 0xF3, 0x09, 0x50, 0xFA, 0x08, 0xA0, 0xFB, 0x07, 0x50,
+	0xF1, 0xC0, 0x40, 0x50, 0xF7, 0x06, 0xA0, 0xF2, 0x40, 0x01, 0xF7, 0x05, 0x50, 0xF2, 0xA0, 0x02,
+	0xF7, 0x04, 0xA0, 0xF2, 0x50, 0x03, 0xF7, 0x03, 0x50, 0xF2, 0xA0, 0x04, 0xF7, 0x02, 0xA0, 0xF2,
+	0x50, 0x05, 0xF7, 0x01, 0x40, 0xF2, 0xA0, 0x06, 0xF7, 0x50, 0x40, 0xC0, 0xF1, 0x50, 0x07, 0xFB,
+	0xA0, 0x08, 0xFA, 0x50, 0x09, 0xF3, 0xB0, 0xF4, 0xB0, 0x09, 0x40, 0xF2, 0xB0, 0x40, 0xF4, 0x40,
+	0x09, 0xB0, 0xF2, 0x40, 0x00, 0xB0, 0xF3, 0x40, 0x08, 0x50, 0xF2, 0xB0, 0x01, 0x40, 0xF3, 0xC0,
+	0x40, 0x05, 0x40, 0xB0, 0xF3, 0x40, 0x02, 0xB0, 0xFF, 0xB0, 0x03, 0x30, 0xB0, 0xFD, 0xB0, 0x30,
+	0x05, 0x40, 0xB0, 0xF9, 0xB0, 0x40, 0x09, 0x40, 0xB0, 0xF5, 0xB0, 0x40, 0x0F, 0x0F, 0x0F, 0x0F,
+	0x0F, 0x0D,
+	/* 4 '1' */
+	0x05, 0x40, 0xB1, 0x30, 0x0A, 0xA0, 0xF2, 0xB0, 0x09, 0x50, 0xF4, 0x07, 0x40, 0xB0, 0xF5, 0x05,
+	0x30, 0xB0, 0xF7, 0x05, 0xB0, 0xF8, 0x05, 0xB0, 0xF8, 0x05, 0x30, 0xB0, 0xF7, 0x09, 0x40, 0xC0,
+	0xF3, 0x0A, 0x40, 0xF3, 0x0B, 0xF3, 0x0B, 0xF3, 0x0B, 0xF3, 0x0B, 0xF3, 0x0B, 0xF3, 0x0B, 0xF3,
+	0x0B, 0xF3, 0x0B, 0xF3, 0x0B, 0xF3, 0x0B, 0xF3, 0x0B, 0xF3, 0x0B, 0xF3, 0x0A, 0x40, 0xF3, 0x40,
+	0x08, 0x40, 0xC0, 0xF3, 0xC0, 0x40, 0x03, 0x30, 0xB0, 0xFB, 0xB0, 0x30, 0xB0, 0xFD, 0xB1, 0xFD,
+	0xB0, 0x30, 0xB0, 0xFB, 0xB0, 0x30, 0x0F, 0x0F, 0x0F, 0x0F,
+	/* 5 '2' */
+	0x03, 0x40, 0xB0, 0xF9, 0xB0, 0x40, 0x06, 0xA0, 0xFD, 0xA0, 0x04, 0x50, 0xFF, 0x50, 0x02, 0xA0,
+	0xFF, 0xF1, 0xA0, 0x00, 0x40, 0xF4, 0xB0, 0x40, 0x05, 0x40, 0xB0, 0xF4, 0x40, 0xB0, 0xF3, 0x50,
+	0x09, 0x40, 0xC0, 0xF2, 0xB0, 0xF3, 0xB0, 0x0B, 0x40, 0xF7, 0x40, 0x0B, 0x40, 0xF3, 0xB0, 0xF1,
+	0xB0, 0x0B, 0x40, 0xC0, 0xF2, 0xB0, 0x30, 0xB1, 0x30, 0x0A, 0xA0, 0xF4, 0x40, 0x0D, 0x50, 0xF4,
+	0xA0, 0x0D, 0xA0, 0xF4, 0x50, 0x0D, 0x50, 0xF4, 0xA0, 0x0D, 0xA0, 0xF4, 0x50, 0x0D, 0x50, 0xF4,
+	0xA0, 0x0D, 0xA0, 0xF4, 0x50, 0x0D, 0x50, 0xF4, 0xA0, 0x0D, 0xA0, 0xF4, 0x50, 0x0D, 0x50, 0xF4,
+	0xA0, 0x0D, 0xA0, 0xF4, 0x50, 0x0D, 0x50, 0xF4, 0xA0, 0x0D, 0xA0, 0xF3, 0xC0, 0x40, 0x0D, 0x50,
+	0xF4, 0x40, 0x0D, 0xA0, 0xF5, 0x50, 0x0C, 0x40, 0xFF, 0xF2, 0xB0, 0x30, 0xB0, 0xFF, 0xF3, 0xB1,
+	0xFF, 0xF3, 0xB0, 0x30, 0xB0, 0xFF, 0xF1, 0xB0, 0x30, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x07,
+	/* 6 '3' */
+	0x03, 0x40, 0xB0, 0xF9, 0xB0, 0x40, 0x06, 0xA0, 0xFD, 0xA0, 0x04, 0x50, 0xFF, 0x50, 0x02, 0xA0,
+	0xFF, 0xF1, 0xA0, 0x00, 0x40, 0xF4, 0xB0, 0x40, 0x05, 0x40, 0xB0, 0xF4, 0x40, 0xB0, 0xF3, 0x50,
+	0x09, 0x50, 0xF3, 0xB1, 0xF2, 0xA0, 0x0B, 0xB0, 0xF3, 0x30, 0xB1, 0x40, 0x0C, 0x40, 0xF3, 0x0F,
+	0x00, 0x40, 0xF3, 0x0F, 0x00, 0xB0, 0xF3, 0x0F, 0x50, 0xF3, 0xB0, 0x0D, 0x40, 0xB0, 0xF4, 0x40,
+	0x05, 0x30, 0xB0, 0xFB, 0xA0, 0x06, 0xB0, 0xFA, 0xC0, 0x40, 0x07, 0xB0, 0xFA, 0x40, 0x08, 0x30,
+	0xB0, 0xF9, 0x40, 0x0F, 0x00, 0x40, 0xB0, 0xF1, 0xC0, 0x40, 0x0F, 0x01, 0x50, 0xF2, 0xA0, 0x0F,
+	0x01, 0xB0, 0xF2, 0x40, 0x0F, 0x00, 0x40, 0xF2, 0xB0, 0x30, 0xB1, 0x40, 0x0C, 0x40, 0xF3, 0xB0,
+	0xF2, 0xA0, 0x0B, 0xB0, 0xF3, 0xB0, 0xF3, 0x50, 0x09, 0x50, 0xF3, 0xB0, 0x40, 0xF4, 0xB0, 0x40,
+	0x05, 0x40, 0xB0, 0xF4, 0x40, 0x00, 0xA0, 0xFF, 0xF1, 0xA0, 0x02, 0x50, 0xFF, 0x50, 0x04, 0xA0,
+	0xFD, 0xA0, 0x06, 0x40, 0xB0, 0xF9, 0xB0, 0x40, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0B,
+	/* 7 '4' */
+	0x0B, 0x40, 0xB0, 0xF1, 0xB0, 0x30, 0x0E, 0xA0, 0xF4, 0xB0, 0x0D, 0x50, 0xF6, 0x0C, 0xA0, 0xF7,
+	0x0B, 0x50, 0xF8, 0x0A, 0xA0, 0xF9, 0x09, 0x50, 0xF3, 0xC0, 0x40, 0x50, 0xF3, 0x08, 0xA0, 0xF4,
+	0x40, 0x01, 0xF3, 0x07, 0x50, 0xF4, 0xA0, 0x02, 0xF3, 0x06, 0xA0, 0xF4, 0x50, 0x03, 0xF3, 0x05,
+	0x50, 0xF4, 0xA0, 0x04, 0xF3, 0x04, 0xA0, 0xF4, 0x50, 0x05, 0xF3, 0x03, 0x40, 0xF4, 0xA0, 0x06,
+	0xF3, 0x03, 0xB0, 0xF2, 0xC0, 0x40, 0x07, 0xF3, 0x03, 0xF3, 0x40, 0x07, 0x40, 0xF3, 0x40, 0x02,
+	0xF3, 0x50, 0x06, 0x40, 0xC0, 0xF3, 0xC0, 0x40, 0x01, 0xFF, 0xF3, 0xB0, 0x30, 0xFF, 0xF4, 0xB1,
+	0xFF, 0xF3, 0xB0, 0x30, 0xB0, 0xFF, 0xF1, 0xB0, 0x30, 0x0B, 0x40, 0xC0, 0xF3, 0xC0, 0x40, 0x0E,
+	0x40, 0xF3, 0x40, 0x0F, 0x00, 0xF3, 0x0F, 0x01, 0xF3, 0x0F, 0x01, 0xF3, 0x0F, 0x01, 0xF3, 0x0F,
+	0x01, 0xB0, 0xF1, 0xB0, 0x0F, 0x01, 0x30, 0xB1, 0x30, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0B,
+	/* 8 '5' */
+	0x30, 0xB0, 0xFF, 0xF1, 0xB0, 0x30, 0xB0, 0xFF, 0xF3, 0xB0, 0xFF, 0xF4, 0xB0, 0xFF, 0xF3, 0xB0,
+	0x30, 0xF3, 0xC0, 0x40, 0x0F, 0xF3, 0x40, 0x0F, 0x00, 0xF3, 0x0F, 0x01, 0xF3, 0x0F, 0x01, 0xF3,
+	0x40, 0x0F, 0x00, 0xF3, 0xC0, 0x40, 0x0F, 0xB0, 0xFE, 0xB0, 0x40, 0x03, 0x40, 0xFF, 0xF0, 0xA0,
+	0x03, 0xA0, 0xFF, 0xF0, 0x50, 0x03, 0x40, 0xB0, 0xFF, 0xA0, 0x0E, 0x40, 0xB0, 0xF4, 0x40, 0x0F,
+	0x50, 0xF3, 0xB0, 0x0F, 0x00, 0xB0, 0xF3, 0x0F, 0x00, 0x40, 0xF3, 0x0F, 0x01, 0xF3, 0x0F, 0x01,
+	0xF3, 0x30, 0xB1, 0x40, 0x0C, 0x40, 0xF3, 0xB0, 0xF2, 0xA0, 0x0B, 0xB0, 0xF3, 0xB0, 0xF3, 0x50,
+	0x09, 0x50, 0xF3, 0xB0, 0x40, 0xF4, 0xB0, 0x40, 0x05, 0x40, 0xB0, 0xF4, 0x40, 0x00, 0xA0, 0xFF,
+	0xF1, 0xA0, 0x02, 0x50, 0xFF, 0x50, 0x04, 0xA0, 0xFD, 0xA0, 0x06, 0x40, 0xB0, 0xF9, 0xB0, 0x40,
+	0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0B,
+	/* 9 '6' */
+	0x09, 0x40, 0xB0, 0xF3, 0xB0, 0x30, 0x0C, 0xA0, 0xF6, 0xB0, 0x0B, 0x50, 0xF7, 0xB0, 0x0A, 0xA0,
+	0xF7, 0xB0, 0x30, 0x09, 0x50, 0xF4, 0xB0, 0x40, 0x0C, 0xA0, 0xF4, 0x50, 0x0D, 0x50, 0xF4, 0xA0,
+	0x0D, 0xA0, 0xF4, 0x50, 0x0D, 0x40, 0xF4, 0xA0, 0x0E, 0xB0, 0xF2, 0xC0, 0x40, 0x0E, 0x40, 0xF3,
+	0x40, 0x0F, 0xB0, 0xF3, 0x50, 0x0E, 0x40, 0xFE, 0xB0, 0x40, 0x03, 0xB0, 0xFF, 0xF0, 0xA0, 0x02,
+	0xFF, 0xF2, 0x50, 0x01, 0xFF, 0xF3, 0xA0, 0x00, 0xF5, 0xB0, 0x40, 0x05, 0x40, 0xB0, 0xF4, 0x40,
+	0xF4, 0x50, 0x09, 0x50, 0xF3, 0xB0, 0xF3, 0xB0, 0x0B, 0xB0, 0xF7, 0x40, 0x0B, 0x40, 0xF7, 0x40,
+	0x0B, 0x40, 0xF7, 0xB0, 0x0B, 0xB0, 0xF3, 0xB0, 0xF3, 0x50, 0x09, 0x50, 0xF3, 0xB0, 0x40, 0xF4,
+	0xB0, 0x40, 0x05, 0x40, 0xB0, 0xF4, 0x40, 0x00, 0xA0, 0xFF, 0xF1, 0xA0, 0x02, 0x50, 0xFF, 0x50,
+	0x04, 0xA0, 0xFD, 0xA0, 0x06, 0x40, 0xB0, 0xF9, 0xB0, 0x40, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0B,
+	/* 10 '7' */
+	0x30, 0xB0, 0xFF, 0xF1, 0xB0, 0x30, 0xB0, 0xFF, 0xF3, 0xB1, 0xFF, 0xF3, 0xB0, 0x30, 0xB0, 0xFF,
+	0xF2, 0x40, 0x0D, 0x40, 0xC0, 0xF3, 0xB0, 0x0F, 0x40, 0xF3, 0x40, 0x0F, 0x40, 0xF2, 0xB0, 0x0F,
+	0x00, 0xB0, 0xF2, 0x40, 0x0F, 0x40, 0xF2, 0xB0, 0x0F, 0x00, 0xB0, 0xF2, 0x40, 0x0F, 0x40, 0xF2,
+	0xB0, 0x0F, 0x00, 0xB0, 0xF2, 0x40, 0x0F, 0x40, 0xF2, 0xB0, 0x0F, 0x00, 0xB0, 0xF2, 0x40, 0x0F,
+	0x40, 0xF2, 0xB0, 0x0F, 0x00, 0xB0, 0xF2, 0x40, 0x0F, 0x40, 0xF2, 0xB0, 0x0F, 0x00, 0xB0, 0xF2,
+	0x40, 0x0F, 0x40, 0xF2, 0xB0, 0x0F, 0x00, 0xB0, 0xF2, 0x40, 0x0F, 0x40, 0xF2, 0xB0, 0x0F, 0x00,
+	0xB0, 0xF2, 0x40, 0x0F, 0x40, 0xF2, 0xB0, 0x0F, 0x00, 0xB0, 0xF2, 0x40, 0x0F, 0x40, 0xF2, 0xB0,
+	0x0F, 0x00, 0xB0, 0xF2, 0x40, 0x0F, 0x00, 0xB0, 0xF1, 0xB0, 0x0F, 0x01, 0x30, 0xB1, 0x30, 0x0F,
+	0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x03,
+	/* 11 '8' */
+	0x05, 0x40, 0xB0, 0xF5, 0xB0, 0x40, 0x0A, 0xA0, 0xF9, 0xA0, 0x08, 0x50, 0xFB, 0x50, 0x06, 0xA0,
+	0xFD, 0xA0, 0x04, 0x40, 0xF4, 0xB0, 0x40, 0x01, 0x40, 0xB0, 0xF4, 0x40, 0x03, 0xB0, 0xF3, 0x50,
+	0x05, 0x50, 0xF3, 0xB0, 0x03, 0xF3, 0xB0, 0x07, 0xB0, 0xF3, 0x03, 0xF3, 0x40, 0x07, 0x40, 0xF3,
+	0x03, 0xF3, 0x40, 0x07, 0x40, 0xF3, 0x03, 0xF3, 0xB0, 0x07, 0xB0, 0xF3, 0x03, 0xB0, 0xF3, 0x50,
+	0x05, 0x50, 0xF3, 0xB0, 0x03, 0x30, 0xC0, 0xF3, 0xB0, 0x40, 0x01, 0x40, 0xB0, 0xF3, 0xC0, 0x30,
+	0x04, 0x40, 0xFD, 0x40, 0x05, 0x40, 0xFD, 0x40, 0x04, 0x40, 0xC0, 0xFD, 0xC0, 0x40, 0x02, 0xA0,
+	0xFF, 0xF1, 0xA0, 0x00, 0x40, 0xF4, 0xB0, 0x40, 0x05, 0x40, 0xB0, 0xF4, 0x40, 0xB0, 0xF3, 0x50,
+	0x09, 0x50, 0xF3, 0xB0, 0xF3, 0xB0, 0x0B, 0xB0, 0xF7, 0x40, 0x0B, 0x40, 0xF7, 0x40, 0x0B, 0x40,
+	0xF7, 0xB0, 0x0B, 0xB0, 0xF3, 0xB0, 0xF3, 0x50, 0x09, 0x50, 0xF3, 0xB0, 0x40, 0xF4, 0xB0, 0x40,
+	0x05, 0x40, 0xB0, 0xF4, 0x40, 0x00, 0xA0, 0xFF, 0xF1, 0xA0, 0x02, 0x50, 0xFF, 0x50, 0x04, 0xA0,
+	0xFD, 0xA0, 0x06, 0x40, 0xB0, 0xF9, 0xB0, 0x40, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0B,
+	/* 12 '9' */
+	0x03, 0x40, 0xB0, 0xF9, 0xB0, 0x40, 0x06, 0xA0, 0xFD, 0xA0, 0x04, 0x50, 0xFF, 0x50, 0x02, 0xA0,
+	0xFF, 0xF1, 0xA0, 0x00, 0x40, 0xF4, 0xB0, 0x40, 0x05, 0x40, 0xB0, 0xF4, 0x40, 0xB0, 0xF3, 0x50,
+	0x09, 0x50, 0xF3, 0xB0, 0xF3, 0xB0, 0x0B, 0xB0, 0xF7, 0x40, 0x0B, 0x40, 0xF7, 0x40, 0x0B, 0x40,
+	0xF7, 0xB0, 0x0B, 0xB0, 0xF3, 0xB0, 0xF3, 0x50, 0x09, 0x50, 0xF4, 0x40, 0xF4, 0xB0, 0x40, 0x05,
+	0x40, 0xB0, 0xF5, 0x00, 0xA0, 0xFF, 0xF3, 0x01, 0x50, 0xFF, 0xF2, 0x02, 0xA0, 0xFF, 0xF0, 0xB0,
+	0x03, 0x40, 0xB0, 0xFE, 0x40, 0x0E, 0x50, 0xF3, 0xB0, 0x0F, 0x40, 0xF3, 0x40, 0x0E, 0x40, 0xC0,
+	0xF2, 0xB0, 0x0E, 0xA0, 0xF4, 0x40, 0x0D, 0x50, 0xF4, 0xA0, 0x0D, 0xA0, 0xF4, 0x50, 0x0D, 0x50,
+	0xF4, 0xA0, 0x0C, 0x40, 0xB0, 0xF4, 0x50, 0x09, 0x30, 0xB0, 0xF7, 0xA0, 0x0A, 0xB0, 0xF7, 0x50,
+	0x0B, 0xB0, 0xF6, 0xA0, 0x0C, 0x30, 0xB0, 0xF3, 0xB0, 0x40, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+	0x01,
+	/* 13 'C' */
+	0x05, 0x40, 0xB0, 0xF5, 0xB0, 0x40, 0x08, 0xA0, 0xF9, 0xA0, 0x06, 0x50, 0xFB, 0x50, 0x04, 0xA0,
+	0xFD, 0xA0, 0x02, 0x40, 0xF4, 0xB0, 0x40, 0x01, 0x40, 0xB0, 0xF4, 0x40, 0x01, 0xB0, 0xF3, 0x50,
+	0x05, 0x50, 0xF3, 0xB0, 0x00, 0x40, 0xF3, 0xA0, 0x07, 0xA0, 0xF2, 0xB0, 0x00, 0xB0, 0xF2, 0x50,
+	0x09, 0x40, 0xB1, 0x30, 0x40, 0xF2, 0xB0, 0x0E, 0xB0, 0xF2, 0x40, 0x0E, 0xF3, 0x0F, 0xF3, 0x0F,
+	0xF3, 0x0F, 0xF3, 0x0F, 0xF3, 0x0F, 0xF3, 0x0F, 0xF3, 0x0F, 0xF3, 0x0F, 0xB0, 0xF2, 0x40, 0x0E,
+	0x40, 0xF2, 0xB0, 0x0F, 0xB0, 0xF2, 0x50, 0x09, 0x40, 0xB1, 0x30, 0x00, 0x40, 0xF3, 0xA0, 0x07,
+	0xA0, 0xF2, 0xB0, 0x01, 0xB0, 0xF3, 0x50, 0x05, 0x50, 0xF3, 0xB0, 0x01, 0x40, 0xF4, 0xB0, 0x40,
+	0x01, 0x40, 0xB0, 0xF4, 0x40, 0x02, 0xA0, 0xFD, 0xA0, 0x04, 0x50, 0xFB, 0x50, 0x06, 0xA0, 0xF9,
+	0xA0, 0x08, 0x40, 0xB0, 0xF5, 0xB0, 0x40, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x03,
+};
+
+const pfont_glyph_t font_temp_glyphs[] = {
+	{ 0, 0, 9 },	/* ' ' */
+	{ 0, 16, 18 },	/* '-' */
+	{ 43, 6, 8 },	/* '.' */
+	{ 71, 22, 24 },	/* '0' */
+	{ 249, 16, 18 },	/* '1' */
+	{ 339, 22, 24 },	/* '2' */
+	{ 482, 22, 24 },	/* '3' */
+	{ 640, 22, 24 },	/* '4' */
+	{ 783, 22, 24 },	/* '5' */
+	{ 917, 22, 24 },	/* '6' */
+	{ 1061, 22, 24 },	/* '7' */
+	{ 1195, 22, 24 },	/* '8' */
+	{ 1369, 22, 24 },	/* '9' */
+	{ 1514, 20, 22 },	/* 'C' */
+};
+
+const pfont_kern_t font_temp_kern[] = {
+	{ 1, 4, -6 }, { 1, 5, -7 }, { 1, 6, -6 }, { 1, 8, -4 }, { 1, 10, -8 }, { 2, 7, -8 },
+	{ 2, 10, -6 }, { 2, 12, -4 }, { 4, 1, -6 }, { 4, 7, -6 }, { 4, 10, -6 }, { 4, 12, -4 },
+	{ 5, 1, -5 }, { 7, 2, -4 }, { 7, 4, -4 }, { 7, 5, -4 }, { 7, 10, -4 }, { 7, 12, -4 },
+	{ 9, 10, -4 }, { 9, 12, -4 }, { 10, 1, -6 }, { 10, 2, -8 }, { 10, 7, -5 }, { 10, 9, -5 },
+	{ 12, 2, -5 }, { 13, 1, -8 },
+};
+
+const pfont_t font_temp = {
+	32, 4, 32, 67, font_temp_map,
+	font_temp_glyphs, font_temp_kern, 26, font_temp_data
+};
+
+#endif
@@ -0,0 +1,445 @@
+/*
+ * Simulador da tela ST7789 (320x172, RGB565) para testar o texto com
+ * anti-aliasing de pfont_aa.h no PC
+ *
+ * Desenha algumas cenas com as fontes dos exemplos e salva as imagens,
+ * ou compara com imagens salvas antes (imagens de referência).
+ *
+ * Compilar: gcc -O2 -Wall -o lcdsim lcdsim.c
+ * Usar:     ./lcdsim -w dir    salva as imagens em PPM e PNG (2:1) em dir
+ *           ./lcdsim -c dir    compara com as imagens PPM em dir
+ *           ./lcdsim -b        compara com o desenho pixel a pixel
+ *                              (imagem, bytes no SPI e tempo)
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "../Zigbee_Thermostat/font_status.h"
+#include "../Zigbee_Thermostat/font_temp.h"
+#include "../Demo/font_title.h"
+#include "../Zigbee_Thermostat/pfont_aa.h"
+#include "../Zigbee_Thermostat/ui_fields.h"
+
+#define LARG 320
+#define ALT  172
+
+#define cor565(r,g,b) ((r<<11)|(g<<5)|b)
+#define FUNDO   cor565(14,28,14)
+#define TEXTO   cor565(0,0,0)
+
+uint16_t tela[ALT][LARG];
+
+// Janela atual do display e contadores
+int16_t jx, jy, jw, jh, cx, cy;
+uint32_t bytes_spi, chamadas;
+
+void sim_window(int16_t x, int16_t y, int16_t w, int16_t h) {
+  jx = x; jy = y; jw = w; jh = h;
+  cx = 0; cy = 0;
+  bytes_spi += 11;    // CASET, RASET e RAMWR com os parâmetros
+  chamadas++;
+}
+
+void sim_run(uint16_t cor, uint16_t n) {
+  bytes_spi += 2*n;
+  chamadas++;
+  while (n--) {
+    if ((cy < jh) && (jx+cx < LARG) && (jy+cy < ALT)) {
+      tela[jy+cy][jx+cx] = cor;
+    }
+    if (++cx == jw) {
+      cx = 0;
+      cy++;
+    }
+  }
+}
+
+const pfont_aa_sink_t sim = { LARG, ALT, sim_window, sim_run };
+
+void fill_rect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t cor) {
+  for (int16_t i = y; i < y+h; i++) {
+    for (int16_t j = x; j < x+w; j++) {
+      if ((i >= 0) && (i < ALT) && (j >= 0) && (j < LARG)) {
+        tela[i][j] = cor;
+      }
+    }
+  }
+}
+
+/*
+ * Referência: expande cada glyph inteiro e desenha pixel a pixel,
+ * como drawPixel da Adafruit_GFX
+ */
+int16_t ref_drawstr(const pfont_aa_sink_t *sink, const pfont_t *font,
+                    int16_t x, int16_t y, const char *str,
+                    uint16_t fg, uint16_t bg) {
+  static uint8_t nivel[64][PFONT_AA_MAX_W];
+  int16_t w = 0, wmax = 0, gw;
+  uint8_t g, ant = 0xFF, n = 0;
+
+  memset(nivel, 0, sizeof(nivel));
+  while (*str && (n < PFONT_AA_MAX_CHARS)) {
+    g = pfont_glyph(font, *str++);
+    const pfont_glyph_t *pg = &font->glyphs[g];
+    gw = w;
+    if (ant != 0xFF) {
+      gw += pfont_kern(font, ant, g);
+      if (gw < 0) {
+        gw = 0;
+      }
+    }
+    if (gw + pg->advance > PFONT_AA_MAX_W) {
+      break;
+    }
+    // expande as sequências
+    const uint8_t *p = &font->data[pg->offset];
+    int total = pg->width * font->height, k = 0;
+    while (k < total) {
+      uint8_t b = *p++;
+      for (int j = 0; j <= (b & 0x0F); j++, k++) {
+        uint8_t *d = &nivel[k / pg->width][gw + k % pg->width];
+        if (*d < (b >> 4)) {
+          *d = b >> 4;
+        }
+      }
+    }
+    w = gw + pg->advance;
+    if (gw + pg->width > wmax) {
+      wmax = gw + pg->width;
+    }
+    ant = g;
+    n++;
+  }
+  if (wmax > w) {
+    w = wmax;
+  }
+  for (int16_t i = 0; i < font->height; i++) {
+    for (int16_t j = 0; j < w; j++) {
+      if ((x+j >= 0) && (x+j < sink->width) && (y+i >= 0) && (y+i < sink->height)) {
+        sink->window(x+j, y+i, 1, 1);
+        sink->run(pfont_aa_blend(fg, bg, nivel[i][j]), 1);
+      }
+    }
+  }
+  return x + w;
+}
+
+typedef int16_t (*drawstr_t)(const pfont_aa_sink_t *sink, const pfont_t *font,
+                             int16_t x, int16_t y, const char *str,
+                             uint16_t fg, uint16_t bg);
+
+drawstr_t drawstr = pfont_aa_drawstr;
+
+/*
+ * Cenas
+ */
+
+// Tela do exemplo Demo
+void cena_demo(void) {
+  const char *titulo = "DQSoft";
+  fill_rect(0, 0, LARG, ALT, cor565(2,4,24));
+  fill_rect(75, 60, 164, 48, cor565(15,31,15));
+  drawstr(&sim, &font_title, 75 + (164 - pfont_width(&font_title, titulo))/2, 68,
+          titulo, cor565(4,4,16), cor565(15,31,15));
+}
+
+// Tela do exemplo Zigbee_Thermostat, a segunda mensagem menor que a anterior
+void cena_termostato(void) {
+  fill_rect(0, 0, LARG, ALT, FUNDO);
+  drawstr(&sim, &font_status, 30, 30, "Ready", TEXTO, FUNDO);
+  int16_t x = drawstr(&sim, &font_status, 30, 60, "Opening Network", TEXTO, FUNDO);
+  x = drawstr(&sim, &font_status, 30, 60, "Connected", TEXTO, FUNDO);
+  fill_rect(x, 60, 280 - x, font_status.height, FUNDO);
+  drawstr(&sim, &font_temp, 30, 100, "23.50C", TEXTO, FUNDO);
+}
+
+// Pares com kerning e cores
+void cena_kerning(void) {
+  fill_rect(0, 0, LARG, ALT, cor565(0,0,0));
+  drawstr(&sim, &font_status, 4, 4, "Temperature sensor value", cor565(31,63,31), cor565(0,0,0));
+  drawstr(&sim, &font_status, 4, 24, "Loop temperature info", cor565(31,40,0), cor565(4,8,20));
+  drawstr(&sim, &font_temp, 4, 50, "17.71C -4.0C", cor565(0,63,0), cor565(0,0,0));
+  drawstr(&sim, &font_temp, 4, 90, "1.1.1.1", cor565(31,0,0), cor565(31,63,31));
+  drawstr(&sim, &font_title, 4, 130, "oSQDft", cor565(31,63,31), cor565(8,16,8));
+}
+
+// Strings cortadas nas bordas
+void cena_recorte(void) {
+  fill_rect(0, 0, LARG, ALT, FUNDO);
+  drawstr(&sim, &font_temp, -20, -10, "12.34C", TEXTO, FUNDO);
+  drawstr(&sim, &font_temp, 200, 60, "56.78C", TEXTO, FUNDO);
+  drawstr(&sim, &font_status, 100, 160, "Waiting for sensor", TEXTO, FUNDO);
+  drawstr(&sim, &font_title, -300, 100, "DQSoft", TEXTO, FUNDO);
+}
+
+// Campo da temperatura como no Zigbee_Thermostat, com células de largura fixa
+#define CELULA 24
+
+void celula(int16_t x, int16_t y, char c) {
+  char s[2] = { c, 0 };
+  int16_t x0 = x + (CELULA - pfont_width(&font_temp, s)) / 2;
+  int16_t x1 = drawstr(&sim, &font_temp, x0, y, s, TEXTO, FUNDO);
+  fill_rect(x, y, x0 - x, font_temp.height, FUNDO);
+  fill_rect(x1, y, x + CELULA - x1, font_temp.height, FUNDO);
+}
+
+const ui_backend_t celulas = { celula };
+
+// Temperaturas em sequência; só os dígitos que mudam são redesenhados
+void cena_campos(void) {
+  ui_field_t temp = UI_FIELD(&celulas, 30, 100, CELULA, 6);
+  ui_field_t unid = UI_FIELD(&celulas, 30 + 6*CELULA, 100, CELULA, 1);
+  ui_field_t outro = UI_FIELD(&celulas, 30, 20, CELULA, 6);
+
+  fill_rect(0, 0, LARG, ALT, FUNDO);
+  ui_text(&unid, "C");
+  ui_number(&temp, 2350, 2, 0);
+  ui_number(&temp, 2351, 2, 0);
+  ui_number(&temp, 985, 2, 0);
+  ui_number(&outro, 123, 2, 0);
+  ui_number(&outro, -1234, 2, 0);
+}
+
+typedef struct {
+  const char *nome;
+  void (*desenha)(void);
+} cena_t;
+
+const cena_t cenas[] = {
+  { "demo", cena_demo },
+  { "termostato", cena_termostato },
+  { "kerning", cena_kerning },
+  { "recorte", cena_recorte },
+  { "campos", cena_campos },
+};
+
+#define NCENAS (sizeof(cenas)/sizeof(cenas[0]))
+
+/*
+ * Arquivos de imagem
+ */
+void rgb(uint16_t c, uint8_t *p) {
+  p[0] = ((c >> 11) * 255 + 15) / 31;
+  p[1] = (((c >> 5) & 0x3F) * 255 + 31) / 63;
+  p[2] = ((c & 0x1F) * 255 + 15) / 31;
+}
+
+int salva_ppm(const char *nome) {
+  FILE *f = fopen(nome, "wb");
+  uint8_t p[3];
+  if (!f) {
+    return 1;
+  }
+  fprintf(f, "P6\n%d %d\n255\n", LARG, ALT);
+  for (int y = 0; y < ALT; y++) {
+    for (int x = 0; x < LARG; x++) {
+      rgb(tela[y][x], p);
+      fwrite(p, 1, 3, f);
+    }
+  }
+  fclose(f);
+  return 0;
+}
+
+// retorna o número de pixels diferentes, -1 se não conseguir ler
+int compara_ppm(const char *nome) {
+  int w, h, max, dif = 0;
+  uint8_t p[3], q[3];
+  FILE *f = fopen(nome, "rb");
+  if (!f) {
+    return -1;
+  }
+  if ((fscanf(f, "P6 %d %d %d", &w, &h, &max) != 3) ||
+      (w != LARG) || (h != ALT) || (fgetc(f) == EOF)) {
+    fclose(f);
+    return -1;
+  }
+  for (int y = 0; y < ALT; y++) {
+    for (int x = 0; x < LARG; x++) {
+      if (fread(q, 1, 3, f) != 3) {
+        fclose(f);
+        return -1;
+      }
+      rgb(tela[y][x], p);
+      if (memcmp(p, q, 3)) {
+        dif++;
+      }
+    }
+  }
+  fclose(f);
+  return dif;
+}
+
+uint32_t crc32(uint32_t crc, const uint8_t *p, uint32_t n) {
+  crc = ~crc;
+  while (n--) {
+    crc ^= *p++;
+    for (int k = 0; k < 8; k++) {
+      crc = (crc >> 1) ^ (0xEDB88320 & -(crc & 1));
+    }
+  }
+  return ~crc;
+}
+
+void be32(uint8_t *p, uint32_t v) {
+  p[0] = v >> 24;
+  p[1] = v >> 16;
+  p[2] = v >> 8;
+  p[3] = v;
+}
+
+void chunk(FILE *f, const char *tipo, const uint8_t *dados, uint32_t n) {
+  uint8_t b[4];
+  be32(b, n);
+  fwrite(b, 1, 4, f);
+  fwrite(tipo, 1, 4, f);
+  fwrite(dados, 1, n, f);
+  be32(b, crc32(crc32(0, (const uint8_t *)tipo, 4), dados, n));
+  fwrite(b, 1, 4, f);
+}
+
+// PNG RGB sem compressão, cada pixel vira 2x2
+int salva_png(const char *nome) {
+  static const uint8_t sig[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+  uint32_t w = 2*LARG, h = 2*ALT;
+  uint32_t linha = 3*w + 1;
+  uint32_t tam = 2 + h*(5 + linha) + 4;
+  uint8_t *z = malloc(tam), *p;
+  uint8_t ihdr[13];
+  uint32_t a = 1, b = 0;
+  FILE *f;
+
+  if (!z) {
+    return 1;
+  }
+  f = fopen(nome, "wb");
+  if (!f) {
+    free(z);
+    return 1;
+  }
+  p = z;
+  *p++ = 0x78;
+  *p++ = 0x01;
+  for (uint32_t y = 0; y < h; y++) {
+    uint8_t *ini;
+    *p++ = (y == h-1);
+    *p++ = linha & 0xFF;
+    *p++ = linha >> 8;
+    *p++ = ~linha & 0xFF;
+    *p++ = (~linha >> 8) & 0xFF;
+    ini = p;
+    *p++ = 0;
+    for (uint32_t x = 0; x < w; x++, p += 3) {
+      rgb(tela[y/2][x/2], p);
+    }
+    for (uint8_t *q = ini; q < p; q++) {
+      a = (a + *q) % 65521;
+      b = (b + a) % 65521;
+    }
+  }
+  be32(p, (b << 16) | a);
+
+  be32(ihdr, w);
+  be32(ihdr+4, h);
+  ihdr[8] = 8;      // bits por componente
+  ihdr[9] = 2;      // RGB
+  ihdr[10] = ihdr[11] = ihdr[12] = 0;
+
+  fwrite(sig, 1, 8, f);
+  chunk(f, "IHDR", ihdr, 13);
+  chunk(f, "IDAT", z, tam);
+  chunk(f, "IEND", NULL, 0);
+  fclose(f);
+  free(z);
+  return 0;
+}
+
+/*
+ * Compara com o desenho pixel a pixel
+ */
+double tempo(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+int bench(void) {
+  static uint16_t ref[ALT][LARG];
+  int erros = 0;
+
+  printf("%-12s %10s %10s %10s %10s %8s\n", "cena", "bytes ref", "bytes", "cham. ref", "chamadas", "tempo");
+  for (unsigned i = 0; i < NCENAS; i++) {
+    uint32_t b_ref, c_ref, b, c;
+    double t_ref, t;
+    int vezes = 200;
+
+    drawstr = ref_drawstr;
+    bytes_spi = chamadas = 0;
+    cenas[i].desenha();
+    b_ref = bytes_spi;
+    c_ref = chamadas;
+    memcpy(ref, tela, sizeof(tela));
+    t_ref = tempo();
+    for (int k = 0; k < vezes; k++) {
+      cenas[i].desenha();
+    }
+    t_ref = tempo() - t_ref;
+
+    drawstr = pfont_aa_drawstr;
+    bytes_spi = chamadas = 0;
+    cenas[i].desenha();
+    b = bytes_spi;
+    c = chamadas;
+    t = tempo();
+    for (int k = 0; k < vezes; k++) {
+      cenas[i].desenha();
+    }
+    t = tempo() - t;
+
+    if (memcmp(ref, tela, sizeof(tela))) {
+      printf("%-12s imagens diferentes!\n", cenas[i].nome);
+      erros++;
+      continue;
+    }
+    printf("%-12s %10u %10u %10u %10u %7.1fx\n", cenas[i].nome,
+           b_ref, b, c_ref, c, t_ref / t);
+  }
+  return erros;
+}
+
+int main(int argc, char *argv[]) {
+  char nome[300];
+  int erros = 0;
+
+  if ((argc == 2) && (strcmp(argv[1], "-b") == 0)) {
+    return bench() ? 1 : 0;
+  }
+  if ((argc != 3) || ((strcmp(argv[1], "-w") != 0) && (strcmp(argv[1], "-c") != 0))) {
+    printf("uso: %s -w|-c dir\n     %s -b\n", argv[0], argv[0]);
+    return 2;
+  }
+  for (unsigned i = 0; i < NCENAS; i++) {
+    cenas[i].desenha();
+    if (argv[1][1] == 'w') {
+      snprintf(nome, sizeof(nome), "%s/%s.ppm", argv[2], cenas[i].nome);
+      erros += salva_ppm(nome);
+      snprintf(nome, sizeof(nome), "%s/%s.png", argv[2], cenas[i].nome);
+      erros += salva_png(nome);
+    } else {
+      snprintf(nome, sizeof(nome), "%s/%s.ppm", argv[2], cenas[i].nome);
+      int dif = compara_ppm(nome);
+      if (dif) {
+        erros++;
+      }
+      if (dif < 0) {
+        printf("%-12s sem imagem\n", cenas[i].nome);
+      } else {
+        printf("%-12s %s (%d pixels diferentes)\n", cenas[i].nome, dif ? "ERRO" : "ok", dif);
+      }
+    }
+  }
+  return erros ? 1 : 0;
+}
@@ -15,6 +15,8 @@
 #include <WiFiUdp.h>
 #include <NTPClient.h>
 
+#include "ui_fields.h"
+
 #include "secrets.h"
 char ssid[] = SECRET_SSID;
 char pass[] = SECRET_PASS;
@@ -24,6 +26,13 @@ int status = WL_IDLE_STATUS;
 WiFiUDP ntpUDP;
 NTPClient timeClient(ntpUDP, -3*60*60);
 
+// Campos de texto no LCD: só os caracteres que mudam são redesenhados
+void celulaLCD(int16_t x, int16_t y, char c) {
+  Display_chr(c, y/16, x/8);
+}
+const ui_backend_t lcd = { celulaLCD };
+ui_field_t campoHora = UI_FIELD(&lcd, 0, 3*16, 8, 8);
+
 // Iniciação
 void setup() {
   // Inicia serial
@@ -82,7 +91,7 @@ void setup() {
 void loop() {
   timeClient.update();
   String hora = timeClient.getFormattedTime();  // hh:mm:ss
-  Display_str ((char *)hora.c_str(), 3, 0);
+  ui_text (&campoHora, hora.c_str());   // em geral muda um só dígito
   Display_update ();
   delay(1000);
 }
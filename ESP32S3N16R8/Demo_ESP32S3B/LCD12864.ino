@@ -55,6 +55,11 @@ SPISettings SPI_CONFIG(10000000, MSBFIRST, SPI_MODE3);
 // Screen buffer
 uint8_t *screenbuf;
 
+// Changed columns in each page, from dirtyFirst to dirtyLast
+// (dirtyFirst > dirtyLast when the page did not change)
+uint8_t dirtyFirst[LCD_HEIGHT/8];
+uint8_t dirtyLast[LCD_HEIGHT/8];
+
 // Display initialization commands
 byte cmdInit[] =
 {
@@ -209,31 +214,49 @@ void Display_init()
   Display_sendcmd (cmdInit, sizeof(cmdInit)/2);
   screenbuf = (uint8_t *) ps_malloc(LCD_HEIGHT*LCD_WIDTH/8);
   memset(screenbuf, 0x00, LCD_HEIGHT*LCD_WIDTH/8);
+  for (byte p = 0; p < LCD_HEIGHT/8; p++) {
+    Display_dirty(p, 0, LCD_WIDTH-1);
+  }
   Display_update();
 }
 
-// Send current buffer to the display
+// Send the changed parts of the buffer to the display
 void Display_update()
 {
-  uint8_t *pbuf = screenbuf;
-
   LCD_SPI.beginTransaction(SPI_CONFIG);
 
   for (byte p = 0; p < LCD_HEIGHT/8; p++) {
+    if (dirtyFirst[p] > dirtyLast[p]) {
+      continue;
+    }
+    byte c = dirtyFirst[p];
+    uint8_t *pbuf = screenbuf + p*LCD_WIDTH + c;
     Display_sendcmd(ST7565R_SET_PAGE | p);
-    Display_sendcmd(ST7565R_SET_COLUMN_UPPER | 0);
-    Display_sendcmd(ST7565R_SET_COLUMN_LOWER | 0);
+    Display_sendcmd(ST7565R_SET_COLUMN_UPPER | (c >> 4));
+    Display_sendcmd(ST7565R_SET_COLUMN_LOWER | (c & 0x0F));
     digitalWrite(pinCS, LOW);
     digitalWrite(pinRS, DATA);
-    for (byte c = 0; c < LCD_WIDTH; c++) {
+    for (; c <= dirtyLast[p]; c++) {
       LCD_SPI.transfer(*pbuf++);
     }
     digitalWrite(pinCS, HIGH);
+    dirtyFirst[p] = LCD_WIDTH;
+    dirtyLast[p] = 0;
   }
 
   LCD_SPI.endTransaction();
 }
 
+// Mark columns c0 to c1 of page p to be sent by Display_update
+void Display_dirty(byte p, byte c0, byte c1) {
+  if (c0 < dirtyFirst[p]) {
+    dirtyFirst[p] = c0;
+  }
+  if (c1 > dirtyLast[p]) {
+    dirtyLast[p] = c1;
+  }
+}
+
 // Write string s starting at line l (0-3) collumn c (0-16)
 void Display_str(char *str, int l, int c) {
   while (*str) {
@@ -249,17 +272,18 @@ void Display_str(char *str, int l, int c) {
 }
 
 // Write char chr at line l (0-3) collumn c (0-16)
+// Only the pages where the char changed are marked to be sent
 void Display_chr(char chr, int l, int c) {
   byte *pgc = (byte *) (font8x16 + ((chr - 0x20) << 4));
   l = (3-l) << 1;
   c = c << 3;
-  byte *psc = screenbuf + l*LCD_WIDTH + c;
-  for (int i = 0; i < 8; i++) {
-    *psc++ = *pgc++;
-  }
-  psc = screenbuf + (l+1)*LCD_WIDTH + c;
-  for (int i = 0; i < 8; i++) {
-    *psc++ = *pgc++;
+  for (int p = l; p < l+2; p++) {
+    byte *psc = screenbuf + p*LCD_WIDTH + c;
+    if (memcmp(psc, pgc, 8) != 0) {
+      memcpy(psc, pgc, 8);
+      Display_dirty(p, c, c+7);
+    }
+    pgc += 8;
   }
 }
 
@@ -0,0 +1,123 @@
+/*
+ * Single-File-Header for retained text fields
+ *
+ * A field is a row of fixed-size character cells on the screen that
+ * remembers what it shows. Setting a new text draws only the cells whose
+ * character changed; the drawing function of the display (ui_backend_t)
+ * draws a character over the whole cell, with its background, and marks
+ * what it changed for the next refresh. So a clock that ticks redraws and
+ * sends one or two digits instead of the whole line.
+ *
+ * The same file is used with the SSD1306 (CH32V003/ringdemo), the ST7789
+ * (ESP32C6_LCD_147) and the LCD12864 (ESP32S3N16R8). The CH32V003 demos
+ * use CH32V003/common/ui_fields.h; the Arduino sketches need a copy in
+ * their folder, keep the copies equal.
+ */
+
+#ifndef _UI_FIELDS_H
+#define _UI_FIELDS_H
+
+#include <stdint.h>
+
+// maximum number of cells in a field
+#ifndef UI_MAX_LEN
+#define UI_MAX_LEN 16
+#endif
+
+// decimal separator for ui_number
+#ifndef UI_DECIMAL_POINT
+#define UI_DECIMAL_POINT '.'
+#endif
+
+typedef struct {
+	void (*draw)(int16_t x, int16_t y, char c);		// draw c in the cell at x,y
+} ui_backend_t;
+
+typedef struct {
+	const ui_backend_t *be;
+	int16_t x, y;				// top left of the first cell
+	uint8_t cw;					// cell width in pixels
+	uint8_t len;				// number of cells
+	char text[UI_MAX_LEN];		// what is on the screen, 0 = unknown
+} ui_field_t;
+
+// initializer for a field, all cells are drawn the first time
+#define UI_FIELD(be, x, y, cw, len) { (be), (x), (y), (cw), (len), { 0 } }
+
+// cells drawn since the start, to see what the fields save
+uint32_t ui_cells_drawn;
+
+/*
+ * force all cells to be drawn next time (after the screen was cleared)
+ */
+void ui_invalidate(ui_field_t *f)
+{
+	for(uint8_t i=0;i<f->len;i++)
+		f->text[i] = 0;
+}
+
+/*
+ * show a text, left aligned; cells after its end become spaces
+ * and characters that don't fit are not shown
+ */
+void ui_text(ui_field_t *f, const char *s)
+{
+	char c;
+
+	for(uint8_t i=0;i<f->len;i++)
+	{
+		c = *s ? *s++ : ' ';
+		if(c != f->text[i])
+		{
+			f->text[i] = c;
+			f->be->draw(f->x + i*f->cw, f->y, c);
+			ui_cells_drawn++;
+		}
+	}
+}
+
+/*
+ * show a number with a fixed number of decimals (value 253 with 1 decimal
+ * is "25.3"), right aligned; with zeros, the integer part is padded with
+ * zeros instead of spaces; fields too short show '*'
+ */
+void ui_number(ui_field_t *f, int32_t value, uint8_t decimals, uint8_t zeros)
+{
+	char buf[UI_MAX_LEN+1];
+	uint32_t v = value < 0 ? -(uint32_t)value : (uint32_t)value;
+	uint8_t sign = value < 0;		// a cell for the '-'
+	uint8_t i = f->len, n = 0, point = (decimals == 0);
+
+	buf[i] = 0;
+	// digits from the right, at least one before the point
+	while(i > sign)
+	{
+		if(!point && (n == decimals))
+		{
+			buf[--i] = UI_DECIMAL_POINT;
+			point = 1;
+			continue;
+		}
+		if(point && (n > decimals) && !v && !zeros)
+			break;
+		buf[--i] = '0' + (v % 10);
+		v /= 10;
+		n++;
+	}
+	if(v || !point || (n <= decimals))
+	{
+		// doesn't fit
+		for(i=0;i<f->len;i++)
+			buf[i] = '*';
+	}
+	else
+	{
+		if(sign)
+			buf[--i] = '-';
+		while(i > 0)
+			buf[--i] = ' ';
+	}
+	ui_text(f, buf);
+}
+
+#endif
@@ -0,0 +1,494 @@
+/**
+ * compress - teste de desempenho de compressão para o picobench
+ *
+ * Dois compressores dimensionados para a RAM de um microcontrolador:
+ *
+ * - LZ77 (no estilo LZSS) para blocos em memória, com janela de 2K
+ *   e tabela de hash de 512 entradas
+ * - um codec "streaming" no estilo do heatshrink, com janela de 256
+ *   bytes e saída em bits, processando um byte por vez
+ *
+ * Os dados de teste simulam um log de sensores em texto.
+ *
+ * Para rodar no PC:
+ *   gcc -O3 -DPICOBENCH_HOST -o compress compress.c
+ *
+ * Daniel Quadros
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+
+#ifdef PICOBENCH_HOST
+#include <time.h>
+
+static uint64_t time_us(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t) ts.tv_sec * 1000000ull + ts.tv_nsec / 1000;
+}
+#else
+#include "pico/stdlib.h"
+
+static inline uint64_t time_us(void)
+{
+  return time_us_64();
+}
+#endif
+
+void compress_test(void);
+
+// Tamanho dos dados de teste
+#define DATA_SIZE   16384
+
+// Tempo mínimo de cada medida (us)
+#define MIN_TIME    2000000
+
+
+/*
+ * LZ77 para blocos
+ *
+ * Formato: um byte de flags antes de cada grupo de 8 itens
+ * (bit = 0: literal de 1 byte, bit = 1: referência de 2 bytes).
+ * A referência tem 11 bits de distância (1 a 2048) e 5 bits de
+ * tamanho (3 a 34).
+ */
+
+#define LZ_WINDOW     2048
+#define LZ_MIN_MATCH  3
+#define LZ_MAX_MATCH  (LZ_MIN_MATCH+31)
+#define LZ_HASH_BITS  9
+#define LZ_HASH_SIZE  (1 << LZ_HASH_BITS)
+
+static uint16_t lz_hash[LZ_HASH_SIZE];
+
+static inline uint32_t lz_hash3(const uint8_t *p)
+{
+  uint32_t v = p[0] | (p[1] << 8) | (p[2] << 16);
+  return (v * 2654435761u) >> (32 - LZ_HASH_BITS);
+}
+
+// Comprime n bytes de in para out, retorna o tamanho comprimido
+// out precisa ter espaço para n + n/8 + 1 bytes
+size_t lz_compress(const uint8_t *in, size_t n, uint8_t *out)
+{
+  size_t ip = 0, op = 0;
+  size_t flagpos = 0;
+  uint8_t flags = 0, nitems = 8;
+
+  // a posição 0 é usada como "vazio", sempre será testada
+  memset(lz_hash, 0, sizeof(lz_hash));
+
+  while (ip < n) {
+    if (nitems == 8) {
+      if (ip != 0) {
+        out[flagpos] = flags;
+      }
+      flagpos = op++;
+      flags = 0;
+      nitems = 0;
+    }
+
+    size_t len = 0, dist = 0;
+    if (ip + LZ_MIN_MATCH <= n) {
+      uint32_t h = lz_hash3(in+ip);
+      size_t cand = lz_hash[h];
+      lz_hash[h] = (uint16_t) ip;
+      if ((cand < ip) && ((ip - cand) <= LZ_WINDOW)) {
+        size_t max = n - ip;
+        if (max > LZ_MAX_MATCH) {
+          max = LZ_MAX_MATCH;
+        }
+        while ((len < max) && (in[cand+len] == in[ip+len])) {
+          len++;
+        }
+        dist = ip - cand;
+      }
+    }
+
+    if (len >= LZ_MIN_MATCH) {
+      uint16_t code = ((dist-1) << 5) | (len - LZ_MIN_MATCH);
+      out[op++] = code >> 8;
+      out[op++] = code & 0xFF;
+      flags |= 1 << nitems;
+      // atualiza o hash dentro da sequência repetida
+      for (size_t i = 1; i < len; i++) {
+        if (ip + i + LZ_MIN_MATCH <= n) {
+          lz_hash[lz_hash3(in+ip+i)] = (uint16_t) (ip+i);
+        }
+      }
+      ip += len;
+    } else {
+      out[op++] = in[ip++];
+    }
+    nitems++;
+  }
+  if (n != 0) {
+    out[flagpos] = flags;
+  }
+  return op;
+}
+
+// Descomprime n bytes de in para out, retorna o tamanho descomprimido
+size_t lz_decompress(const uint8_t *in, size_t n, uint8_t *out)
+{
+  size_t ip = 0, op = 0;
+
+  while (ip < n) {
+    uint8_t flags = in[ip++];
+    for (int i = 0; (i < 8) && (ip < n); i++) {
+      if (flags & (1 << i)) {
+        uint16_t code = (in[ip] << 8) | in[ip+1];
+        ip += 2;
+        size_t dist = (code >> 5) + 1;
+        size_t len = (code & 0x1F) + LZ_MIN_MATCH;
+        // pode haver sobreposição, copia byte a byte
+        const uint8_t *src = out + op - dist;
+        while (len--) {
+          out[op++] = *src++;
+        }
+      } else {
+        out[op++] = in[ip++];
+      }
+    }
+  }
+  return op;
+}
+
+
+/*
+ * Codec "streaming" no estilo do heatshrink
+ *
+ * Cada item começa com um bit de tag:
+ *   1 + 8 bits: literal
+ *   0 + HS_W bits de distância-1 + HS_L bits de tamanho-1: referência
+ * Os dados são entregues e recebidos um pedaço de cada vez, o
+ * resultado é enviado para uma função de saída.
+ */
+
+#define HS_W      8                 // janela de 256 bytes
+#define HS_L      4                 // tamanho até 16 bytes
+#define HS_WINDOW (1 << HS_W)
+#define HS_LOOKAHEAD (1 << HS_L)
+#define HS_BREAKEVEN 2              // referência só compensa acima disso
+
+typedef void (*hs_out_t)(void *ctx, uint8_t b);
+
+typedef struct {
+  uint8_t buf[2*HS_WINDOW];         // janela + dados a comprimir
+  uint16_t start;                   // início da janela em buf
+  uint16_t pos;                     // próximo byte a comprimir
+  uint16_t end;                     // fim dos dados em buf
+  uint32_t bits;                    // bits aguardando saída
+  uint8_t nbits;
+  hs_out_t out;
+  void *ctx;
+} hs_encoder;
+
+typedef struct {
+  uint8_t window[HS_WINDOW];
+  uint16_t head;
+  uint32_t bits;                    // bits aguardando decodificação
+  uint8_t nbits;
+  hs_out_t out;
+  void *ctx;
+} hs_decoder;
+
+void hs_enc_init(hs_encoder *enc, hs_out_t out, void *ctx)
+{
+  enc->start = enc->pos = enc->end = 0;
+  enc->bits = 0;
+  enc->nbits = 0;
+  enc->out = out;
+  enc->ctx = ctx;
+}
+
+static inline void hs_put_bits(hs_encoder *enc, uint32_t val, uint8_t n)
+{
+  enc->bits = (enc->bits << n) | val;
+  enc->nbits += n;
+  while (enc->nbits >= 8) {
+    enc->nbits -= 8;
+    enc->out(enc->ctx, (uint8_t) (enc->bits >> enc->nbits));
+  }
+}
+
+// Comprime os dados em buf até restarem 'keep' bytes
+static void hs_enc_step(hs_encoder *enc, uint16_t keep)
+{
+  while ((enc->end - enc->pos) > keep) {
+    uint16_t max = enc->end - enc->pos;
+    if (max > HS_LOOKAHEAD) {
+      max = HS_LOOKAHEAD;
+    }
+    const uint8_t *p = enc->buf + enc->pos;
+    uint16_t best = 0, bestdist = 0;
+    for (uint16_t s = enc->start; s < enc->pos; s++) {
+      if (enc->buf[s] != p[0]) {
+        continue;
+      }
+      uint16_t len = 1;
+      while ((len < max) && (enc->buf[s+len] == p[len])) {
+        len++;
+      }
+      if (len > best) {
+        best = len;
+        bestdist = enc->pos - s;
+        if (len == max) {
+          break;    // não tem como melhorar
+        }
+      }
+    }
+    if (best > HS_BREAKEVEN) {
+      hs_put_bits(enc, ((bestdist-1) << HS_L) | (best-1), 1+HS_W+HS_L);
+      enc->pos += best;
+    } else {
+      hs_put_bits(enc, 0x100 | p[0], 9);
+      enc->pos++;
+    }
+    if ((enc->pos - enc->start) > HS_WINDOW) {
+      enc->start = enc->pos - HS_WINDOW;
+    }
+  }
+}
+
+// Entrega n bytes para compressão
+void hs_enc_sink(hs_encoder *enc, const uint8_t *data, size_t n)
+{
+  while (n) {
+    if (enc->end == sizeof(enc->buf)) {
+      // desloca a janela para o início do buffer
+      uint16_t shift = enc->start;
+      memmove(enc->buf, enc->buf+shift, enc->end-shift);
+      enc->start = 0;
+      enc->pos -= shift;
+      enc->end -= shift;
+    }
+    size_t room = sizeof(enc->buf) - enc->end;
+    if (room > n) {
+      room = n;
+    }
+    memcpy(enc->buf+enc->end, data, room);
+    enc->end += room;
+    data += room;
+    n -= room;
+    // mantém um lookahead completo para buscar referências
+    hs_enc_step(enc, HS_LOOKAHEAD);
+  }
+}
+
+// Comprime o que restou e descarrega os bits pendentes
+void hs_enc_finish(hs_encoder *enc)
+{
+  hs_enc_step(enc, 0);
+  if (enc->nbits) {
+    hs_put_bits(enc, 0, 8 - enc->nbits);
+  }
+}
+
+void hs_dec_init(hs_decoder *dec, hs_out_t out, void *ctx)
+{
+  memset(dec->window, 0, sizeof(dec->window));
+  dec->head = 0;
+  dec->bits = 0;
+  dec->nbits = 0;
+  dec->out = out;
+  dec->ctx = ctx;
+}
+
+static inline void hs_emit(hs_decoder *dec, uint8_t b)
+{
+  dec->window[dec->head++ & (HS_WINDOW-1)] = b;
+  dec->out(dec->ctx, b);
+}
+
+// Entrega n bytes comprimidos para descompressão
+// (os bits de enchimento no final nunca formam um item completo)
+void hs_dec_sink(hs_decoder *dec, const uint8_t *data, size_t n)
+{
+  while (n--) {
+    dec->bits = (dec->bits << 8) | *data++;
+    dec->nbits += 8;
+    for (;;) {
+      if (dec->nbits < 9) {
+        break;
+      }
+      if ((dec->bits >> (dec->nbits-1)) & 1) {
+        dec->nbits -= 9;
+        hs_emit(dec, (uint8_t) (dec->bits >> dec->nbits));
+      } else {
+        if (dec->nbits < 1+HS_W+HS_L) {
+          break;
+        }
+        dec->nbits -= 1+HS_W+HS_L;
+        uint32_t code = dec->bits >> dec->nbits;
+        uint16_t len = (code & (HS_LOOKAHEAD-1)) + 1;
+        uint16_t dist = ((code >> HS_L) & (HS_WINDOW-1)) + 1;
+        while (len--) {
+          hs_emit(dec, dec->window[(dec->head - dist) & (HS_WINDOW-1)]);
+        }
+      }
+    }
+  }
+}
+
+// Função de saída para buffer em memória
+typedef struct {
+  uint8_t *p;
+  size_t n;
+} hs_membuf;
+
+static void hs_to_mem(void *ctx, uint8_t b)
+{
+  hs_membuf *m = (hs_membuf *) ctx;
+  m->p[m->n++] = b;
+}
+
+
+/*
+ * Geração de dados parecidos com um log de sensores
+ */
+static uint32_t seed = 12345;
+
+static uint32_t rnd(void)
+{
+  seed = seed * 1103515245u + 12345u;
+  return seed >> 16;
+}
+
+static size_t gen_log(char *buf, size_t size)
+{
+  size_t n = 0;
+  uint32_t t = 36000;
+  int temp = 2345, hum = 562, press = 10132;
+  while (n < size) {
+    char line[64];
+    temp += (int) (rnd() % 7) - 3;
+    hum += (int) (rnd() % 5) - 2;
+    press += (int) (rnd() % 3) - 1;
+    int len = snprintf(line, sizeof(line),
+      "2024-07-12 %02lu:%02lu:%02lu;T=%d.%02d;H=%d.%d;P=%d.%d\n",
+      (unsigned long) (t/3600)%24, (unsigned long) (t/60)%60, (unsigned long) t%60,
+      temp/100, temp%100, hum/10, hum%10, press/10, press%10);
+    if (n + len > size) {
+      len = size - n;
+    }
+    memcpy(buf+n, line, len);
+    n += len;
+    t += 5;
+  }
+  return n;
+}
+
+
+/*
+ * O teste
+ */
+
+static void print_result(const char *nome, size_t n, size_t nc,
+                         long reps_c, uint64_t tc, long reps_d, uint64_t td)
+{
+  printf("%-10s %6.1f%%  %8.3f  %8.3f\n", nome,
+         100.0 * nc / n,
+         ((double) n * reps_c) / tc,
+         ((double) n * reps_d) / td);
+}
+
+void compress_test(void)
+{
+  uint8_t *orig = (uint8_t *) malloc(DATA_SIZE);
+  uint8_t *comp = (uint8_t *) malloc(DATA_SIZE + DATA_SIZE/8 + 16);
+  uint8_t *dest = (uint8_t *) malloc(DATA_SIZE);
+  hs_encoder *enc = (hs_encoder *) malloc(sizeof(hs_encoder));
+  hs_decoder *dec = (hs_decoder *) malloc(sizeof(hs_decoder));
+  if ((orig == NULL) || (comp == NULL) || (dest == NULL) ||
+      (enc == NULL) || (dec == NULL)) {
+    printf("Memoria insuficiente!\n");
+    free(orig); free(comp); free(dest); free(enc); free(dec);
+    return;
+  }
+
+  size_t n = gen_log((char *) orig, DATA_SIZE);
+  size_t nc = 0;
+  long reps;
+  uint64_t inicio, tc, td;
+  long reps_c, reps_d;
+
+  printf("Compressao de %u bytes de log de sensores\n", (unsigned) n);
+  printf("Algoritmo   Taxa   Compr MB/s Descomp MB/s\n");
+  printf("------------------------------------------\n");
+
+  // LZ77
+  reps = 0;
+  inicio = time_us();
+  do {
+    nc = lz_compress(orig, n, comp);
+    reps++;
+  } while ((tc = time_us() - inicio) < MIN_TIME);
+  reps_c = reps;
+
+  reps = 0;
+  inicio = time_us();
+  do {
+    lz_decompress(comp, nc, dest);
+    reps++;
+  } while ((td = time_us() - inicio) < MIN_TIME);
+  reps_d = reps;
+
+  if ((lz_decompress(comp, nc, dest) != n) || memcmp(orig, dest, n)) {
+    printf("LZ77: ERRO na descompressao!\n");
+  } else {
+    print_result("LZ77", n, nc, reps_c, tc, reps_d, td);
+  }
+
+  // heatshrink, entregando os dados em pedaços de 64 bytes
+  hs_membuf mb;
+  reps = 0;
+  inicio = time_us();
+  do {
+    mb.p = comp;
+    mb.n = 0;
+    hs_enc_init(enc, hs_to_mem, &mb);
+    for (size_t i = 0; i < n; i += 64) {
+      hs_enc_sink(enc, orig+i, (n-i) < 64 ? (n-i) : 64);
+    }
+    hs_enc_finish(enc);
+    reps++;
+  } while ((tc = time_us() - inicio) < MIN_TIME);
+  reps_c = reps;
+  nc = mb.n;
+
+  reps = 0;
+  inicio = time_us();
+  do {
+    mb.p = dest;
+    mb.n = 0;
+    hs_dec_init(dec, hs_to_mem, &mb);
+    for (size_t i = 0; i < nc; i += 64) {
+      hs_dec_sink(dec, comp+i, (nc-i) < 64 ? (nc-i) : 64);
+    }
+    reps++;
+  } while ((td = time_us() - inicio) < MIN_TIME);
+  reps_d = reps;
+
+  if ((mb.n != n) || memcmp(orig, dest, n)) {
+    printf("Heatshrink: ERRO na descompressao!\n");
+  } else {
+    print_result("Heatshrink", n, nc, reps_c, tc, reps_d, td);
+  }
+
+  free(orig); free(comp); free(dest); free(enc); free(dec);
+  printf("\n");
+}
+
+#ifdef PICOBENCH_HOST
+int main()
+{
+  printf("Running on host\n\n");
+  compress_test();
+  return 0;
+}
+#endif
@@ -0,0 +1,106 @@
+/**
+ * memtest - teste de contenção no acesso à memória para o picobench
+ *
+ * Cada core percorre um buffer de 768 bytes, lendo e escrevendo.
+ * O teste é repetido com os buffers em lugares diferentes:
+ *
+ * - SRAM principal (bancos intercalados - "striped")
+ * - um banco scratch para cada core (o core 0 usa o SCRATCH_Y, onde
+ *   fica a sua pilha, e o core 1 usa o SCRATCH_X, onde fica a dele)
+ * - os dois buffers no mesmo banco scratch
+ *
+ * Os bancos scratch têm 4K, mas a metade é ocupada pelas pilhas.
+ *
+ * Daniel Quadros
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include "pico/stdlib.h"
+#include "pico/multicore.h"
+
+void memtest(void);
+
+// Tamanho de cada buffer (em palavras de 32 bits)
+#define MT_WORDS  192
+
+// Quantas vezes o buffer é percorrido
+#define MT_REPS   20000
+
+// Buffers nos vários lugares
+static uint32_t mt_sram[2][MT_WORDS];
+static uint32_t __scratch_x("memtest") mt_scratch_x[2][MT_WORDS];
+static uint32_t __scratch_y("memtest") mt_scratch_y[MT_WORDS];
+
+// Configurações do teste
+typedef struct {
+  const char *nome;
+  uint32_t *buf0;         // buffer do core 0
+  uint32_t *buf1;         // buffer do core 1 (NULL = só o core 0)
+} mt_config;
+
+static const mt_config configs[] = {
+  { "SRAM, 1 core",                mt_sram[0],      NULL },
+  { "SCRATCH_Y, 1 core",           mt_scratch_y,    NULL },
+  { "SRAM, 2 cores",               mt_sram[0],      mt_sram[1] },
+  { "SCRATCH_Y + SCRATCH_X",       mt_scratch_y,    mt_scratch_x[0] },
+  { "SCRATCH_X, 2 cores",          mt_scratch_x[0], mt_scratch_x[1] },
+};
+
+// Percorre o buffer, lendo e escrevendo
+static uint32_t __attribute__ ((noinline)) mt_kernel(uint32_t *buf)
+{
+  uint32_t sum = 0;
+  for (int r = 0; r < MT_REPS; r++) {
+    for (int i = 0; i < MT_WORDS; i++) {
+      uint32_t v = buf[i];
+      sum += v;
+      buf[i] = v + r;
+    }
+  }
+  return sum;
+}
+
+// Rotina executada no core 1: recebe o buffer, devolve o tempo
+static void mt_core1(void)
+{
+  while (true) {
+    uint32_t *buf = (uint32_t *) (uintptr_t) multicore_fifo_pop_blocking();
+    uint64_t inicio = time_us_64();
+    mt_kernel(buf);
+    multicore_fifo_push_blocking((uint32_t) (time_us_64() - inicio));
+  }
+}
+
+static float mt_mbps(uint32_t tempo)
+{
+  return (2.0f * sizeof(uint32_t) * MT_WORDS * MT_REPS) / tempo;
+}
+
+void memtest(void)
+{
+  printf("Teste de contencao de memoria\n");
+  printf("Configuracao              Core0 MB/s  Core1 MB/s\n");
+  printf("------------------------------------------------\n");
+
+  multicore_launch_core1(mt_core1);
+
+  for (unsigned i = 0; i < sizeof(configs)/sizeof(configs[0]); i++) {
+    const mt_config *cfg = &configs[i];
+    if (cfg->buf1 != NULL) {
+      multicore_fifo_push_blocking((uint32_t) (uintptr_t) cfg->buf1);
+    }
+    uint64_t inicio = time_us_64();
+    mt_kernel(cfg->buf0);
+    uint32_t tempo0 = (uint32_t) (time_us_64() - inicio);
+    printf("%-25s %10.1f", cfg->nome, mt_mbps(tempo0));
+    if (cfg->buf1 != NULL) {
+      uint32_t tempo1 = multicore_fifo_pop_blocking();
+      printf("  %10.1f", mt_mbps(tempo1));
+    }
+    printf("\n");
+  }
+
+  multicore_reset_core1();
+  printf("\n");
+}
@@ -13,6 +13,27 @@
 void calculaPi(void);
 void linpack_test(int n);
 void wheatstones(void);
+void compress_test(void);
+void memtest(void);
+
+/*
+ * Onde ficam os dados dos testes
+ *
+ * MEM_HEAP      - alocados com malloc
+ * MEM_SRAM      - vetor estático na SRAM principal (intercalada entre os bancos)
+ *
+ * O vetor do Pi ocupa 137K e a matriz 200x200 do LINPACK 158K em precisão
+ * simples (315K em dupla); nenhum dos dois cabe nos bancos scratch (4K).
+ * No RP2040 (264K de SRAM) os dois não cabem juntos na SRAM estática e a
+ * matriz em dupla precisão não cabe nem sozinha.
+ */
+#define MEM_HEAP      0
+#define MEM_SRAM      1
+
+#define PI_MEM        MEM_HEAP
+#define LINPACK_MEM   MEM_HEAP
+
+static const char *mem_nome[] = { "heap", "SRAM" };
 
 int main() {
     // Inicia stdio
@@ -23,7 +44,7 @@ int main() {
     }
     #endif
 
-    printf("Picobench v1.00\n");
+    printf("Picobench v1.02\n");
 
     #if PICO_RP2040
       #pragma message("Running on RP2040 - ARM Cortex-M0+")
@@ -50,6 +71,12 @@ int main() {
     // Teste de processamento de ponto flutuante dupla precisão
     wheatstones();
 
+    // Teste de processamento de bytes (compressão)
+    compress_test();
+
+    // Teste de contenção no acesso à memória
+    memtest();
+
     printf ("*** FIM ***\n");
 
     while(1) {
@@ -81,6 +108,11 @@ static inline uint32_t board_millis(void)
 #define NDIGITS 10000           //max digits to compute
 #define LEN (NDIGITS/4+1)*14   //nec. array length
 
+#if PI_MEM == MEM_SRAM
+static int32_t pi_f[LEN+1];
+#elif PI_MEM != MEM_HEAP
+#error "PI_MEM deve ser MEM_HEAP ou MEM_SRAM"
+#endif
 
 // Cálculo dos dígitos do Pi
 void calculaPi() {
@@ -96,9 +128,14 @@ void calculaPi() {
   char dig[5] = "0000"; // para fazer o print
   int n = 0;            // para mudar de linha a cada 100 dígitos
 
+#if PI_MEM == MEM_HEAP
   f = (int32_t *) malloc((LEN+1)*sizeof(int32_t));
+#else
+  f = pi_f;
+#endif
 
   printf ("Calculando %d digitos de Pi\n", NDIGITS);
+  printf ("Dados em: %s\n", mem_nome[PI_MEM]);
   uint32_t inicio = board_millis();
 
   c = LEN;
@@ -135,7 +172,9 @@ void calculaPi() {
   }
 
   uint32_t duracao = board_millis() - inicio;
+#if PI_MEM == MEM_HEAP
   free(f);
+#endif
   printf ("\nTempo: %lu ms\n\n", duracao);
 }
 
@@ -225,6 +264,19 @@ static REAL second   (void);
 
 static void *mempool;
 
+#if LINPACK_MEM == MEM_SRAM
+// Espaço para uma matriz 200x200
+#define LINPACK_MAXSIZE 200
+static REAL linpack_pool[LINPACK_MAXSIZE*LINPACK_MAXSIZE+LINPACK_MAXSIZE+
+                         (LINPACK_MAXSIZE*sizeof(int)+sizeof(REAL)-1)/sizeof(REAL)];
+#elif LINPACK_MEM != MEM_HEAP
+#error "LINPACK_MEM deve ser MEM_HEAP ou MEM_SRAM"
+#endif
+
+#if PICO_RP2040 && (LINPACK_MEM == MEM_SRAM) && (defined(DP) || (PI_MEM == MEM_SRAM))
+#error "No RP2040 a matriz do LINPACK so cabe na SRAM estatica em precisao simples e sem o vetor do Pi"
+#endif
+
 void linpack_test(int arsize)
 {
   long    arsize2d,nreps;
@@ -240,13 +292,23 @@ void linpack_test(int arsize)
   printf("Precisao do programa: %d digitos\n", BASE10DIG);
   printf("Matriz %d x %d\n", arsize, arsize);
   printf("Memoria necessaria: %ld\n", memreq);
+  printf("Dados em: %s\n", mem_nome[LINPACK_MEM]);
 
   malloc_arg=(size_t)memreq;
+#if LINPACK_MEM == MEM_HEAP
   if ((MEM_T)malloc_arg!=memreq || (mempool=malloc(malloc_arg))==NULL)
   {
     printf("Memoria insuficiente!\n");
     return;
   }
+#else
+  if (malloc_arg > sizeof(linpack_pool))
+  {
+    printf("Memoria insuficiente!\n");
+    return;
+  }
+  mempool = linpack_pool;
+#endif
 
   printf("    Reps Time(s) DGEFA   DGESL  OVERHEAD    KFLOPS\n");
   printf("----------------------------------------------------\n");
@@ -255,7 +317,9 @@ void linpack_test(int arsize)
   nreps=1;
   while (linpack(nreps,arsize)<10.)
       nreps*=2;
+#if LINPACK_MEM == MEM_HEAP
   free(mempool);
+#endif
 
   printf("\n");
 }
@@ -1142,6 +1206,42 @@ void P3(double X, double Y, double *Z);
 double T,T1_X,T2_X,E1[5];
 int J,K,L;
 
+/*
+ * Seleção e medição individual dos módulos, como na versão de
+ * Roy Longbottom. O bit n de WHET_MODULES seleciona o módulo n.
+ * O resultado em MIPS só é apresentado com todos os módulos.
+ */
+#define WHET_ALL      0x0FDE      // módulos 1 a 11, exceto o 5
+#define WHET_MODULES  WHET_ALL
+#define WHET_SEL(n)   ((WHET_MODULES >> (n)) & 1)
+
+typedef struct {
+  const char *nome;
+  long ops;                       // operações por iteração
+  const char *unidade;
+} whet_module;
+
+static const whet_module whet_mod[12] = {
+  { NULL,                  0, NULL     },
+  { "Simple identifiers", 16, "MFLOPS" },
+  { "Array elements",     16, "MFLOPS" },
+  { "Array as parameter", 96, "MFLOPS" },
+  { "Conditional jumps",   3, "MOPS"   },
+  { NULL,                  0, NULL     },
+  { "Integer arithmetic", 15, "MOPS"   },
+  { "Trig functions",     10, "MOPS"   },
+  { "Procedure calls",     6, "MFLOPS" },
+  { "Array references",    3, "MOPS"   },
+  { "Integer arithmetic",  5, "MOPS"   },
+  { "Standard functions",  3, "MOPS"   },
+};
+
+// Tempo de cada módulo (us)
+static uint64_t t_mod[12];
+
+// Guarda resultados de módulos que o compilador poderia eliminar
+static volatile double whet_sink;
+
 void wheatstones() {
   /* used in the FORTRAN version */
   long I;
@@ -1154,8 +1254,10 @@ void wheatstones() {
   long loopstart;
   long startsec, finisec;
   float KIPS;
+  uint64_t t_inicio, t_total;
 
   printf("Whetstone benchmark\n");
+  memset(t_mod, 0, sizeof(t_mod));
 
   loopstart = 10000;		/* see the note about LOOP below */
 
@@ -1193,20 +1295,21 @@ C
 
 IILOOP:
   N1  = 0;
-  N2  = 12 * LOOP;
-  N3  = 14 * LOOP;
-  N4  = 345 * LOOP;
-  N6  = 210 * LOOP;
-  N7  = 32 * LOOP;
-  N8  = 899 * LOOP;
-  N9  = 616 * LOOP;
+  N2  = WHET_SEL(2) ? 12 * LOOP : 0;
+  N3  = WHET_SEL(3) ? 14 * LOOP : 0;
+  N4  = WHET_SEL(4) ? 345 * LOOP : 0;
+  N6  = WHET_SEL(6) ? 210 * LOOP : 0;
+  N7  = WHET_SEL(7) ? 32 * LOOP : 0;
+  N8  = WHET_SEL(8) ? 899 * LOOP : 0;
+  N9  = WHET_SEL(9) ? 616 * LOOP : 0;
   N10 = 0;
-  N11 = 93 * LOOP;
+  N11 = WHET_SEL(11) ? 93 * LOOP : 0;
 /*
 C
 C	Module 1: Simple identifiers
 C
 */
+  t_inicio = time_us_64();
   X1  =  1.0;
   X2  = -1.0;
   X3  = -1.0;
@@ -1218,6 +1321,7 @@ C
       X3 = (X1 - X2 + X3 + X4) * T;
       X4 = (-X1+ X2 + X3 + X4) * T;
   }
+  t_mod[1] += time_us_64() - t_inicio;
 #ifdef PRINTOUT
   IF (JJ==II)POUT(N1,N1,N1,X1,X2,X3,X4);
 #endif
@@ -1227,6 +1331,7 @@ C
 C	Module 2: Array elements
 C
 */
+  t_inicio = time_us_64();
   E1[1] =  1.0;
   E1[2] = -1.0;
   E1[3] = -1.0;
@@ -1239,6 +1344,7 @@ C
       E1[4] = (-E1[1] + E1[2] + E1[3] + E1[4]) * T;
   }
 
+  t_mod[2] += time_us_64() - t_inicio;
 #ifdef PRINTOUT
   IF (JJ==II)POUT(N2,N3,N2,E1[1],E1[2],E1[3],E1[4]);
 #endif
@@ -1248,9 +1354,11 @@ C
 C	Module 3: Array as parameter
 C
 */
+  t_inicio = time_us_64();
   for (I = 1; I <= N3; I++)
     PA(E1);
 
+  t_mod[3] += time_us_64() - t_inicio;
 #ifdef PRINTOUT
   IF (JJ==II)POUT(N3,N2,N2,E1[1],E1[2],E1[3],E1[4]);
 #endif
@@ -1260,6 +1368,7 @@ C
 C	Module 4: Conditional jumps
 C
 */
+  t_inicio = time_us_64();
   J = 1;
   for (I = 1; I <= N4; I++) {
     if (J == 1)
@@ -1278,6 +1387,7 @@ C
       J = 0;
   }
 
+  t_mod[4] += time_us_64() - t_inicio;
 #ifdef PRINTOUT
   IF (JJ==II)POUT(N4,J,J,X1,X2,X3,X4);
 #endif
@@ -1288,6 +1398,7 @@ C	Module 5: Omitted
 C 	Module 6: Integer arithmetic
 C
 */
+  t_inicio = time_us_64();
 
   J = 1;
   K = 2;
@@ -1301,6 +1412,7 @@ C
       E1[K-1] = J * K * L;
   }
 
+  t_mod[6] += time_us_64() - t_inicio;
 #ifdef PRINTOUT
   IF (JJ==II)POUT(N6,J,K,E1[1],E1[2],E1[3],E1[4]);
 #endif
@@ -1310,6 +1422,7 @@ C
 C	Module 7: Trigonometric functions
 C
 */
+  t_inicio = time_us_64();
   X = 0.5;
   Y = 0.5;
 
@@ -1318,6 +1431,8 @@ C
     Y = T * DATAN(T2_X*DSIN(Y)*DCOS(Y)/(DCOS(X+Y)+DCOS(X-Y)-1.0));
   }
 
+  whet_sink = X + Y;
+  t_mod[7] += time_us_64() - t_inicio;
 #ifdef PRINTOUT
   IF (JJ==II)POUT(N7,J,K,X,X,Y,Y);
 #endif
@@ -1327,6 +1442,7 @@ C
 C	Module 8: Procedure calls
 C
 */
+  t_inicio = time_us_64();
   X = 1.0;
   Y = 1.0;
   Z = 1.0;
@@ -1334,6 +1450,7 @@ C
   for (I = 1; I <= N8; I++)
     P3(X,Y,&Z);
 
+  t_mod[8] += time_us_64() - t_inicio;
 #ifdef PRINTOUT
   IF (JJ==II)POUT(N8,J,K,X,Y,Z,Z);
 #endif
@@ -1343,6 +1460,7 @@ C
 C	Module 9: Array references
 C
 */
+  t_inicio = time_us_64();
   J = 1;
   K = 2;
   L = 3;
@@ -1353,6 +1471,7 @@ C
   for (I = 1; I <= N9; I++)
     P0();
 
+  t_mod[9] += time_us_64() - t_inicio;
 #ifdef PRINTOUT
   IF (JJ==II)POUT(N9,J,K,E1[1],E1[2],E1[3],E1[4]);
 #endif
@@ -1362,6 +1481,7 @@ C
 C	Module 10: Integer arithmetic
 C
 */
+  t_inicio = time_us_64();
   J = 2;
   K = 3;
 
@@ -1372,6 +1492,7 @@ C
       K = K - J - J;
   }
 
+  t_mod[10] += time_us_64() - t_inicio;
 #ifdef PRINTOUT
   IF (JJ==II)POUT(N10,J,K,X1,X2,X3,X4);
 #endif
@@ -1381,11 +1502,14 @@ C
 C	Module 11: Standard functions
 C
 */
+  t_inicio = time_us_64();
   X = 0.75;
 
   for (I = 1; I <= N11; I++)
     X = DSQRT(DEXP(DLOG(X)/T1_X));
 
+  whet_sink = X;
+  t_mod[11] += time_us_64() - t_inicio;
 #ifdef PRINTOUT
   IF (JJ==II)POUT(N11,J,K,X,X,X,X);
 #endif
@@ -1423,6 +1547,29 @@ C--------------------------------------------------------------------
 
   printf("Loops: %ld, Iterations: %d, Duration %f sec.\n", LOOP, II, duration);
 
+  long N[12] = { 0, N1, N2, N3, N4, 0, N6, N7, N8, N9, N10, N11 };
+  t_total = 0;
+  for (int m = 1; m < 12; m++) {
+    t_total += t_mod[m];
+  }
+  printf("   Modulo              Tempo(ms)      Taxa         %%Tempo\n");
+  printf("---------------------------------------------------------\n");
+  for (int m = 1; m < 12; m++) {
+    if ((N[m] == 0) || (t_mod[m] == 0)) {
+      continue;
+    }
+    printf("%2d %-20s %8.1f %9.2f %-6s %6.1f%%\n", m, whet_mod[m].nome,
+           t_mod[m]/1000.0,
+           ((double) whet_mod[m].ops * N[m] * II) / t_mod[m],
+           whet_mod[m].unidade,
+           100.0 * t_mod[m] / t_total);
+  }
+
+  if (WHET_MODULES != WHET_ALL) {
+    printf("Selecao parcial de modulos, MIPS nao calculado\n");
+    return;
+  }
+
   KIPS = (100.0*LOOP*II)/duration;
   printf("C Converted Double Precision Whetstones: ");
   if (KIPS >= 1000.0) {